@@ -0,0 +1,870 @@
+// memmem(), strcasestr()
+#define _GNU_SOURCE
+
+// Drives a running server with many connections over loopback and reports
+// the throughput and latency percentiles it got.
+//
+// Closed loop, the default, keeps -P requests in flight on every
+// connection and sends the next one as soon as an answer comes back, which
+// finds the most the server can take. Open loop (-R) sends requests on a
+// fixed schedule whatever pace the server keeps. Each one is timed from
+// when it was due rather than from when it went out, so a server that
+// stalls shows up in the latencies instead of quietly holding the client
+// back as well (coordinated omission). Requests still unanswered when the
+// run ends, or never sent because a connection had its fill in flight,
+// count as answered right at the end. The uncorrected figures are printed
+// next to them for comparison.
+//
+// Usage: loadGenerator [-a address] [-p port] [-c connections] [-t threads]
+//        [-d seconds] [-R rate] [-P depth] [-C] [-u path[=weight]]...
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_ADDRESS "127.0.0.1"
+#define DEFAULT_PORT 8080
+#define DEFAULT_CONNECTIONS 64
+#define DEFAULT_THREADS 1
+#define DEFAULT_SECONDS 10
+#define DEFAULT_DEPTH 1
+
+#define MAXIMUM_DEPTH 64
+#define MAXIMUM_PATHS 64
+#define MAXIMUM_EVENTS 256
+
+// Enough for the head of any response the server sends, bodies are read
+// through it and thrown away
+#define RESPONSE_BUFFER_SIZE (64 * 1024)
+
+// How long a connection waits before trying again after it could not
+// connect, in nanoseconds
+#define RECONNECT_DELAY (100 * 1000 * 1000LL)
+
+// Latencies are kept in nanoseconds in buckets of 2^HISTOGRAM_SUB_BITS
+// per power of two, so every value is within about 1.6% of its bucket's
+// bounds whatever its size. Values below 2^HISTOGRAM_SUB_BITS are exact.
+#define HISTOGRAM_SUB_BITS 6
+#define HISTOGRAM_SUB_BUCKETS (1u << HISTOGRAM_SUB_BITS)
+#define HISTOGRAM_BUCKETS ((64 - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_BUCKETS)
+
+typedef struct {
+	uint64_t counts[HISTOGRAM_BUCKETS];
+	uint64_t total;
+	uint64_t minimum;
+	uint64_t maximum;
+	// For the mean
+	double sum;
+} Histogram;
+
+typedef struct {
+	char *request;
+	size_t length;
+	unsigned weight;
+} Path;
+
+// A request written to the connection and not answered yet
+typedef struct {
+	Path const *path;
+	// When it should have gone out, which in closed loop is when it did
+	long long due;
+	long long sent;
+} Pending;
+
+typedef struct Thread Thread;
+
+typedef struct {
+	Thread *thread;
+	int fd;
+	bool connecting;
+	// When to try connecting again after a failure, 0 when not waiting
+	long long retryAt;
+
+	// Requests in flight in the order they were written
+	Pending pending[MAXIMUM_DEPTH];
+	unsigned pendingHead;
+	unsigned pendingCount;
+
+	// Requests still to be written, they are already counted in pending
+	char *out;
+	size_t outLength;
+	size_t outSent;
+
+	// Response being read. headerDone tells whether bodyLeft is known.
+	char in[RESPONSE_BUFFER_SIZE];
+	size_t inLength;
+	bool headerDone;
+	long long bodyLeft;
+	// Whether the server hangs up after the response being read
+	bool closeAfter;
+	// Whether any of it has arrived, a connection the server closed before
+	// that just gets its requests sent again
+	bool responseStarted;
+
+	// Open loop only: when the next request is due
+	long long nextDue;
+} Client;
+
+struct Thread {
+	pthread_t id;
+	int epollFD;
+	// Wakes the thread when requests are due, connections are to be tried
+	// again or the run is over
+	int timerFD;
+	Client *clients;
+	unsigned clientCount;
+	uint64_t random;
+
+	Histogram corrected;
+	Histogram uncorrected;
+	unsigned long long responses;
+	unsigned long long bytes;
+	unsigned long long connectErrors;
+	unsigned long long socketErrors;
+	unsigned long long statusErrors;
+	unsigned long long reconnects;
+	// Open loop only: requests that came due but were never sent, or never
+	// answered, before the end of the run
+	unsigned long long unsent;
+	unsigned long long unanswered;
+};
+
+static struct sockaddr_in serverAddress;
+static Path paths[MAXIMUM_PATHS];
+static unsigned pathCount;
+static unsigned totalWeight;
+static size_t longestRequest;
+static unsigned connectionCount = DEFAULT_CONNECTIONS;
+static unsigned threadCount = DEFAULT_THREADS;
+static unsigned depth = DEFAULT_DEPTH;
+static double rate;
+static bool closeEach;
+// Nanoseconds between the requests of one connection in open loop
+static long long interval;
+static long long startTime;
+static long long endTime;
+
+long long nanoseconds_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long) now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+unsigned histogram_index(uint64_t const value)
+{
+	if (value < HISTOGRAM_SUB_BUCKETS)
+		return (unsigned) value;
+	unsigned const highest = 63 - (unsigned) __builtin_clzll(value);
+	unsigned const shift = highest - HISTOGRAM_SUB_BITS;
+	return (shift + 1) * HISTOGRAM_SUB_BUCKETS
+		+ (unsigned) (value >> shift) - HISTOGRAM_SUB_BUCKETS;
+}
+
+// The largest value that lands in the bucket
+uint64_t histogram_bucket_value(unsigned const index)
+{
+	if (index < HISTOGRAM_SUB_BUCKETS)
+		return index;
+	unsigned const shift = index / HISTOGRAM_SUB_BUCKETS - 1;
+	uint64_t const top = HISTOGRAM_SUB_BUCKETS + index % HISTOGRAM_SUB_BUCKETS;
+	return ((top + 1) << shift) - 1;
+}
+
+void histogram_record(Histogram *const histogram, long long const value)
+{
+	uint64_t const v = value > 0 ? (uint64_t) value : 0;
+	histogram->counts[histogram_index(v)]++;
+	if (histogram->total == 0 || v < histogram->minimum)
+		histogram->minimum = v;
+	if (v > histogram->maximum)
+		histogram->maximum = v;
+	histogram->total++;
+	histogram->sum += (double) v;
+}
+
+void histogram_merge(Histogram *const into, Histogram const *const from)
+{
+	if (from->total == 0)
+		return;
+	for (unsigned i = 0; i < HISTOGRAM_BUCKETS; i++)
+		into->counts[i] += from->counts[i];
+	if (into->total == 0 || from->minimum < into->minimum)
+		into->minimum = from->minimum;
+	if (from->maximum > into->maximum)
+		into->maximum = from->maximum;
+	into->total += from->total;
+	into->sum += from->sum;
+}
+
+uint64_t histogram_percentile(Histogram const *const histogram, double const percentile)
+{
+	uint64_t const wanted = (uint64_t) ((double) histogram->total * percentile / 100.0 + 0.5);
+	uint64_t seen = 0;
+	for (unsigned i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		seen += histogram->counts[i];
+		if (seen >= wanted && seen > 0) {
+			uint64_t const value = histogram_bucket_value(i);
+			return value < histogram->maximum ? value : histogram->maximum;
+		}
+	}
+	return histogram->maximum;
+}
+
+// xorshift, only has to spread requests over the paths
+unsigned next_random(Thread *const thread)
+{
+	uint64_t x = thread->random;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	thread->random = x;
+	return (unsigned) (x >> 32);
+}
+
+Path const *pick_path(Thread *const thread)
+{
+	if (pathCount == 1)
+		return &paths[0];
+	unsigned ticket = next_random(thread) % totalWeight;
+	for (unsigned i = 0; i < pathCount; i++) {
+		if (ticket < paths[i].weight)
+			return &paths[i];
+		ticket -= paths[i].weight;
+	}
+	return &paths[pathCount - 1];
+}
+
+void client_disconnect(Client *const client)
+{
+	if (client->fd == -1)
+		return;
+	close(client->fd);
+	client->fd = -1;
+	client->connecting = false;
+}
+
+// Writes what is waiting in the out buffer. Returns false if the
+// connection failed.
+bool client_flush(Client *const client)
+{
+	while (client->outSent < client->outLength) {
+		ssize_t const status = send(client->fd, client->out + client->outSent,
+				client->outLength - client->outSent, MSG_NOSIGNAL);
+		if (status == -1) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return true;
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+		client->outSent += (size_t) status;
+	}
+	client->outLength = client->outSent = 0;
+	return true;
+}
+
+void client_queue_request(Client *const client, long long const due, long long const now)
+{
+	// Whatever has been written already makes room, the buffer only ever
+	// holds requests that are in flight
+	if (client->outSent > 0) {
+		memmove(client->out, client->out + client->outSent, client->outLength - client->outSent);
+		client->outLength -= client->outSent;
+		client->outSent = 0;
+	}
+	Path const *const path = pick_path(client->thread);
+	Pending *const pending = &client->pending[(client->pendingHead + client->pendingCount)
+		% MAXIMUM_DEPTH];
+	pending->path = path;
+	pending->due = due;
+	pending->sent = now;
+	client->pendingCount++;
+	memcpy(client->out + client->outLength, path->request, path->length);
+	client->outLength += path->length;
+}
+
+// Starts connecting, writing out every request still unanswered from the
+// last connection once it is up
+void client_connect(Client *const client, long long const now)
+{
+	client->retryAt = 0;
+	client->inLength = 0;
+	client->headerDone = false;
+	client->responseStarted = false;
+	client->outLength = client->outSent = 0;
+
+	client->fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (client->fd == -1) {
+		perror("client_connect(): Failed to create socket");
+		client->retryAt = now + RECONNECT_DELAY;
+		return;
+	}
+	int const one = 1;
+	setsockopt(client->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	struct epoll_event event = {
+		.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET,
+		.data.ptr = client
+	};
+	if (epoll_ctl(client->thread->epollFD, EPOLL_CTL_ADD, client->fd, &event) == -1) {
+		perror("client_connect(): Failed to add socket to epoll");
+		client_disconnect(client);
+		client->retryAt = now + RECONNECT_DELAY;
+		return;
+	}
+	if (connect(client->fd, (struct sockaddr const *) &serverAddress, sizeof(serverAddress)) == -1
+			&& errno != EINPROGRESS) {
+		client->thread->connectErrors++;
+		client_disconnect(client);
+		client->retryAt = now + RECONNECT_DELAY;
+		return;
+	}
+	client->connecting = true;
+
+	// Requests the old connection never answered are sent again, still due
+	// when they first were
+	for (unsigned i = 0; i < client->pendingCount; i++) {
+		Pending *const pending = &client->pending[(client->pendingHead + i) % MAXIMUM_DEPTH];
+		Path const *const path = pending->path;
+		pending->sent = now;
+		memcpy(client->out + client->outLength, path->request, path->length);
+		client->outLength += path->length;
+	}
+}
+
+void client_reconnect(Client *const client, long long const now)
+{
+	client_disconnect(client);
+	client->thread->reconnects++;
+	client_connect(client, now);
+}
+
+// Puts as many new requests on the connection as it may have in flight, or
+// in open loop as many as are due
+void client_issue(Client *const client, long long const now)
+{
+	if (client->fd == -1 || now >= endTime)
+		return;
+	unsigned const limit = closeEach ? 1 : depth;
+	if (rate > 0) {
+		while (client->pendingCount < limit && client->nextDue <= now) {
+			client_queue_request(client, client->nextDue, now);
+			client->nextDue += interval;
+		}
+	} else {
+		while (client->pendingCount < limit)
+			client_queue_request(client, now, now);
+	}
+}
+
+// Finds where the head of the response ends and reads what matters out of
+// it. Returns false if it is malformed.
+bool client_parse_header(Client *const client, size_t *const headerLength)
+{
+	char *const end = memmem(client->in, client->inLength, "\r\n\r\n", 4);
+	if (end == NULL) {
+		*headerLength = 0;
+		return client->inLength < RESPONSE_BUFFER_SIZE;
+	}
+	*headerLength = (size_t) (end - client->in) + 4;
+	*end = '\0';
+
+	if (strncmp(client->in, "HTTP/1.", 7) != 0 || strlen(client->in) < 12)
+		return false;
+	int const status = atoi(client->in + 9);
+	if (status < 200 || status >= 400)
+		client->thread->statusErrors++;
+
+	client->bodyLeft = -1;
+	client->closeAfter = closeEach;
+	char *line = strstr(client->in, "\r\n");
+	while (line != NULL) {
+		line += 2;
+		char *const lineEnd = strstr(line, "\r\n");
+		if (lineEnd != NULL)
+			*lineEnd = '\0';
+		if (strncasecmp(line, "Content-Length:", 15) == 0)
+			client->bodyLeft = strtoll(line + 15, NULL, 10);
+		else if (strncasecmp(line, "Connection:", 11) == 0 && strcasestr(line, "close") != NULL)
+			client->closeAfter = true;
+		if (lineEnd == NULL)
+			break;
+		line = lineEnd;
+		*line = '\r';
+	}
+	// 304 and the like have no body whatever they say
+	if (status == 304 || status == 204)
+		client->bodyLeft = 0;
+	if (client->bodyLeft < 0)
+		return false;
+	client->headerDone = true;
+	return true;
+}
+
+void client_finish_response(Client *const client, long long const now)
+{
+	Thread *const thread = client->thread;
+	Pending const *const pending = &client->pending[client->pendingHead];
+	if (now < endTime) {
+		histogram_record(&thread->corrected, now - pending->due);
+		histogram_record(&thread->uncorrected, now - pending->sent);
+		thread->responses++;
+	} else if (rate > 0) {
+		// Too late for the run, but not to be left out, see
+		// count_incomplete()
+		histogram_record(&thread->corrected, endTime - pending->due);
+		thread->unanswered++;
+	}
+	client->pendingHead = (client->pendingHead + 1) % MAXIMUM_DEPTH;
+	client->pendingCount--;
+	client->headerDone = false;
+	client->responseStarted = false;
+}
+
+// Counts a failed send() or recv() as an error unless it only means the
+// server hung up between responses, which is its right. A server that
+// closes with pipelined requests still unread resets the connection.
+void count_lost_connection(Client *const client, int const error)
+{
+	if ((error != ECONNRESET && error != EPIPE) || client->responseStarted)
+		client->thread->socketErrors++;
+}
+
+// Reads and accounts for whatever has arrived. Returns false if the
+// connection has to be made again.
+bool client_read(Client *const client, long long *const now)
+{
+	for (;;) {
+		ssize_t const status = recv(client->fd, client->in + client->inLength,
+				RESPONSE_BUFFER_SIZE - client->inLength, 0);
+		if (status == -1) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return true;
+			if (errno == EINTR)
+				continue;
+			count_lost_connection(client, errno);
+			return false;
+		}
+		if (status == 0) {
+			if (client->responseStarted)
+				client->thread->socketErrors++;
+			return false;
+		}
+		client->thread->bytes += (unsigned long long) status;
+		client->inLength += (size_t) status;
+		if (client->pendingCount == 0) {
+			client->thread->socketErrors++;
+			return false;
+		}
+		client->responseStarted = true;
+		*now = nanoseconds_now();
+
+		size_t consumed = 0;
+		while (consumed < client->inLength && client->pendingCount > 0) {
+			if (!client->headerDone) {
+				size_t headerLength;
+				memmove(client->in, client->in + consumed, client->inLength - consumed);
+				client->inLength -= consumed;
+				consumed = 0;
+				if (!client_parse_header(client, &headerLength)) {
+					client->thread->socketErrors++;
+					return false;
+				}
+				if (headerLength == 0)
+					break;
+				consumed = headerLength;
+			}
+			size_t const available = client->inLength - consumed;
+			size_t const body = (long long) available < client->bodyLeft
+				? available : (size_t) client->bodyLeft;
+			consumed += body;
+			client->bodyLeft -= (long long) body;
+			if (client->bodyLeft > 0)
+				break;
+
+			bool const closeAfter = client->closeAfter;
+			client_finish_response(client, *now);
+			client->responseStarted = consumed < client->inLength;
+			if (closeAfter)
+				return false;
+		}
+		memmove(client->in, client->in + consumed, client->inLength - consumed);
+		client->inLength -= consumed;
+
+		client_issue(client, *now);
+		if (!client_flush(client)) {
+			count_lost_connection(client, errno);
+			return false;
+		}
+	}
+}
+
+void client_handle(Client *const client, uint32_t const events, long long now)
+{
+	if (client->connecting) {
+		int error = 0;
+		socklen_t length = sizeof(error);
+		getsockopt(client->fd, SOL_SOCKET, SO_ERROR, &error, &length);
+		if (error != 0) {
+			client->thread->connectErrors++;
+			client_disconnect(client);
+			client->retryAt = now + RECONNECT_DELAY;
+			return;
+		}
+		if (!(events & (EPOLLOUT | EPOLLIN)))
+			return;
+		client->connecting = false;
+		client_issue(client, now);
+	}
+	if ((events & EPOLLOUT) && !client_flush(client)) {
+		count_lost_connection(client, errno);
+		client_reconnect(client, now);
+		return;
+	}
+	if ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) && !client_read(client, &now))
+		client_reconnect(client, now);
+}
+
+// When something next has to happen without the server saying anything
+// first
+long long next_wakeup(Thread const *const thread)
+{
+	long long next = endTime;
+	for (unsigned i = 0; i < thread->clientCount; i++) {
+		Client const *const client = &thread->clients[i];
+		if (client->retryAt != 0 && client->retryAt < next)
+			next = client->retryAt;
+		else if (rate > 0 && client->fd != -1 && !client->connecting
+				&& client->pendingCount < depth && client->nextDue < next)
+			next = client->nextDue;
+	}
+	return next;
+}
+
+// Arms the thread's timer for the next wakeup. epoll_wait() only takes
+// milliseconds, which would make open loop requests go out up to a
+// millisecond late and have that show up as latency.
+void arm_timer(Thread const *const thread)
+{
+	long long const next = next_wakeup(thread);
+	struct itimerspec const timer = {
+		.it_value = { .tv_sec = next / 1000000000LL, .tv_nsec = next % 1000000000LL }
+	};
+	if (timerfd_settime(thread->timerFD, TFD_TIMER_ABSTIME, &timer, NULL) == -1)
+		perror("arm_timer(): timerfd_settime() errored");
+}
+
+// Counts the open loop requests the run ended on without an answer into the
+// corrected latencies, as if answered at its end. Leaving them out would
+// hide exactly the stalls the correction is there to show.
+void count_incomplete(Thread *const thread)
+{
+	for (unsigned i = 0; i < thread->clientCount; i++) {
+		Client const *const client = &thread->clients[i];
+		for (unsigned j = 0; j < client->pendingCount; j++) {
+			Pending const *const pending =
+				&client->pending[(client->pendingHead + j) % MAXIMUM_DEPTH];
+			histogram_record(&thread->corrected, endTime - pending->due);
+			thread->unanswered++;
+		}
+		for (long long due = client->nextDue; due < endTime; due += interval) {
+			histogram_record(&thread->corrected, endTime - due);
+			thread->unsent++;
+		}
+	}
+}
+
+void *run_thread(void *const argument)
+{
+	Thread *const thread = argument;
+	long long now = nanoseconds_now();
+	for (unsigned i = 0; i < thread->clientCount; i++)
+		client_connect(&thread->clients[i], now);
+
+	struct epoll_event events[MAXIMUM_EVENTS];
+	while ((now = nanoseconds_now()) < endTime) {
+		arm_timer(thread);
+		int const count = epoll_wait(thread->epollFD, events, MAXIMUM_EVENTS, -1);
+		if (count == -1 && errno != EINTR) {
+			perror("run_thread(): epoll_wait() errored");
+			break;
+		}
+		now = nanoseconds_now();
+		for (int i = 0; i < count; i++) {
+			if (events[i].data.ptr == NULL) {
+				uint64_t expirations;
+				if (read(thread->timerFD, &expirations, sizeof(expirations)) == -1
+						&& errno != EAGAIN)
+					perror("run_thread(): Failed to read timer");
+				continue;
+			}
+			client_handle(events[i].data.ptr, events[i].events, now);
+		}
+
+		for (unsigned i = 0; i < thread->clientCount; i++) {
+			Client *const client = &thread->clients[i];
+			if (client->retryAt != 0 && client->retryAt <= now) {
+				client_connect(client, now);
+			} else if (rate > 0 && client->fd != -1 && !client->connecting) {
+				client_issue(client, now);
+				if (!client_flush(client)) {
+					count_lost_connection(client, errno);
+					client_reconnect(client, now);
+				}
+			}
+		}
+	}
+
+	if (rate > 0)
+		count_incomplete(thread);
+	for (unsigned i = 0; i < thread->clientCount; i++)
+		client_disconnect(&thread->clients[i]);
+	return NULL;
+}
+
+bool add_path(char const *const argument)
+{
+	if (pathCount == MAXIMUM_PATHS) {
+		fprintf(stderr, "add_path(): No more than %d paths\n", MAXIMUM_PATHS);
+		return false;
+	}
+	char const *const equals = strrchr(argument, '=');
+	size_t const pathLength = equals != NULL ? (size_t) (equals - argument) : strlen(argument);
+	long const weight = equals != NULL ? strtol(equals + 1, NULL, 10) : 1;
+	if (pathLength == 0 || argument[0] != '/' || weight <= 0) {
+		fprintf(stderr, "add_path(): Expected /path or /path=weight, got %s\n", argument);
+		return false;
+	}
+	char *const request = malloc(pathLength + 128);
+	if (request == NULL) {
+		perror("add_path(): Failed to allocate request");
+		return false;
+	}
+	int const length = sprintf(request, "GET %.*s HTTP/1.1\r\nHost: %s\r\n%s\r\n",
+			(int) pathLength, argument, inet_ntoa(serverAddress.sin_addr),
+			closeEach ? "Connection: close\r\n" : "");
+	paths[pathCount].request = request;
+	paths[pathCount].length = (size_t) length;
+	paths[pathCount].weight = (unsigned) weight;
+	pathCount++;
+	totalWeight += (unsigned) weight;
+	if ((size_t) length > longestRequest)
+		longestRequest = (size_t) length;
+	return true;
+}
+
+void print_latencies(char const *const name, Histogram const *const histogram)
+{
+	static double const percentiles[] = { 50, 90, 99, 99.9, 99.99 };
+	printf("%-12s %9.3f", name, histogram->total > 0
+		? histogram->sum / (double) histogram->total / 1e6 : 0.0);
+	for (size_t i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
+		printf(" %9.3f", (double) histogram_percentile(histogram, percentiles[i]) / 1e6);
+	printf(" %9.3f\n", (double) histogram->maximum / 1e6);
+}
+
+void print_usage(char const *const name)
+{
+	fprintf(stderr,
+		"Usage: %s [-a address] [-p port] [-c connections] [-t threads]\n"
+		"          [-d seconds] [-R rate] [-P depth] [-C] [-u path[=weight]]...\n"
+		"  -a address     IPv4 address of the server (default 127.0.0.1)\n"
+		"  -p port        its port (default 8080)\n"
+		"  -c connections open at once, spread over the threads (default 64)\n"
+		"  -t threads     threads driving them, each with its own epoll\n"
+		"                 (default 1)\n"
+		"  -d seconds     how long to run for (default 10)\n"
+		"  -R rate        requests per second to send in total on a fixed\n"
+		"                 schedule (open loop), 0 sends the next one as soon\n"
+		"                 as the last is answered (closed loop, the default)\n"
+		"  -P depth       requests pipelined on each connection, at most 64\n"
+		"                 (default 1)\n"
+		"  -C             close the connection after every response instead\n"
+		"                 of keeping it alive, pipelining is then off\n"
+		"  -u path=weight a path to request, may be given several times to\n"
+		"                 mix files of different sizes in proportion to their\n"
+		"                 weights (default /)\n",
+		name);
+}
+
+int main(int argc, char **argv)
+{
+	serverAddress.sin_family = AF_INET;
+	serverAddress.sin_port = htons(DEFAULT_PORT);
+	inet_pton(AF_INET, DEFAULT_ADDRESS, &serverAddress.sin_addr);
+	double seconds = DEFAULT_SECONDS;
+	char const *pathArguments[MAXIMUM_PATHS];
+	unsigned pathArgumentCount = 0;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "a:p:c:t:d:R:P:Cu:h")) != -1) {
+		switch (opt) {
+		case 'a':
+			if (inet_pton(AF_INET, optarg, &serverAddress.sin_addr) != 1) {
+				fprintf(stderr, "main(): Invalid address %s\n", optarg);
+				return 1;
+			}
+			break;
+		case 'p':
+			serverAddress.sin_port = htons((uint16_t) strtoul(optarg, NULL, 10));
+			break;
+		case 'c':
+			connectionCount = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case 't':
+			threadCount = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case 'd':
+			seconds = strtod(optarg, NULL);
+			break;
+		case 'R':
+			rate = strtod(optarg, NULL);
+			break;
+		case 'P':
+			depth = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case 'C':
+			closeEach = true;
+			break;
+		case 'u':
+			if (pathArgumentCount == MAXIMUM_PATHS) {
+				fprintf(stderr, "main(): No more than %d paths\n", MAXIMUM_PATHS);
+				return 1;
+			}
+			pathArguments[pathArgumentCount++] = optarg;
+			break;
+		default:
+			print_usage(argv[0]);
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+	if (connectionCount == 0 || threadCount == 0 || seconds <= 0 || rate < 0
+			|| depth == 0 || depth > MAXIMUM_DEPTH) {
+		print_usage(argv[0]);
+		return 1;
+	}
+	if (threadCount > connectionCount)
+		threadCount = connectionCount;
+	if (closeEach)
+		depth = 1;
+
+	// Paths are only turned into requests once -C is known
+	if (pathArgumentCount == 0)
+		pathArguments[pathArgumentCount++] = "/";
+	for (unsigned i = 0; i < pathArgumentCount; i++) {
+		if (!add_path(pathArguments[i]))
+			return 1;
+	}
+	signal(SIGPIPE, SIG_IGN);
+
+	Thread *const threads = calloc(threadCount, sizeof(Thread));
+	Client *const clients = calloc(connectionCount, sizeof(Client));
+	char *const outBuffers = malloc((size_t) connectionCount * depth * longestRequest);
+	if (threads == NULL || clients == NULL || outBuffers == NULL) {
+		perror("main(): Failed to allocate connections");
+		return 1;
+	}
+
+	startTime = nanoseconds_now();
+	endTime = startTime + (long long) (seconds * 1e9);
+	if (rate > 0)
+		interval = (long long) ((double) connectionCount * 1e9 / rate);
+
+	unsigned nextClient = 0;
+	for (unsigned i = 0; i < threadCount; i++) {
+		Thread *const thread = &threads[i];
+		thread->epollFD = epoll_create1(EPOLL_CLOEXEC);
+		thread->timerFD = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+		struct epoll_event event = { .events = EPOLLIN, .data.ptr = NULL };
+		if (thread->epollFD == -1 || thread->timerFD == -1
+				|| epoll_ctl(thread->epollFD, EPOLL_CTL_ADD, thread->timerFD, &event) == -1) {
+			perror("main(): Failed to create epoll instance and timer");
+			return 1;
+		}
+		thread->random = 0x9e3779b97f4a7c15ull * (i + 1);
+		thread->clients = &clients[nextClient];
+		thread->clientCount = connectionCount / threadCount
+			+ (i < connectionCount % threadCount);
+		for (unsigned j = 0; j < thread->clientCount; j++) {
+			Client *const client = &thread->clients[j];
+			client->thread = thread;
+			client->fd = -1;
+			client->out = outBuffers + (size_t) (nextClient + j) * depth * longestRequest;
+			// Spread the connections' schedules evenly over one interval
+			client->nextDue = startTime + interval * (nextClient + j) / connectionCount;
+		}
+		nextClient += thread->clientCount;
+	}
+	for (unsigned i = 0; i < threadCount; i++) {
+		if (pthread_create(&threads[i].id, NULL, run_thread, &threads[i]) != 0) {
+			perror("main(): Failed to start thread");
+			return 1;
+		}
+	}
+
+	Histogram *const corrected = calloc(1, sizeof(Histogram));
+	Histogram *const uncorrected = calloc(1, sizeof(Histogram));
+	if (corrected == NULL || uncorrected == NULL) {
+		perror("main(): Failed to allocate histograms");
+		return 1;
+	}
+	unsigned long long responses = 0, bytes = 0, connectErrors = 0, socketErrors = 0,
+		statusErrors = 0, reconnects = 0, unsent = 0, unanswered = 0;
+	for (unsigned i = 0; i < threadCount; i++) {
+		Thread const *const thread = &threads[i];
+		pthread_join(thread->id, NULL);
+		histogram_merge(corrected, &thread->corrected);
+		histogram_merge(uncorrected, &thread->uncorrected);
+		responses += thread->responses;
+		bytes += thread->bytes;
+		connectErrors += thread->connectErrors;
+		socketErrors += thread->socketErrors;
+		statusErrors += thread->statusErrors;
+		reconnects += thread->reconnects;
+		unsent += thread->unsent;
+		unanswered += thread->unanswered;
+		close(thread->epollFD);
+		close(thread->timerFD);
+	}
+	double const elapsed = (double) (endTime - startTime) / 1e9;
+
+	char target[INET_ADDRSTRLEN];
+	inet_ntop(AF_INET, &serverAddress.sin_addr, target, sizeof(target));
+	if (rate > 0)
+		printf("Open loop at %.0f requests/s", rate);
+	else
+		printf("Closed loop");
+	printf(", %u connections on %u thread%s, %s, pipelining %u, %.1f s against %s:%u\n",
+		connectionCount, threadCount, threadCount == 1 ? "" : "s", closeEach ? "a connection per request" : "keep-alive",
+		depth, elapsed, target, (unsigned) ntohs(serverAddress.sin_port));
+	printf("%-12s %llu, %.1f/s, %.1f MB/s\n", "responses", responses,
+		(double) responses / elapsed, (double) bytes / elapsed / 1e6);
+	printf("%-12s %llu connect, %llu socket, %llu status, %llu reconnects\n", "errors",
+		connectErrors, socketErrors, statusErrors, reconnects);
+	if (rate > 0)
+		printf("%-12s %llu unsent, %llu unanswered, counted as answered at the end\n",
+			"incomplete", unsent, unanswered);
+	printf("%-12s %9s %9s %9s %9s %9s %9s %9s\n", "latency ms", "mean", "p50", "p90", "p99",
+		"p99.9", "p99.99", "max");
+	if (rate > 0) {
+		print_latencies("corrected", corrected);
+		print_latencies("uncorrected", uncorrected);
+	} else {
+		print_latencies("measured", uncorrected);
+	}
+	return connectErrors > 0 && responses == 0;
+}
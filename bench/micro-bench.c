@@ -0,0 +1,251 @@
+// Times the pure functions on the request path one at a time, against
+// request lines and file names like the ones real clients ask for. Every
+// function's output is first checked against the expected answer for each
+// sample, so a change that makes one faster can't quietly make it wrong.
+// Also counts heap allocations, which none of them should make.
+//
+// Usage: microBench [iterations]
+
+// RTLD_NEXT
+#define _GNU_SOURCE
+
+#include "byte-scan.h"
+#include "location.h"
+#include "request-parser.h"
+
+#include <dlfcn.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_ITERATIONS 1000000
+
+typedef struct {
+	char const *input;
+	char const *expected;
+} Sample;
+
+// Header values as they come off the wire, with whatever follows them
+static Sample const trimSamples[] = {
+	{ "keep-alive\r\n", "keep-alive" },
+	{ "gzip, deflate, br, zstd \t\r\n", "gzip, deflate, br, zstd" },
+	{ "text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8",
+		"text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8" },
+	{ "Mozilla/5.0 (X11; Linux x86_64; rv:125.0) Gecko/20100101 Firefox/125.0   ",
+		"Mozilla/5.0 (X11; Linux x86_64; rv:125.0) Gecko/20100101 Firefox/125.0" },
+	{ "\"5f3c-18e4a9b2c40\"\r\n", "\"5f3c-18e4a9b2c40\"" },
+	{ " \t \r\n", "" },
+	{ "", "" },
+};
+
+// Request targets and the file each one ends up at
+static Sample const locationSamples[] = {
+	{ "/", "./index.html" },
+	{ "/index.html", ".//index.html" },
+	{ "/docs/getting-started/", ".//docs/getting-started/./index.html" },
+	{ "/assets/css/main.3f9a2c.css", ".//assets/css/main.3f9a2c.css" },
+	{ "/images/hero@2x.webp", ".//images/hero@2x.webp" },
+	{ "/api/v1/items?page=2&sort=name", ".//api/v1/items?page=2&sort=name" },
+	{ "/../../etc/passwd", ".//.//.//etc/passwd" },
+	{ "/static/..%2f..%2fsecret", ".//static/./%2f./%2fsecret" },
+	{ "/a/b/c/d/e/f/g/h/i/j/k/l/m/n/o/p/q/r/s/t/u/v/w/x/y/z/deep.txt",
+		".//a/b/c/d/e/f/g/h/i/j/k/l/m/n/o/p/q/r/s/t/u/v/w/x/y/z/deep.txt" },
+	{ "/....//...//", ".//././//././/./index.html" },
+};
+
+// Request lines and the target the parser should find in each
+static Sample const requestLineSamples[] = {
+	{ "GET / HTTP/1.1\r\n\r\n", "/" },
+	{ "GET /docs/getting-started/index.html HTTP/1.1\r\n\r\n",
+		"/docs/getting-started/index.html" },
+	{ "GET /assets/css/main.3f9a2c.css HTTP/1.1\r\n\r\n", "/assets/css/main.3f9a2c.css" },
+	{ "HEAD /images/hero@2x.webp HTTP/1.1\r\n\r\n", "/images/hero@2x.webp" },
+	{ "GET /api/v1/items?page=2&sort=name&filter=active%20only HTTP/1.1\r\n\r\n",
+		"/api/v1/items?page=2&sort=name&filter=active%20only" },
+	{ "GET /favicon.ico HTTP/1.0\r\n\r\n", "/favicon.ico" },
+	{ "GET /healthz HTTP/1.1\r\n\r\n", "/healthz" },
+};
+
+// File names and the Content-Type each one is sent with
+static Sample const mimeSamples[] = {
+	{ "./index.html", "Content-Type: text/html\r\n" },
+	{ "./assets/css/main.3f9a2c.css", "Content-Type: text/css\r\n" },
+	{ "./assets/js/app.min.js", "Content-Type: application/javascript\r\n" },
+	{ "./images/hero@2x.webp", "Content-Type: image/webp\r\n" },
+	{ "./images/LOGO.PNG", "Content-Type: image/png\r\n" },
+	{ "./fonts/inter-var.woff2", "Content-Type: font/woff2\r\n" },
+	{ "./data/export.json", "Content-Type: application/json\r\n" },
+	{ "./downloads/release.tar.gz", "Content-Type: application/gzip\r\n" },
+	{ "./README", "" },
+	{ "./notes.unknownextension", "" },
+};
+
+#define SAMPLE_COUNT(samples) (sizeof(samples) / sizeof(samples[0]))
+
+// Heap allocations made by anything in this process, counted by the
+// wrappers below, which hand the actual work to the C library's own
+static unsigned long allocations;
+
+void *malloc(size_t const size)
+{
+	static void *(*real)(size_t);
+	if (real == NULL)
+		*(void **) &real = dlsym(RTLD_NEXT, "malloc");
+	allocations++;
+	return real(size);
+}
+
+void *calloc(size_t const count, size_t const size)
+{
+	static void *(*real)(size_t, size_t);
+	// dlsym() itself may calloc() before there is a real one to call,
+	// which it copes with getting NULL from
+	if (real == NULL) {
+		static bool looking;
+		if (looking)
+			return NULL;
+		looking = true;
+		*(void **) &real = dlsym(RTLD_NEXT, "calloc");
+		looking = false;
+	}
+	allocations++;
+	return real(count, size);
+}
+
+void *realloc(void *const pointer, size_t const size)
+{
+	static void *(*real)(void *, size_t);
+	if (real == NULL)
+		*(void **) &real = dlsym(RTLD_NEXT, "realloc");
+	allocations++;
+	return real(pointer, size);
+}
+
+double seconds_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+}
+
+// The samples are run through a copy, trim_right_whitespace() changes
+// them in place. The copy is part of what gets timed.
+unsigned long run_trim(bool const check)
+{
+	unsigned long sink = 0;
+	char buffer[MAXIMUM_REQUEST_LINE_SIZE];
+	for (size_t i = 0; i < SAMPLE_COUNT(trimSamples); i++) {
+		strcpy(buffer, trimSamples[i].input);
+		trim_right_whitespace(buffer);
+		if (check && strcmp(buffer, trimSamples[i].expected) != 0) {
+			fprintf(stderr, "run_trim(): \"%s\" came out as \"%s\"\n",
+				trimSamples[i].input, buffer);
+			exit(1);
+		}
+		sink += (unsigned char) buffer[0];
+	}
+	return sink;
+}
+
+unsigned long run_location(bool const check)
+{
+	unsigned long sink = 0;
+	char location[MAXIMUM_REQUEST_LOCATION_SIZE + 1];
+	for (size_t i = 0; i < SAMPLE_COUNT(locationSamples); i++) {
+		char const *const target = locationSamples[i].input;
+		bool const built = build_location(location, target, strlen(target));
+		if (check && (!built || strcmp(location, locationSamples[i].expected) != 0)) {
+			fprintf(stderr, "run_location(): \"%s\" came out as \"%s\"\n", target,
+				built ? location : "(too long)");
+			exit(1);
+		}
+		sink += (unsigned char) location[2];
+	}
+	return sink;
+}
+
+unsigned long run_request_line(bool const check)
+{
+	unsigned long sink = 0;
+	RequestParser parser;
+	for (size_t i = 0; i < SAMPLE_COUNT(requestLineSamples); i++) {
+		char const *const line = requestLineSamples[i].input;
+		request_parser_reset(&parser);
+		ParseStatus const status = parse_request(&parser, line, strlen(line));
+		if (check && (status != REQUEST_COMPLETE
+				|| !view_equals(line, parser.target, requestLineSamples[i].expected))) {
+			fprintf(stderr, "run_request_line(): Wrong target for %s", line);
+			exit(1);
+		}
+		sink += parser.target.length;
+	}
+	return sink;
+}
+
+unsigned long run_mime(bool const check)
+{
+	unsigned long sink = 0;
+	for (size_t i = 0; i < SAMPLE_COUNT(mimeSamples); i++) {
+		char const *const type = get_mime_type(mimeSamples[i].input);
+		if (check && strcmp(type, mimeSamples[i].expected) != 0) {
+			fprintf(stderr, "run_mime(): %s got \"%s\"\n", mimeSamples[i].input, type);
+			exit(1);
+		}
+		sink += strlen(type);
+	}
+	return sink;
+}
+
+typedef struct {
+	char const *name;
+	unsigned long (*run)(bool const check);
+	size_t samples;
+} Benchmark;
+
+static Benchmark const benchmarks[] = {
+	{ "trim_right_whitespace", run_trim, SAMPLE_COUNT(trimSamples) },
+	{ "build_location", run_location, SAMPLE_COUNT(locationSamples) },
+	{ "request line", run_request_line, SAMPLE_COUNT(requestLineSamples) },
+	{ "get_mime_type", run_mime, SAMPLE_COUNT(mimeSamples) },
+};
+
+int main(int argc, char **argv)
+{
+	unsigned long iterations = DEFAULT_ITERATIONS;
+	if (argc > 1)
+		iterations = strtoul(argv[1], NULL, 10);
+	if (iterations == 0)
+		iterations = 1;
+
+	// The parser scans with whatever the server would pick on this CPU
+	byte_scan_init();
+	printf("%lu iterations over every sample, %s byte scans\n", iterations,
+		byte_scan_implementation());
+	printf("%-22s %8s %12s %12s\n", "function", "samples", "ns/op", "allocs/op");
+	for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+		Benchmark const *const benchmark = &benchmarks[i];
+		// Checks every answer and warms up
+		unsigned long const expected = benchmark->run(true);
+
+		unsigned long sink = 0;
+		unsigned long const allocationsBefore = allocations;
+		double const start = seconds_now();
+		for (unsigned long j = 0; j < iterations; j++)
+			sink += benchmark->run(false);
+		double const elapsed = seconds_now() - start;
+		unsigned long const allocated = allocations - allocationsBefore;
+		// Also keeps the compiler from throwing the work away
+		if (sink != expected * iterations) {
+			fprintf(stderr, "main(): %s gave different answers between runs\n",
+				benchmark->name);
+			return 1;
+		}
+
+		double const operations = (double) iterations * (double) benchmark->samples;
+		printf("%-22s %8zu %12.1f %12.3f\n", benchmark->name, benchmark->samples,
+			elapsed * 1e9 / operations, (double) allocated / operations);
+	}
+	return 0;
+}
@@ -0,0 +1,163 @@
+// Times the request parser on the kind of requests browsers send, once
+// with every byte scanning implementation this machine supports.
+//
+// Usage: parserBench [iterations]
+
+#include "byte-scan.h"
+#include "request-parser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_ITERATIONS 1000000
+
+static char const *const requests[] = {
+	// Chrome navigating to a page
+	"GET /docs/getting-started/index.html HTTP/1.1\r\n"
+	"Host: www.example.com\r\n"
+	"Connection: keep-alive\r\n"
+	"Cache-Control: max-age=0\r\n"
+	"sec-ch-ua: \"Chromium\";v=\"124\", \"Google Chrome\";v=\"124\", \"Not-A.Brand\";v=\"99\"\r\n"
+	"sec-ch-ua-mobile: ?0\r\n"
+	"sec-ch-ua-platform: \"Windows\"\r\n"
+	"Upgrade-Insecure-Requests: 1\r\n"
+	"User-Agent: Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 "
+		"(KHTML, like Gecko) Chrome/124.0.0.0 Safari/537.36\r\n"
+	"Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,"
+		"image/webp,image/apng,*/*;q=0.8,application/signed-exchange;v=b3;q=0.7\r\n"
+	"Sec-Fetch-Site: same-origin\r\n"
+	"Sec-Fetch-Mode: navigate\r\n"
+	"Sec-Fetch-User: ?1\r\n"
+	"Sec-Fetch-Dest: document\r\n"
+	"Referer: https://www.example.com/\r\n"
+	"Accept-Encoding: gzip, deflate, br, zstd\r\n"
+	"Accept-Language: en-GB,en-US;q=0.9,en;q=0.8\r\n"
+	"Cookie: _ga=GA1.2.1234567890.1700000000; _gid=GA1.2.987654321.1700000000; "
+		"session=eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9.eyJzdWIiOiIxMjM0NTY3ODkwIn0\r\n"
+	"If-None-Match: \"5f3c-18e4a9b2c40\"\r\n"
+	"If-Modified-Since: Tue, 12 Mar 2024 09:41:07 GMT\r\n"
+	"\r\n",
+
+	// Firefox fetching a stylesheet
+	"GET /assets/css/main.3f9a2c.css HTTP/1.1\r\n"
+	"Host: www.example.com\r\n"
+	"User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:125.0) Gecko/20100101 Firefox/125.0\r\n"
+	"Accept: text/css,*/*;q=0.1\r\n"
+	"Accept-Language: en-US,en;q=0.5\r\n"
+	"Accept-Encoding: gzip, deflate, br\r\n"
+	"Connection: keep-alive\r\n"
+	"Referer: https://www.example.com/docs/getting-started/index.html\r\n"
+	"Sec-Fetch-Dest: style\r\n"
+	"Sec-Fetch-Mode: no-cors\r\n"
+	"Sec-Fetch-Site: same-origin\r\n"
+	"\r\n",
+
+	// Safari fetching an image
+	"GET /images/hero@2x.webp HTTP/1.1\r\n"
+	"Host: www.example.com\r\n"
+	"Accept: image/webp,image/avif,image/jxl,image/heic,image/heic-sequence,"
+		"video/*;q=0.8,image/png,image/svg+xml,image/*;q=0.8,*/*;q=0.5\r\n"
+	"Sec-Fetch-Site: same-origin\r\n"
+	"Accept-Encoding: gzip, deflate, br\r\n"
+	"Sec-Fetch-Mode: no-cors\r\n"
+	"User-Agent: Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/605.1.15 "
+		"(KHTML, like Gecko) Version/17.4 Safari/605.1.15\r\n"
+	"Referer: https://www.example.com/\r\n"
+	"Sec-Fetch-Dest: image\r\n"
+	"Accept-Language: en-GB,en;q=0.9\r\n"
+	"Connection: keep-alive\r\n"
+	"\r\n",
+
+	// A health checker
+	"GET /healthz HTTP/1.1\r\n"
+	"Host: 10.0.3.17:8080\r\n"
+	"User-Agent: kube-probe/1.29\r\n"
+	"Accept: */*\r\n"
+	"Connection: close\r\n"
+	"\r\n",
+};
+
+#define REQUEST_COUNT (sizeof(requests) / sizeof(requests[0]))
+
+static char const *const implementations[] = { "scalar", "sse2", "avx2" };
+
+double seconds_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+}
+
+// Parses every sample once, returning how many headers were found so the
+// compiler can't throw the work away
+unsigned long parse_all(RequestParser *const parser, size_t const *const lengths)
+{
+	unsigned long headers = 0;
+	for (size_t i = 0; i < REQUEST_COUNT; i++) {
+		request_parser_reset(parser);
+		if (parse_request(parser, requests[i], lengths[i]) != REQUEST_COMPLETE) {
+			fprintf(stderr, "parse_all(): Sample %zu did not parse\n", i);
+			exit(1);
+		}
+		headers += parser->headerCount;
+	}
+	return headers;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long iterations = DEFAULT_ITERATIONS;
+	if (argc > 1)
+		iterations = strtoul(argv[1], NULL, 10);
+	if (iterations == 0)
+		iterations = 1;
+
+	size_t lengths[REQUEST_COUNT];
+	size_t totalBytes = 0;
+	for (size_t i = 0; i < REQUEST_COUNT; i++) {
+		lengths[i] = strlen(requests[i]);
+		totalBytes += lengths[i];
+	}
+
+	printf("%zu sample requests, %zu bytes, %lu iterations\n",
+		REQUEST_COUNT, totalBytes, iterations);
+	printf("%-8s %12s %12s %10s\n", "scanner", "ns/request", "MB/s", "speedup");
+
+	RequestParser parser;
+	double scalarTime = 0;
+	unsigned long expectedHeaders = 0;
+	for (size_t i = 0; i < sizeof(implementations) / sizeof(implementations[0]); i++) {
+		if (!byte_scan_select(implementations[i])) {
+			printf("%-8s %12s\n", implementations[i], "unsupported");
+			continue;
+		}
+
+		// Warm up and check every version agrees with the first
+		unsigned long const headers = parse_all(&parser, lengths);
+		if (expectedHeaders == 0) {
+			expectedHeaders = headers;
+		} else if (headers != expectedHeaders) {
+			fprintf(stderr, "main(): %s found %lu headers instead of %lu\n",
+				implementations[i], headers, expectedHeaders);
+			return 1;
+		}
+
+		unsigned long sink = 0;
+		double const start = seconds_now();
+		for (unsigned long j = 0; j < iterations; j++)
+			sink += parse_all(&parser, lengths);
+		double const elapsed = seconds_now() - start;
+		if (sink != headers * iterations)
+			return 1;
+
+		if (scalarTime == 0)
+			scalarTime = elapsed;
+		printf("%-8s %12.1f %12.1f %9.2fx\n", implementations[i],
+			elapsed * 1e9 / ((double) iterations * REQUEST_COUNT),
+			(double) totalBytes * (double) iterations / elapsed / 1e6,
+			scalarTime / elapsed);
+	}
+	return 0;
+}
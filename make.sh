@@ -4,9 +4,17 @@ mkdir -p ./bin
 
 WARNINGS="-Wall -Wextra -Wpedantic -Wabi"
 
-tcc src/http-server.c -o bin/httpServer
-# musl-clang $WARNINGS -march=native -static -O3 src/http-server.c -o bin/httpServer
-# gcc -g $WARNINGS src/http-server.c -o bin/httpServer
-# clang -g $WARNINGS src/http-server.c -o bin/httpServer
-# clang $WARNINGS -O3 src/http-server.c -o bin/httpServer
+tcc -pthread src/*.c -lz -o bin/httpServer
+# musl-clang $WARNINGS -march=native -static -O3 -pthread src/*.c -lz -o bin/httpServer
+# gcc -g $WARNINGS -pthread src/*.c -lz -o bin/httpServer
+# clang -g $WARNINGS -pthread src/*.c -lz -o bin/httpServer
+# clang $WARNINGS -O3 -pthread src/*.c -lz -o bin/httpServer
 
+tcc -Isrc bench/parser-bench.c src/request-parser.c src/byte-scan.c -o bin/parserBench
+# gcc $WARNINGS -O2 -Isrc bench/parser-bench.c src/request-parser.c src/byte-scan.c -o bin/parserBench
+
+tcc -Isrc bench/micro-bench.c src/location.c src/request-parser.c src/byte-scan.c -ldl -o bin/microBench
+# gcc $WARNINGS -O2 -Isrc bench/micro-bench.c src/location.c src/request-parser.c src/byte-scan.c -ldl -o bin/microBench
+
+tcc -pthread bench/load-generator.c -o bin/loadGenerator
+# gcc $WARNINGS -O2 -pthread bench/load-generator.c -o bin/loadGenerator
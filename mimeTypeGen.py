@@ -1,5 +1,9 @@
 #!/bin/env python3
 # Changed this to add or remove mime types you want or dont want
+#
+# Writes a perfect hash table of extensions to stdout, so looking one up
+# takes two hashes and one comparison. Extensions are matched ignoring
+# case, the first type listed for an extension wins.
 
 from sys import argv
 
@@ -10,20 +14,19 @@ if len(argv) < 2:
 with open(argv[1]) as infile:
 	lines = infile.readlines()
 
-finalStr = """
-#pragma once
-
-
-typedef struct {
-\tchar const *const extension;
-\tchar const *const type;
-} MimeType;
-
-
-const MimeType mimeTypes[] = {
-
-"""
+# Must match hash_lowercase() in src/hash.h
+def hash_lowercase(text, seed):
+	mask = 0xffffffff
+	h = 2166136261 ^ ((seed * 0x9e3779b9) & mask)
+	for ch in text.lower().encode():
+		h ^= ch
+		h = (h * 16777619) & mask
+	h ^= h >> 16
+	h = (h * 0x85ebca6b) & mask
+	h ^= h >> 13
+	return h
 
+types = {}
 for line in lines:
 	if len(line) == 0 or line[0] == '#':
 		continue
@@ -36,9 +39,79 @@ for line in lines:
 		continue
 
 	mimetype = words[0]
-	
+
 	for extension in words[1:]:
-		finalStr += f"\t{{\"{extension}\", \"{mimetype}\\r\\n\"}},\n"
+		# Lookups start after the last dot in a path, so these could
+		# never match
+		if '.' in extension:
+			continue
+		types.setdefault(extension.lower(), mimetype)
+
+# Hash and displace: every extension lands in a bucket, then each bucket,
+# biggest first, gets the first seed that puts all of its extensions in
+# free slots.
+bucketCount = max(1, len(types) // 4)
+slotCount = 1
+while slotCount < len(types) * 5 // 4:
+	slotCount *= 2
+
+buckets = [[] for _ in range(bucketCount)]
+for extension in types:
+	buckets[hash_lowercase(extension, 0) % bucketCount].append(extension)
+
+displacements = [0] * bucketCount
+slots = [None] * slotCount
+for bucket in sorted(range(bucketCount), key=lambda b: -len(buckets[b])):
+	if len(buckets[bucket]) == 0:
+		continue
+	seed = 1
+	while True:
+		wanted = [hash_lowercase(e, seed) & (slotCount - 1) for e in buckets[bucket]]
+		if len(set(wanted)) == len(wanted) and all(slots[s] is None for s in wanted):
+			break
+		seed += 1
+		if seed > 0xffff:
+			print(f"Could not place bucket {bucket}, try more slots")
+			exit(1)
+	displacements[bucket] = seed
+	for extension, slot in zip(buckets[bucket], wanted):
+		slots[slot] = extension
+
+finalStr = f"""#pragma once
+// Generated by mimeTypeGen.py, edit that rather than this
+
+#include <stdint.h>
+
+#define MIME_BUCKET_COUNT {bucketCount}
+#define MIME_SLOT_COUNT {slotCount}
+#define MIME_LONGEST_EXTENSION {max(len(e.encode()) for e in types)}
+
+typedef struct {{
+\tchar const *const extension;
+\t// The whole header line, ready to be copied into a response
+\tchar const *const header;
+\tuint8_t const extensionLength;
+\tuint8_t const headerLength;
+}} MimeType;
+
+// Seed for each bucket's second hash
+static uint16_t const mimeDisplacements[MIME_BUCKET_COUNT] = {{
+"""
+
+for i in range(0, bucketCount, 12):
+	finalStr += "\t" + ", ".join(str(d) for d in displacements[i:i + 12]) + ",\n"
+
+finalStr += """};
+
+static MimeType const mimeTypes[MIME_SLOT_COUNT] = {
+"""
+
+for extension in slots:
+	if extension is None:
+		finalStr += "\t{\"\", \"\", 0, 0},\n"
+		continue
+	header = f"Content-Type: {types[extension]}\r\n"
+	finalStr += f"\t{{\"{extension}\", \"{header[:-2]}\\r\\n\", {len(extension.encode())}, {len(header.encode())}}},\n"
 
 finalStr += "};"
 print(finalStr)
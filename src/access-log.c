@@ -0,0 +1,262 @@
+#include "access-log.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+// Longest line a record can turn into, with every byte of its text
+// escaped
+#define ACCESS_LOG_LINE_SIZE (128 + 4 * (ACCESS_LOG_REQUEST_LINE_SIZE + 2 * ACCESS_LOG_HEADER_SIZE))
+
+// Bumped for every reopen asked for, each log compares it with the one its
+// file was opened at
+static unsigned reopenGeneration = 0;
+
+void access_log_reopen(void)
+{
+	__atomic_add_fetch(&reopenGeneration, 1, __ATOMIC_RELAXED);
+}
+
+int open_log_file(char const *const path)
+{
+	int const fd = open(path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+	if (fd == -1) {
+		perror("open_log_file(): Could not open access log");
+		fprintf(stderr, "Access log: %s\n", path);
+	}
+	return fd;
+}
+
+// Writes all of it, every worker appends to the same file so each batch
+// has to go out in one piece to keep lines from getting mixed up
+void write_batch(AccessLog *const log, size_t const length)
+{
+	size_t written = 0;
+	while (written < length && log->fileFD != -1) {
+		ssize_t const status = write(log->fileFD, log->batch + written, length - written);
+		if (status == -1) {
+			if (errno == EINTR)
+				continue;
+			perror("write_batch(): Could not write access log");
+			return;
+		}
+		written += (size_t) status;
+	}
+}
+
+// Quoted fields get anything that could break the line up or be mistaken
+// for the end of the field escaped, like nginx does
+size_t escape_text(char *const out, char const *const text, size_t const length)
+{
+	static char const digits[] = "0123456789ABCDEF";
+	size_t position = 0;
+	for (size_t i = 0; i < length; i++) {
+		unsigned char const c = (unsigned char) text[i];
+		if (c < 0x20 || c >= 0x7f || c == '"' || c == '\\') {
+			out[position++] = '\\';
+			out[position++] = 'x';
+			out[position++] = digits[c >> 4];
+			out[position++] = digits[c & 0xf];
+		} else {
+			out[position++] = (char) c;
+		}
+	}
+	return position;
+}
+
+size_t format_record(char *const out, AccessRecord const *const record, char const *const time)
+{
+	char address[INET_ADDRSTRLEN];
+	struct in_addr const in = { record->address };
+	if (inet_ntop(AF_INET, &in, address, sizeof(address)) == NULL)
+		strcpy(address, "-");
+
+	size_t length = (size_t) sprintf(out, "%s - - [%s] \"", address, time);
+	length += escape_text(out + length, record->requestLine, record->requestLineLength);
+	length += (size_t) sprintf(out + length, "\" %u %" PRIu64 " \"", record->status,
+			record->bytes);
+	if (record->refererLength == 0)
+		out[length++] = '-';
+	length += escape_text(out + length, record->referer, record->refererLength);
+	out[length++] = '"';
+	out[length++] = ' ';
+	out[length++] = '"';
+	if (record->userAgentLength == 0)
+		out[length++] = '-';
+	length += escape_text(out + length, record->userAgent, record->userAgentLength);
+	out[length++] = '"';
+	out[length++] = '\n';
+	return length;
+}
+
+// Writes out every record in the ring
+void drain_records(AccessLog *const log)
+{
+	// Records come in time order, so the timestamp only gets formatted
+	// again once the second changes
+	time_t second = 0;
+	char time[32] = "";
+
+	size_t length = 0;
+	size_t const tail = __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE);
+	size_t head = log->head;
+	for (; head != tail; head++) {
+		AccessRecord const *const record = &log->records[head & (ACCESS_LOG_RING_RECORDS - 1)];
+		if (time[0] == '\0' || record->time != second) {
+			second = record->time;
+			struct tm parts;
+			gmtime_r(&second, &parts);
+			strftime(time, sizeof(time), "%d/%b/%Y:%H:%M:%S +0000", &parts);
+		}
+		if (length > ACCESS_LOG_BATCH_SIZE - ACCESS_LOG_LINE_SIZE) {
+			write_batch(log, length);
+			length = 0;
+		}
+		length += format_record(log->batch + length, record, time);
+		// Every record formatted makes room for another one
+		__atomic_store_n(&log->head, head + 1, __ATOMIC_RELEASE);
+	}
+	if (length > 0)
+		write_batch(log, length);
+}
+
+void *run_access_log_writer(void *const arg)
+{
+	AccessLog *const log = arg;
+	uint64_t reported = 0;
+
+	while (1) {
+		struct pollfd wake = { .fd = log->wakeFD, .events = POLLIN };
+		if (poll(&wake, 1, ACCESS_LOG_FLUSH_INTERVAL) > 0) {
+			uint64_t count;
+			if (read(log->wakeFD, &count, sizeof(count)) == -1 && errno != EAGAIN)
+				perror("run_access_log_writer(): Could not read wakeup");
+		}
+		bool const stopping = __atomic_load_n(&log->stopping, __ATOMIC_ACQUIRE);
+
+		unsigned const generation = __atomic_load_n(&reopenGeneration, __ATOMIC_RELAXED);
+		if (generation != log->generation) {
+			log->generation = generation;
+			int const fd = open_log_file(log->path);
+			// Better to keep writing to the old file than to none
+			if (fd != -1) {
+				if (log->fileFD != -1)
+					close(log->fileFD);
+				log->fileFD = fd;
+			}
+		}
+
+		drain_records(log);
+
+		uint64_t const dropped = __atomic_load_n(&log->dropped, __ATOMIC_RELAXED);
+		if (dropped != reported) {
+			fprintf(stderr, "run_access_log_writer(): Dropped %" PRIu64
+				" access log records that did not fit in the ring\n", dropped - reported);
+			reported = dropped;
+		}
+		if (stopping)
+			break;
+	}
+	return NULL;
+}
+
+AccessLog *access_log_create(char const *const path)
+{
+	AccessLog *const log = calloc(1, sizeof(AccessLog));
+	if (log == NULL) {
+		perror("access_log_create(): Failed to allocate access log");
+		return NULL;
+	}
+	log->records = malloc(ACCESS_LOG_RING_RECORDS * sizeof(AccessRecord));
+	log->batch = malloc(ACCESS_LOG_BATCH_SIZE);
+	log->path = strdup(path);
+	log->fileFD = log->wakeFD = -1;
+	if (log->records == NULL || log->batch == NULL || log->path == NULL) {
+		perror("access_log_create(): Failed to allocate buffers");
+		goto failed;
+	}
+	log->generation = __atomic_load_n(&reopenGeneration, __ATOMIC_RELAXED);
+	log->fileFD = open_log_file(path);
+	if (log->fileFD == -1)
+		goto failed;
+	log->wakeFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (log->wakeFD == -1) {
+		perror("access_log_create(): eventfd() errored");
+		goto failed;
+	}
+
+	int const error = pthread_create(&log->writer, NULL, run_access_log_writer, log);
+	if (error != 0) {
+		fprintf(stderr, "access_log_create(): pthread_create() errored: %s\n", strerror(error));
+		goto failed;
+	}
+	return log;
+
+failed:
+	if (log->wakeFD != -1)
+		close(log->wakeFD);
+	if (log->fileFD != -1)
+		close(log->fileFD);
+	free(log->path);
+	free(log->batch);
+	free(log->records);
+	free(log);
+	return NULL;
+}
+
+void wake_writer(AccessLog *const log)
+{
+	uint64_t const one = 1;
+	if (write(log->wakeFD, &one, sizeof(one)) == -1 && errno != EAGAIN)
+		perror("wake_writer(): Could not wake the access log writer");
+}
+
+void access_log_destroy(AccessLog *const log)
+{
+	__atomic_store_n(&log->stopping, true, __ATOMIC_RELEASE);
+	wake_writer(log);
+	pthread_join(log->writer, NULL);
+
+	close(log->wakeFD);
+	if (log->fileFD != -1)
+		close(log->fileFD);
+	free(log->path);
+	free(log->batch);
+	free(log->records);
+	free(log);
+}
+
+AccessRecord *access_log_reserve(AccessLog *const log)
+{
+	size_t const head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+	if (log->tail - head >= ACCESS_LOG_RING_RECORDS) {
+		__atomic_store_n(&log->dropped, log->dropped + 1, __ATOMIC_RELAXED);
+		return NULL;
+	}
+	return &log->records[log->tail & (ACCESS_LOG_RING_RECORDS - 1)];
+}
+
+void access_log_commit(AccessLog *const log)
+{
+	size_t const tail = log->tail + 1;
+	__atomic_store_n(&log->tail, tail, __ATOMIC_RELEASE);
+	// Only once per filling up, the writer comes around on its own
+	// otherwise
+	if (tail - __atomic_load_n(&log->head, __ATOMIC_RELAXED) == ACCESS_LOG_WAKE_RECORDS)
+		wake_writer(log);
+}
+
+void access_record_text(char *const field, uint16_t *const fieldLength, size_t const size,
+		char const *const text, size_t const length)
+{
+	size_t const kept = length < size ? length : size;
+	memcpy(field, text, kept);
+	*fieldLength = (uint16_t) kept;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+// Records waiting to be written, per worker. Must be a power of two.
+#define ACCESS_LOG_RING_RECORDS 1024
+// The writer gets woken early once the ring is this full, otherwise it
+// looks every ACCESS_LOG_FLUSH_INTERVAL milliseconds
+#define ACCESS_LOG_WAKE_RECORDS (ACCESS_LOG_RING_RECORDS / 2)
+#define ACCESS_LOG_FLUSH_INTERVAL 200
+// Lines are put together in a buffer this big and written with one write()
+#define ACCESS_LOG_BATCH_SIZE (64 * 1024)
+
+// Longer request lines and headers get cut off in the log
+#define ACCESS_LOG_REQUEST_LINE_SIZE 256
+#define ACCESS_LOG_HEADER_SIZE 160
+
+// One answered request, written out as a line in the combined log format.
+// Fixed size so the ring needs no allocations, the text is only escaped
+// when the writer gets to it.
+typedef struct AccessRecord {
+	time_t time;
+	// IPv4 address of the client, in network byte order
+	uint32_t address;
+	unsigned status;
+	// Of the body that actually went out, which is what the format calls
+	// for. Less than its length if the connection was lost halfway.
+	uint64_t bytes;
+	uint16_t requestLineLength;
+	uint16_t refererLength;
+	uint16_t userAgentLength;
+	char requestLine[ACCESS_LOG_REQUEST_LINE_SIZE];
+	// Empty when the request did not have one
+	char referer[ACCESS_LOG_HEADER_SIZE];
+	char userAgent[ACCESS_LOG_HEADER_SIZE];
+} AccessRecord;
+
+// Access log of a single worker. The worker's event loop is the only
+// producer and a thread of the log's own the only consumer of the ring,
+// so neither side takes a lock and the loop never waits on the disk. When
+// the ring is full records get dropped and counted instead.
+typedef struct {
+	AccessRecord *records;
+	// Only ever written by the event loop
+	size_t tail __attribute__((aligned(64)));
+	uint64_t dropped;
+	// Only ever written by the writer thread
+	size_t head __attribute__((aligned(64)));
+
+	char *path;
+	int fileFD;
+	// eventfd the writer waits on
+	int wakeFD;
+	unsigned generation;
+	bool stopping;
+	pthread_t writer;
+	char *batch;
+} AccessLog;
+
+// Opens the file at path for appending and starts the writer. Returns NULL
+// if either fails.
+AccessLog *access_log_create(char const *const path);
+// Writes out whatever is left in the ring and closes the file
+void access_log_destroy(AccessLog *const log);
+
+// The next free record, which goes to the writer with
+// access_log_commit(). NULL when the ring is full, which counts the
+// record as dropped.
+AccessRecord *access_log_reserve(AccessLog *const log);
+void access_log_commit(AccessLog *const log);
+
+// Copies length bytes of text into a record field of size bytes, cutting
+// it off if it does not fit
+void access_record_text(char *const field, uint16_t *const fieldLength, size_t const size,
+		char const *const text, size_t const length);
+
+// Makes every access log in the process close and reopen its file, so it
+// can be rotated with a rename. Safe to call from a signal handler.
+void access_log_reopen(void);
@@ -0,0 +1,123 @@
+#include "arena.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Every allocation starts at a multiple of this, what malloc() guarantees
+#define ARENA_ALIGNMENT 16
+// Room at the start of each slab for the link to the one before it
+#define ARENA_SLAB_HEADER_SIZE ARENA_ALIGNMENT
+
+void arena_init(Arena *const arena, SlabPool *const pool)
+{
+	arena->pool = pool;
+	arena->slab = NULL;
+	arena->used = ARENA_SLAB_HEADER_SIZE;
+}
+
+// Takes a slab off the pool's free list, or a fresh one when it is empty
+char *take_slab(SlabPool *const pool)
+{
+	if (pool->freeSlabs != NULL) {
+		char *const slab = pool->freeSlabs;
+		pool->freeSlabs = *(void **) slab;
+		pool->freeCount--;
+		return slab;
+	}
+	char *const slab = malloc(ARENA_SLAB_SIZE);
+	if (slab == NULL)
+		perror("take_slab(): Failed to allocate slab");
+	return slab;
+}
+
+// Gives a slab back to the pool, or to malloc() when the pool is full
+void return_slab(SlabPool *const pool, char *const slab)
+{
+	if (pool->freeCount == SLAB_POOL_MAXIMUM_SLABS) {
+		free(slab);
+		return;
+	}
+	*(void **) slab = pool->freeSlabs;
+	pool->freeSlabs = slab;
+	pool->freeCount++;
+}
+
+void *arena_allocate(Arena *const arena, size_t const size)
+{
+	if (size > ARENA_SLAB_SIZE - ARENA_SLAB_HEADER_SIZE) {
+		fprintf(stderr, "arena_allocate(): %zu bytes do not fit in a slab\n", size);
+		return NULL;
+	}
+	size_t start = (arena->used + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+	if (arena->slab == NULL || start > ARENA_SLAB_SIZE || size > ARENA_SLAB_SIZE - start) {
+		char *const slab = take_slab(arena->pool);
+		if (slab == NULL)
+			return NULL;
+		*(char **) slab = arena->slab;
+		arena->slab = slab;
+		start = ARENA_SLAB_HEADER_SIZE;
+	}
+	arena->used = start + size;
+	return arena->slab + start;
+}
+
+char *arena_vformat(Arena *const arena, size_t *const length, char const *const format,
+		va_list arguments)
+{
+	va_list copy;
+	va_copy(copy, arguments);
+	int const needed = vsnprintf(NULL, 0, format, copy);
+	va_end(copy);
+	if (needed < 0)
+		return NULL;
+	char *const out = arena_allocate(arena, (size_t) needed + 1);
+	if (out == NULL)
+		return NULL;
+	vsnprintf(out, (size_t) needed + 1, format, arguments);
+	*length = (size_t) needed;
+	return out;
+}
+
+char *arena_format(Arena *const arena, size_t *const length, char const *const format, ...)
+{
+	va_list arguments;
+	va_start(arguments, format);
+	char *const text = arena_vformat(arena, length, format, arguments);
+	va_end(arguments);
+	return text;
+}
+
+void arena_reset(Arena *const arena)
+{
+	arena->used = ARENA_SLAB_HEADER_SIZE;
+	if (arena->slab == NULL)
+		return;
+	// Only the first slab is kept, the others were for a busy moment
+	char *previous;
+	while ((previous = *(char **) arena->slab) != NULL) {
+		return_slab(arena->pool, arena->slab);
+		arena->slab = previous;
+	}
+}
+
+void arena_release(Arena *const arena)
+{
+	while (arena->slab != NULL) {
+		char *const previous = *(char **) arena->slab;
+		return_slab(arena->pool, arena->slab);
+		arena->slab = previous;
+	}
+	arena->used = ARENA_SLAB_HEADER_SIZE;
+}
+
+void slab_pool_empty(SlabPool *const pool)
+{
+	while (pool->freeSlabs != NULL) {
+		void *const slab = pool->freeSlabs;
+		pool->freeSlabs = *(void **) slab;
+		free(slab);
+	}
+	pool->freeCount = 0;
+}
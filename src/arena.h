@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+
+// Size of the slabs arenas allocate from, enough for a -f read chunk
+// buffer with room left for the text of the pipelined responses. An
+// arena that runs out chains another one on.
+#define ARENA_SLAB_SIZE (80 * 1024)
+
+// Most unused slabs a worker holds on to for its next connections, the
+// rest go back to malloc
+#define SLAB_POOL_MAXIMUM_SLABS 64
+
+// Slabs that are not in use by any arena, linked through their first bytes.
+// Belongs to a single worker and is not thread safe.
+typedef struct {
+	void *freeSlabs;
+	unsigned freeCount;
+} SlabPool;
+
+// Bump allocator for the memory of a connection's requests. Everything
+// in it is let go of at once by rewinding it, and the slabs go back to
+// the pool while the connection waits for its next request, so idle
+// connections hold none.
+typedef struct {
+	SlabPool *pool;
+	// The slab being allocated from, NULL until something is allocated.
+	// Each slab starts with a pointer to the one filled before it.
+	char *slab;
+	size_t used;
+} Arena;
+
+void arena_init(Arena *const arena, SlabPool *const pool);
+
+// Returns size bytes aligned for any type, or NULL if they are more than
+// a slab holds or there is no slab to be had
+void *arena_allocate(Arena *const arena, size_t const size);
+
+// printf() into the arena, returning the text and setting *length, or NULL
+// if it does not fit
+char *arena_vformat(Arena *const arena, size_t *const length, char const *const format,
+		va_list arguments);
+char *arena_format(Arena *const arena, size_t *const length, char const *const format, ...)
+	__attribute__((format(printf, 3, 4)));
+
+// Frees everything allocated so far but keeps the first slab
+void arena_reset(Arena *const arena);
+// Frees everything and hands the slabs back to the pool
+void arena_release(Arena *const arena);
+
+// Frees the unused slabs, when the worker is done
+void slab_pool_empty(SlabPool *const pool);
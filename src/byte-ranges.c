@@ -0,0 +1,89 @@
+#include "byte-ranges.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <strings.h>
+
+// Reads the digits at *position, returning false if there are none or
+// they do not fit in an off_t
+bool parse_offset(char const *const value, size_t const length, size_t *const position,
+		off_t *const result)
+{
+	size_t i = *position;
+	uint64_t number = 0;
+	while (i < length && value[i] >= '0' && value[i] <= '9') {
+		uint64_t const digit = (uint64_t) (value[i] - '0');
+		// Checked before multiplying, afterwards it may have wrapped
+		if (number > ((uint64_t) INT64_MAX - digit) / 10)
+			return false;
+		number = number * 10 + digit;
+		i++;
+	}
+	if (i == *position)
+		return false;
+	*position = i;
+	*result = (off_t) number;
+	return true;
+}
+
+RangeStatus parse_byte_ranges(char const *const value, size_t const length, off_t const size,
+		ByteRange *const ranges, unsigned *const count)
+{
+	*count = 0;
+	if (length < 6 || strncasecmp(value, "bytes=", 6) != 0)
+		return RANGES_IGNORED;
+
+	bool anyRange = false;
+	size_t i = 6;
+	while (i < length) {
+		while (i < length && (value[i] == ' ' || value[i] == '\t' || value[i] == ','))
+			i++;
+		if (i == length)
+			break;
+
+		ByteRange range;
+		if (value[i] == '-') {
+			// The last n bytes
+			i++;
+			off_t suffix;
+			if (!parse_offset(value, length, &i, &suffix))
+				return RANGES_IGNORED;
+			if (suffix == 0 || size == 0)
+				range.first = size;
+			else
+				range.first = suffix >= size ? 0 : size - suffix;
+			range.last = size - 1;
+		} else {
+			if (!parse_offset(value, length, &i, &range.first)
+					|| i == length || value[i] != '-')
+				return RANGES_IGNORED;
+			i++;
+			range.last = size - 1;
+			if (i < length && value[i] >= '0' && value[i] <= '9') {
+				if (!parse_offset(value, length, &i, &range.last))
+					return RANGES_IGNORED;
+				if (range.last < range.first)
+					return RANGES_IGNORED;
+				if (range.last >= size)
+					range.last = size - 1;
+			}
+		}
+
+		while (i < length && (value[i] == ' ' || value[i] == '\t'))
+			i++;
+		if (i < length && value[i] != ',')
+			return RANGES_IGNORED;
+
+		anyRange = true;
+		if (range.first >= size)
+			continue;
+		if (*count == MAXIMUM_RANGES)
+			return RANGES_IGNORED;
+		ranges[(*count)++] = range;
+	}
+
+	// A header without any ranges at all is as malformed as it gets
+	if (!anyRange)
+		return RANGES_IGNORED;
+	return *count > 0 ? RANGES_SATISFIABLE : RANGES_UNSATISFIABLE;
+}
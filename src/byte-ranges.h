@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+#include <sys/types.h>
+
+// Most ranges answered in one multipart/byteranges response, requests
+// asking for more get the whole file instead
+#define MAXIMUM_RANGES 4
+
+// Both ends are included, like in the Range header itself
+typedef struct {
+	off_t first;
+	off_t last;
+} ByteRange;
+
+typedef enum {
+	// Malformed, in a unit other than bytes or asking for too many ranges.
+	// The header is ignored and the whole file is sent.
+	RANGES_IGNORED,
+	RANGES_SATISFIABLE,
+	// Every range starts past the end of the file, answered with 416
+	RANGES_UNSATISFIABLE,
+} RangeStatus;
+
+// Parses the value of a Range header against a file of size bytes. Ranges
+// past the end of the file are left out and the rest are clamped to it,
+// in the order they were asked for.
+RangeStatus parse_byte_ranges(char const *const value, size_t const length, off_t const size,
+		ByteRange *const ranges, unsigned *const count);
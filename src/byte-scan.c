@@ -0,0 +1,216 @@
+#include "byte-scan.h"
+
+#include <string.h>
+
+// Vector versions need GCC or clang for the intrinsics and target
+// attributes, anything else (tcc) only gets the scalar ones.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__TINYC__)
+#define BYTE_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+bool is_token_character(unsigned char const ch)
+{
+	if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9'))
+		return true;
+	return ch != '\0' && strchr("!#$%&'*+-.^_`|~", ch) != NULL;
+}
+
+size_t scan_token_scalar(char const *const data, size_t const length)
+{
+	size_t i = 0;
+	while (i < length && is_token_character((unsigned char) data[i]))
+		i++;
+	return i;
+}
+
+size_t scan_visible_scalar(char const *const data, size_t const length)
+{
+	size_t i = 0;
+	while (i < length && data[i] > ' ' && data[i] < 0x7f)
+		i++;
+	return i;
+}
+
+size_t scan_field_value_scalar(char const *const data, size_t const length)
+{
+	size_t i = 0;
+	for (; i < length; i++) {
+		unsigned char const ch = (unsigned char) data[i];
+		if ((ch < ' ' && ch != '\t') || ch == 0x7f)
+			break;
+	}
+	return i;
+}
+
+#ifdef BYTE_SCAN_X86
+
+// Every class is checked with signed byte compares. Bytes from 0x80 up are
+// negative that way, so they fall outside any of the ASCII ranges.
+
+#define SSE2_RANGE(x, low, high) _mm_and_si128( \
+	_mm_cmpgt_epi8((x), _mm_set1_epi8((char) ((low) - 1))), \
+	_mm_cmplt_epi8((x), _mm_set1_epi8((char) ((high) + 1))))
+#define SSE2_EQUAL(x, ch) _mm_cmpeq_epi8((x), _mm_set1_epi8((char) (ch)))
+
+static inline __m128i token_bytes_sse2(__m128i const x)
+{
+	// Visible ASCII except the separators "(),/:;<=>?@[\]{}
+	__m128i separators = SSE2_RANGE(x, 0x3a, 0x40);
+	separators = _mm_or_si128(separators, SSE2_RANGE(x, 0x5b, 0x5d));
+	separators = _mm_or_si128(separators, SSE2_RANGE(x, 0x28, 0x29));
+	separators = _mm_or_si128(separators, SSE2_EQUAL(x, '"'));
+	separators = _mm_or_si128(separators, SSE2_EQUAL(x, ','));
+	separators = _mm_or_si128(separators, SSE2_EQUAL(x, '/'));
+	separators = _mm_or_si128(separators, SSE2_EQUAL(x, '{'));
+	separators = _mm_or_si128(separators, SSE2_EQUAL(x, '}'));
+	return _mm_andnot_si128(separators, SSE2_RANGE(x, 0x21, 0x7e));
+}
+
+static inline __m128i visible_bytes_sse2(__m128i const x)
+{
+	return SSE2_RANGE(x, 0x21, 0x7e);
+}
+
+static inline __m128i field_value_bytes_sse2(__m128i const x)
+{
+	__m128i const printable = _mm_andnot_si128(SSE2_EQUAL(x, 0x7f),
+			_mm_cmpgt_epi8(x, _mm_set1_epi8(0x1f)));
+	__m128i const high = _mm_cmplt_epi8(x, _mm_setzero_si128());
+	return _mm_or_si128(_mm_or_si128(printable, high), SSE2_EQUAL(x, '\t'));
+}
+
+// Looks at 16 bytes at a time until one is outside the class, the scalar
+// version takes care of whatever is left at the end.
+#define SSE2_SCAN(name, classify) \
+	size_t name##_sse2(char const *const data, size_t const length) \
+	{ \
+		size_t i = 0; \
+		for (; i + 16 <= length; i += 16) { \
+			__m128i const x = _mm_loadu_si128((__m128i const *) (data + i)); \
+			unsigned const outside = ~(unsigned) _mm_movemask_epi8(classify(x)) & 0xffff; \
+			if (outside != 0) \
+				return i + (size_t) __builtin_ctz(outside); \
+		} \
+		return i + name##_scalar(data + i, length - i); \
+	}
+
+SSE2_SCAN(scan_token, token_bytes_sse2)
+SSE2_SCAN(scan_visible, visible_bytes_sse2)
+SSE2_SCAN(scan_field_value, field_value_bytes_sse2)
+
+#define AVX2_RANGE(x, low, high) _mm256_and_si256( \
+	_mm256_cmpgt_epi8((x), _mm256_set1_epi8((char) ((low) - 1))), \
+	_mm256_cmpgt_epi8(_mm256_set1_epi8((char) ((high) + 1)), (x)))
+#define AVX2_EQUAL(x, ch) _mm256_cmpeq_epi8((x), _mm256_set1_epi8((char) (ch)))
+
+__attribute__((target("avx2")))
+static inline __m256i token_bytes_avx2(__m256i const x)
+{
+	__m256i separators = AVX2_RANGE(x, 0x3a, 0x40);
+	separators = _mm256_or_si256(separators, AVX2_RANGE(x, 0x5b, 0x5d));
+	separators = _mm256_or_si256(separators, AVX2_RANGE(x, 0x28, 0x29));
+	separators = _mm256_or_si256(separators, AVX2_EQUAL(x, '"'));
+	separators = _mm256_or_si256(separators, AVX2_EQUAL(x, ','));
+	separators = _mm256_or_si256(separators, AVX2_EQUAL(x, '/'));
+	separators = _mm256_or_si256(separators, AVX2_EQUAL(x, '{'));
+	separators = _mm256_or_si256(separators, AVX2_EQUAL(x, '}'));
+	return _mm256_andnot_si256(separators, AVX2_RANGE(x, 0x21, 0x7e));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i visible_bytes_avx2(__m256i const x)
+{
+	return AVX2_RANGE(x, 0x21, 0x7e);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i field_value_bytes_avx2(__m256i const x)
+{
+	__m256i const printable = _mm256_andnot_si256(AVX2_EQUAL(x, 0x7f),
+			_mm256_cmpgt_epi8(x, _mm256_set1_epi8(0x1f)));
+	__m256i const high = _mm256_cmpgt_epi8(_mm256_setzero_si256(), x);
+	return _mm256_or_si256(_mm256_or_si256(printable, high), AVX2_EQUAL(x, '\t'));
+}
+
+// Same as SSE2_SCAN with 32 bytes at a time and one more 16 byte step for
+// what is left. The upper halves of the registers get cleared before the
+// scalar tail, running plain SSE code with them dirty stalls on every
+// instruction on some CPUs.
+#define AVX2_SCAN(name, classify, classify16) \
+	__attribute__((target("avx2"))) \
+	size_t name##_avx2(char const *const data, size_t const length) \
+	{ \
+		size_t i = 0; \
+		for (; i + 32 <= length; i += 32) { \
+			__m256i const x = _mm256_loadu_si256((__m256i const *) (data + i)); \
+			unsigned const outside = ~(unsigned) _mm256_movemask_epi8(classify(x)); \
+			if (outside != 0) \
+				return i + (size_t) __builtin_ctz(outside); \
+		} \
+		if (i + 16 <= length) { \
+			__m128i const x = _mm_loadu_si128((__m128i const *) (data + i)); \
+			unsigned const outside = ~(unsigned) _mm_movemask_epi8(classify16(x)) & 0xffff; \
+			if (outside != 0) \
+				return i + (size_t) __builtin_ctz(outside); \
+			i += 16; \
+		} \
+		_mm256_zeroupper(); \
+		return i + name##_scalar(data + i, length - i); \
+	}
+
+AVX2_SCAN(scan_token, token_bytes_avx2, token_bytes_sse2)
+AVX2_SCAN(scan_visible, visible_bytes_avx2, visible_bytes_sse2)
+AVX2_SCAN(scan_field_value, field_value_bytes_avx2, field_value_bytes_sse2)
+
+#endif
+
+size_t (*scan_token)(char const *const data, size_t const length) = scan_token_scalar;
+size_t (*scan_visible)(char const *const data, size_t const length) = scan_visible_scalar;
+size_t (*scan_field_value)(char const *const data, size_t const length) =
+	scan_field_value_scalar;
+
+static char const *implementation = "scalar";
+
+bool byte_scan_select(char const *const name)
+{
+	if (strcmp(name, "scalar") == 0) {
+		scan_token = scan_token_scalar;
+		scan_visible = scan_visible_scalar;
+		scan_field_value = scan_field_value_scalar;
+		implementation = "scalar";
+		return true;
+	}
+#ifdef BYTE_SCAN_X86
+	// SSE2 is part of x86-64 itself
+	if (strcmp(name, "sse2") == 0) {
+		scan_token = scan_token_sse2;
+		scan_visible = scan_visible_sse2;
+		scan_field_value = scan_field_value_sse2;
+		implementation = "sse2";
+		return true;
+	}
+	if (strcmp(name, "avx2") == 0 && __builtin_cpu_supports("avx2")) {
+		scan_token = scan_token_avx2;
+		scan_visible = scan_visible_avx2;
+		scan_field_value = scan_field_value_avx2;
+		implementation = "avx2";
+		return true;
+	}
+#endif
+	return false;
+}
+
+void byte_scan_init(void)
+{
+#ifdef BYTE_SCAN_X86
+	__builtin_cpu_init();
+#endif
+	if (!byte_scan_select("avx2") && !byte_scan_select("sse2"))
+		byte_scan_select("scalar");
+}
+
+char const *byte_scan_implementation(void)
+{
+	return implementation;
+}
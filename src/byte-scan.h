@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Character class scans used by the request parser. Each returns how many
+// bytes at the start of data belong to the class, so the first byte that
+// does not is at the returned index, or length if they all do.
+//
+// They point at the fastest version the CPU supports once
+// byte_scan_init() has run, and at plain C versions before that.
+
+// RFC-9110 tchar, what methods and header names are made of
+extern size_t (*scan_token)(char const *const data, size_t const length);
+// Visible ASCII, what a request target is made of
+extern size_t (*scan_visible)(char const *const data, size_t const length);
+// Anything but control characters other than tab, what header values are
+// made of
+extern size_t (*scan_field_value)(char const *const data, size_t const length);
+
+// Picks the versions to use for this CPU
+void byte_scan_init(void);
+
+// Switches to the versions called name ("scalar", "sse2" or "avx2").
+// Returns false if this build or CPU does not have them.
+bool byte_scan_select(char const *const name);
+
+// Name of the versions in use
+char const *byte_scan_implementation(void);
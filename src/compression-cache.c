@@ -0,0 +1,419 @@
+#include "compression-cache.h"
+#include "hash.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+// Starting size of the hash table, doubled whenever it gets full
+#define COMPRESSION_CACHE_INITIAL_BUCKETS 256
+
+// zlib's middle ground, the result is kept so a slower level would pay off
+// too but this is plenty for text
+#define COMPRESSION_LEVEL 6
+// deflate is the zlib format, gzip wraps the same stream in its own
+// header and trailer which zlib adds when 16 is added to the window bits
+#define DEFLATE_WINDOW_BITS 15
+#define GZIP_WINDOW_BITS (15 + 16)
+#define COMPRESSION_MEMORY_LEVEL 8
+
+// A variant has to be at least this much smaller than the file to be
+// worth sending instead
+#define MINIMUM_SAVING_PERCENT 10
+
+// Files waiting for a compression thread. Requests past that are just
+// sent uncompressed rather than queued.
+#define MAXIMUM_PENDING_COMPRESSIONS 64
+
+// Reads the file the job is for and compresses it, leaving job->data NULL
+// if the file changed or the result is not worth keeping. Runs on the
+// compression threads.
+void compress_job(CompressionJob *const job)
+{
+	int const fileFD = open(job->path, O_RDONLY | O_CLOEXEC);
+	if (fileFD == -1)
+		return;
+	struct stat st;
+	if (fstat(fileFD, &st) == -1 || st.st_size != job->sourceSize
+			|| st.st_mtim.tv_sec != job->sourceModified.tv_sec
+			|| st.st_mtim.tv_nsec != job->sourceModified.tv_nsec) {
+		close(fileFD);
+		return;
+	}
+
+	size_t const size = (size_t) st.st_size;
+	char *const source = malloc(size);
+	if (source == NULL) {
+		perror("compress_job(): Failed to allocate file data");
+		close(fileFD);
+		return;
+	}
+	size_t done = 0;
+	while (done < size) {
+		ssize_t const status = pread(fileFD, source + done, size - done, (off_t) done);
+		if (status == -1 && errno == EINTR)
+			continue;
+		if (status <= 0)
+			break;
+		done += (size_t) status;
+	}
+	close(fileFD);
+	if (done < size) {
+		free(source);
+		return;
+	}
+
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	int const windowBits = job->encoding == ENCODING_GZIP ? GZIP_WINDOW_BITS : DEFLATE_WINDOW_BITS;
+	if (deflateInit2(&stream, COMPRESSION_LEVEL, Z_DEFLATED, windowBits,
+			COMPRESSION_MEMORY_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+		fprintf(stderr, "compress_job(): deflateInit2() failed\n");
+		free(source);
+		return;
+	}
+	size_t const bound = deflateBound(&stream, (uLong) size);
+	char *const out = malloc(bound);
+	if (out == NULL) {
+		perror("compress_job(): Failed to allocate compressed data");
+		deflateEnd(&stream);
+		free(source);
+		return;
+	}
+	stream.next_in = (Bytef *) source;
+	stream.avail_in = (uInt) size;
+	stream.next_out = (Bytef *) out;
+	stream.avail_out = (uInt) bound;
+	int const status = deflate(&stream, Z_FINISH);
+	size_t const compressedSize = stream.total_out;
+	deflateEnd(&stream);
+	free(source);
+
+	if (status != Z_STREAM_END || compressedSize > size - size / 100 * MINIMUM_SAVING_PERCENT) {
+		free(out);
+		return;
+	}
+	// Giving back the slack is only an optimisation
+	char *const shrunk = realloc(out, compressedSize);
+	job->data = shrunk != NULL ? shrunk : out;
+	job->size = compressedSize;
+}
+
+void *run_compression_thread(void *const arg)
+{
+	CompressionCache *const cache = arg;
+
+	pthread_mutex_lock(&cache->lock);
+	while (1) {
+		while (cache->queueHead == NULL && !cache->stopping)
+			pthread_cond_wait(&cache->wake, &cache->lock);
+		if (cache->stopping)
+			break;
+		CompressionJob *const job = cache->queueHead;
+		cache->queueHead = job->next;
+		if (cache->queueHead == NULL)
+			cache->queueTail = NULL;
+		pthread_mutex_unlock(&cache->lock);
+
+		compress_job(job);
+
+		pthread_mutex_lock(&cache->lock);
+		job->next = cache->finished;
+		__atomic_store_n(&cache->finished, job, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&cache->lock);
+	return NULL;
+}
+
+void free_jobs(CompressionJob *job)
+{
+	while (job != NULL) {
+		CompressionJob *const next = job->next;
+		free(job->data);
+		free(job->path);
+		free(job);
+		job = next;
+	}
+}
+
+CompressionCache *compression_cache_create(size_t const budget, unsigned const threadCount)
+{
+	CompressionCache *const cache = calloc(1, sizeof(CompressionCache));
+	if (cache == NULL) {
+		perror("compression_cache_create(): Failed to allocate cache");
+		return NULL;
+	}
+	cache->buckets = calloc(COMPRESSION_CACHE_INITIAL_BUCKETS, sizeof(CompressedVariant *));
+	cache->threads = calloc(threadCount, sizeof(pthread_t));
+	if (cache->buckets == NULL || cache->threads == NULL) {
+		perror("compression_cache_create(): Failed to allocate tables");
+		free(cache->buckets);
+		free(cache->threads);
+		free(cache);
+		return NULL;
+	}
+	cache->bucketCount = COMPRESSION_CACHE_INITIAL_BUCKETS;
+	cache->budget = budget;
+	pthread_mutex_init(&cache->lock, NULL);
+	pthread_cond_init(&cache->wake, NULL);
+
+	for (unsigned i = 0; i < threadCount; i++) {
+		int const error = pthread_create(&cache->threads[i], NULL, run_compression_thread, cache);
+		if (error != 0) {
+			fprintf(stderr, "compression_cache_create(): pthread_create() errored: %s\n",
+				strerror(error));
+			break;
+		}
+		cache->threadCount++;
+	}
+	if (cache->threadCount == 0) {
+		compression_cache_destroy(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+void free_variant(CompressedVariant *const variant)
+{
+	free(variant->data);
+	free(variant->header);
+	free(variant->path);
+	free(variant);
+}
+
+void unlink_variant_recency(CompressionCache *const cache, CompressedVariant *const variant)
+{
+	if (variant->newer != NULL)
+		variant->newer->older = variant->older;
+	else
+		cache->newest = variant->older;
+	if (variant->older != NULL)
+		variant->older->newer = variant->newer;
+	else
+		cache->oldest = variant->newer;
+	variant->newer = variant->older = NULL;
+}
+
+void mark_variant_newest(CompressionCache *const cache, CompressedVariant *const variant)
+{
+	variant->older = cache->newest;
+	variant->newer = NULL;
+	if (cache->newest != NULL)
+		cache->newest->newer = variant;
+	cache->newest = variant;
+	if (cache->oldest == NULL)
+		cache->oldest = variant;
+}
+
+// Takes an entry out of the cache. The data itself stays around until the
+// last response using it lets go.
+void evict_variant(CompressionCache *const cache, CompressedVariant *const variant)
+{
+	CompressedVariant **link = &cache->buckets[variant->hash & (cache->bucketCount - 1)];
+	while (*link != variant)
+		link = &(*link)->nextInBucket;
+	*link = variant->nextInBucket;
+
+	unlink_variant_recency(cache, variant);
+	cache->entryCount--;
+	cache->bytes -= variant->bytes;
+	variant->stale = true;
+	if (variant->references == 0)
+		free_variant(variant);
+}
+
+void compression_cache_destroy(CompressionCache *const cache)
+{
+	pthread_mutex_lock(&cache->lock);
+	cache->stopping = true;
+	pthread_cond_broadcast(&cache->wake);
+	pthread_mutex_unlock(&cache->lock);
+	for (unsigned i = 0; i < cache->threadCount; i++)
+		pthread_join(cache->threads[i], NULL);
+
+	free_jobs(cache->queueHead);
+	free_jobs(cache->finished);
+	while (cache->newest != NULL)
+		evict_variant(cache, cache->newest);
+	pthread_cond_destroy(&cache->wake);
+	pthread_mutex_destroy(&cache->lock);
+	free(cache->threads);
+	free(cache->buckets);
+	free(cache);
+}
+
+void grow_variant_buckets(CompressionCache *const cache)
+{
+	size_t const newCount = cache->bucketCount * 2;
+	CompressedVariant **const buckets = calloc(newCount, sizeof(CompressedVariant *));
+	// Long chains are slower but still correct, so just carry on
+	if (buckets == NULL)
+		return;
+
+	for (size_t i = 0; i < cache->bucketCount; i++) {
+		CompressedVariant *variant = cache->buckets[i];
+		while (variant != NULL) {
+			CompressedVariant *const next = variant->nextInBucket;
+			size_t const bucket = variant->hash & (newCount - 1);
+			variant->nextInBucket = buckets[bucket];
+			buckets[bucket] = variant;
+			variant = next;
+		}
+	}
+	free(cache->buckets);
+	cache->buckets = buckets;
+	cache->bucketCount = newCount;
+}
+
+size_t variant_hash(char const *const path, ContentEncoding const encoding)
+{
+	return hash_path(path) * 31 + (size_t) encoding;
+}
+
+CompressedVariant *find_variant(CompressionCache const *const cache, char const *const path,
+		ContentEncoding const encoding, size_t const hash)
+{
+	CompressedVariant *variant = cache->buckets[hash & (cache->bucketCount - 1)];
+	while (variant != NULL && (variant->hash != hash || variant->encoding != encoding
+			|| strcmp(variant->path, path) != 0))
+		variant = variant->nextInBucket;
+	return variant;
+}
+
+void evict_over_budget(CompressionCache *const cache)
+{
+	while (cache->bytes > cache->budget && cache->oldest != NULL)
+		evict_variant(cache, cache->oldest);
+}
+
+// Moves what the threads have finished into the entries waiting for it
+void collect_finished(CompressionCache *const cache)
+{
+	if (__atomic_load_n(&cache->finished, __ATOMIC_ACQUIRE) == NULL)
+		return;
+	pthread_mutex_lock(&cache->lock);
+	CompressionJob *job = cache->finished;
+	cache->finished = NULL;
+	pthread_mutex_unlock(&cache->lock);
+
+	while (job != NULL) {
+		CompressionJob *const next = job->next;
+		cache->pendingCount--;
+
+		// Evicted or replaced by a newer version while it was being
+		// compressed means there is nothing to fill in any more
+		CompressedVariant *const variant = find_variant(cache, job->path, job->encoding,
+				variant_hash(job->path, job->encoding));
+		if (variant != NULL && variant->state == VARIANT_PENDING
+				&& variant->sourceSize == job->sourceSize
+				&& variant->sourceModified.tv_sec == job->sourceModified.tv_sec
+				&& variant->sourceModified.tv_nsec == job->sourceModified.tv_nsec) {
+			// Something bigger than the whole budget would only push
+			// everything out to then go itself
+			if (job->data != NULL && variant->bytes + job->size <= cache->budget) {
+				variant->state = VARIANT_READY;
+				variant->data = job->data;
+				variant->size = job->size;
+				variant->bytes += job->size;
+				cache->bytes += job->size;
+				job->data = NULL;
+			} else {
+				variant->state = VARIANT_USELESS;
+			}
+		}
+		job->next = NULL;
+		free_jobs(job);
+		job = next;
+	}
+	evict_over_budget(cache);
+}
+
+// Adds a pending entry for the file and hands it to the threads
+void queue_compression(CompressionCache *const cache, char const *const path,
+		ContentEncoding const encoding, size_t const hash, off_t const size,
+		struct timespec const modified)
+{
+	CompressedVariant *const variant = calloc(1, sizeof(CompressedVariant));
+	CompressionJob *const job = calloc(1, sizeof(CompressionJob));
+	char *const variantPath = strdup(path);
+	char *const jobPath = strdup(path);
+	if (variant == NULL || job == NULL || variantPath == NULL || jobPath == NULL) {
+		perror("queue_compression(): Failed to allocate entry");
+		free(variant);
+		free(job);
+		free(variantPath);
+		free(jobPath);
+		return;
+	}
+
+	variant->path = variantPath;
+	variant->hash = hash;
+	variant->encoding = encoding;
+	variant->sourceSize = size;
+	variant->sourceModified = modified;
+	variant->state = VARIANT_PENDING;
+	variant->bytes = sizeof(CompressedVariant) + strlen(path) + 1;
+	if (cache->entryCount >= cache->bucketCount)
+		grow_variant_buckets(cache);
+	size_t const bucket = hash & (cache->bucketCount - 1);
+	variant->nextInBucket = cache->buckets[bucket];
+	cache->buckets[bucket] = variant;
+	cache->entryCount++;
+	cache->bytes += variant->bytes;
+	mark_variant_newest(cache, variant);
+
+	job->path = jobPath;
+	job->encoding = encoding;
+	job->sourceSize = size;
+	job->sourceModified = modified;
+	cache->pendingCount++;
+	pthread_mutex_lock(&cache->lock);
+	if (cache->queueTail != NULL)
+		cache->queueTail->next = job;
+	else
+		cache->queueHead = job;
+	cache->queueTail = job;
+	pthread_cond_signal(&cache->wake);
+	pthread_mutex_unlock(&cache->lock);
+
+	evict_over_budget(cache);
+}
+
+CompressedVariant *compression_cache_lookup(CompressionCache *const cache, char const *const path,
+		ContentEncoding const encoding, off_t const size, struct timespec const modified)
+{
+	collect_finished(cache);
+
+	size_t const hash = variant_hash(path, encoding);
+	CompressedVariant *const variant = find_variant(cache, path, encoding, hash);
+	if (variant != NULL) {
+		if (variant->sourceSize == size && variant->sourceModified.tv_sec == modified.tv_sec
+				&& variant->sourceModified.tv_nsec == modified.tv_nsec) {
+			unlink_variant_recency(cache, variant);
+			mark_variant_newest(cache, variant);
+			if (variant->state != VARIANT_READY)
+				return NULL;
+			variant->references++;
+			return variant;
+		}
+		// The file changed, compress the new version instead
+		evict_variant(cache, variant);
+	}
+
+	if (cache->pendingCount < MAXIMUM_PENDING_COMPRESSIONS)
+		queue_compression(cache, path, encoding, hash, size, modified);
+	return NULL;
+}
+
+void compression_cache_release(CompressionCache *const cache, CompressedVariant *const variant)
+{
+	(void) cache;
+	variant->references--;
+	if (variant->references == 0 && variant->stale)
+		free_variant(variant);
+}
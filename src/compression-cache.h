@@ -0,0 +1,102 @@
+#pragma once
+
+#include "content-encoding.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <time.h>
+
+typedef enum {
+	// Waiting for or being worked on by a compression thread
+	VARIANT_PENDING,
+	VARIANT_READY,
+	// Did not come out meaningfully smaller, or could not be compressed.
+	// Remembered so the file is not tried again until it changes.
+	VARIANT_USELESS,
+} VariantState;
+
+// A file compressed with one coding, for a particular version of the file
+typedef struct CompressedVariant {
+	char *path;
+	size_t hash;
+	ContentEncoding encoding;
+	// The version of the file this was compressed from
+	off_t sourceSize;
+	struct timespec sourceModified;
+
+	VariantState state;
+	char *data;
+	size_t size;
+	// Same as CachedContent's
+	char *header;
+	size_t headerLength;
+	unsigned headerVariant;
+	// Budget the entry takes up, its data and bookkeeping
+	size_t bytes;
+	// Responses currently sending this variant. It is only freed once this
+	// drops to zero, even if it was evicted in the meantime.
+	unsigned references;
+	// Set once the entry has left the cache
+	bool stale;
+
+	struct CompressedVariant *nextInBucket;
+	struct CompressedVariant *newer;
+	struct CompressedVariant *older;
+} CompressedVariant;
+
+// Work handed to the compression threads and back, the threads never touch
+// the cache itself
+typedef struct CompressionJob {
+	char *path;
+	ContentEncoding encoding;
+	off_t sourceSize;
+	struct timespec sourceModified;
+	// Filled in by the thread, NULL when it was not worth it
+	char *data;
+	size_t size;
+	struct CompressionJob *next;
+} CompressionJob;
+
+// Bounded LRU cache of compressed copies of files, keyed by path and
+// coding and checked against the file's size and mtime. Missing variants
+// are compressed by a few threads of the cache's own so the event loop
+// never waits for zlib, and the file is sent as it is in the meantime.
+// Belongs to a single worker, only the job lists are shared with its
+// threads.
+typedef struct {
+	CompressedVariant **buckets;
+	size_t bucketCount;
+	size_t entryCount;
+
+	CompressedVariant *newest;
+	CompressedVariant *oldest;
+	size_t bytes;
+	size_t budget;
+	unsigned pendingCount;
+
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	// Both guarded by lock. Jobs are taken from the front of the queue
+	// and finished ones pile up on finished until the loop collects them.
+	CompressionJob *queueHead;
+	CompressionJob *queueTail;
+	CompressionJob *finished;
+	bool stopping;
+
+	pthread_t *threads;
+	unsigned threadCount;
+} CompressionCache;
+
+CompressionCache *compression_cache_create(size_t const budget, unsigned const threadCount);
+void compression_cache_destroy(CompressionCache *const cache);
+
+// Returns a referenced variant of the file at path compressed with
+// encoding, for the version of the file with the given size and mtime.
+// When there is none yet it gets queued for compression and NULL is
+// returned, as it is for files that don't compress.
+CompressedVariant *compression_cache_lookup(CompressionCache *const cache, char const *const path,
+		ContentEncoding const encoding, off_t const size, struct timespec const modified);
+
+void compression_cache_release(CompressionCache *const cache, CompressedVariant *const variant);
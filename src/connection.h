@@ -0,0 +1,149 @@
+#pragma once
+
+#include "arena.h"
+#include "content-encoding.h"
+#include "request-parser.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+struct CachedContent;
+struct CompressedVariant;
+struct MappedFile;
+struct OpenFile;
+
+// This limits the maximum amount of request that can be read, enough for
+// the largest request head the parser accepts
+#define MAXIMUM_REQUEST_SIZE MAXIMUM_REQUEST_HEAD_SIZE
+
+// Room for the status line, Content-Length, the longest Content-Type,
+// Content-Encoding, Vary, Last-Modified, ETag, Date and the Connection
+// header
+#define MAXIMUM_RESPONSE_HEADER_SIZE 512
+// What is left of that for the headers describing the body, the rest is
+// kept for the ones queue_response() adds to every response
+#define MAXIMUM_FILE_HEADER_SIZE (MAXIMUM_RESPONSE_HEADER_SIZE - 64)
+
+// How many answers to pipelined requests can be waiting to be sent on one
+// connection. Requests beyond that stay in the buffer until there is room.
+#define MAXIMUM_PIPELINED_RESPONSES 16
+
+// Most separate pieces one response can be sent from, enough for a
+// multipart/byteranges response with the most ranges allowed
+#define MAXIMUM_RESPONSE_SEGMENTS 16
+
+// With -f read, files are read into a buffer this big and sent from there
+// one chunk at a time, which is all the memory a connection ever needs for
+// them whatever their size
+#define STREAM_CHUNK_SIZE (64 * 1024)
+
+// A piece of memory to send, or with data NULL, length bytes of the
+// response's file starting at fileOffset
+typedef struct {
+	char const *data;
+	off_t fileOffset;
+	size_t length;
+} ResponseSegment;
+
+// One answer waiting to be sent, written as a list of segments. See the
+// response writer in http-server.h.
+typedef struct {
+	// Text formatted for this response alone, which segments point into
+	char header[MAXIMUM_RESPONSE_HEADER_SIZE];
+	size_t headerLength;
+
+	// Pieces of header, canned replies pointing at string literals, text in
+	// the connection's arena, memory of a cache entry or file mapping that
+	// the response holds a reference to, or parts of the file
+	ResponseSegment segments[MAXIMUM_RESPONSE_SEGMENTS];
+	unsigned segmentCount;
+	// Segments before this one are header, the rest are body
+	unsigned headerSegments;
+	// First segment that has not been sent in full, and how much of it has
+	unsigned segmentsSent;
+	size_t segmentOffset;
+
+	struct CachedContent *cached;
+	struct MappedFile *mapping;
+	struct CompressedVariant *compressed;
+	// Entry of the open file cache the file is sent from, which fileFD
+	// then belongs to
+	struct OpenFile *openFile;
+	// What goes into the access log once the response is done with, in the
+	// connection's arena. NULL unless requests are logged.
+	struct AccessRecord *accessRecord;
+
+	// File segments are sent straight from the page cache, so a response
+	// costs the same amount of memory whatever the file size. -1 when
+	// there is no file or, with io_uring, it is in the connection's slot.
+	int fileFD;
+
+	// Whether the connection stays open once this has been sent
+	bool keepAlive;
+	// Microseconds of CLOCK_MONOTONIC when the request arrived, only kept
+	// while metrics are turned on
+	long long started;
+} Response;
+
+// Everything the event loop needs to remember about a client between
+// readiness notifications, since nothing is allowed to block on it.
+typedef struct Connection {
+	int fd;
+	// IPv4 address of the client in network byte order, only looked up
+	// for the access log
+	uint32_t peerAddress;
+	// Set once the last response before hanging up has been queued, or the
+	// client has finished sending, nothing more gets read after that
+	bool closing;
+
+	// Always kept null terminated so it can be handed to string functions.
+	// Once the request is complete requestEnd is its length, anything after
+	// that is the start of the next request on the same connection.
+	char request[MAXIMUM_REQUEST_SIZE + 1];
+	size_t requestLength;
+	size_t requestEnd;
+	RequestParser parser;
+
+	// Filled in from the request being answered
+	bool headRequest;
+	bool http11;
+	bool keepAlive;
+	// Coding of the body being sent, and whether that is because a sidecar
+	// of the requested file is sent in its place rather than a compressed
+	// copy the server made
+	ContentEncoding encoding;
+	bool sidecar;
+	// Set when the requested file has sidecars or gets compressed, so what
+	// gets sent depends on Accept-Encoding
+	bool varyEncoding;
+	// Requests answered on this connection, including the current one
+	unsigned long requestCount;
+
+	// While waiting for a request the connection sits on the worker's idle
+	// list and gets closed if nothing arrives by idleDeadline, in
+	// milliseconds of CLOCK_MONOTONIC.
+	bool idle;
+	long long idleDeadline;
+	struct Connection *idleNewer;
+	struct Connection *idleOlder;
+
+	// Answers in the order the requests came in, responseHead is the one
+	// being sent
+	Response responses[MAXIMUM_PIPELINED_RESPONSES];
+	unsigned responseHead;
+	unsigned responseCount;
+
+	// Memory for the requests being answered, given back while the
+	// connection is idle
+	Arena arena;
+
+	// File pieces streamed with -f read: the chunk buffer, taken from the
+	// arena when the first response with a file is queued, how much of the
+	// file is in it and how much of that has been sent. The next chunk is
+	// only read once the socket has taken all of this one.
+	char *streamBuffer;
+	size_t streamLength;
+	size_t streamSent;
+} Connection;
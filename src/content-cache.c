@@ -0,0 +1,417 @@
+#include "content-cache.h"
+#include "hash.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Starting size of the hash table, doubled whenever it gets full
+#define CONTENT_CACHE_INITIAL_BUCKETS 256
+
+// Counters per row of the frequency sketch. Must be a power of two.
+#define SKETCH_WIDTH 4096
+#define SKETCH_ROWS 4
+// Counters saturate here, more precision doesn't change any decision
+#define SKETCH_MAXIMUM_COUNT 15
+// All counters are halved after this many increments per counter
+#define SKETCH_SAMPLE_FACTOR 10
+
+// Share of the budget for the admission window and, out of the main space,
+// for entries that have proven themselves. These are the usual W-TinyLFU
+// proportions.
+#define WINDOW_PERCENT 1
+#define PROTECTED_PERCENT 80
+
+// Largest file read into the cache. Files are read while the event loop
+// waits, anything bigger is better off mapped or sent with sendfile().
+#define MAXIMUM_CACHED_FILE_SIZE (1024 * 1024)
+
+time_t current_second(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+	return now.tv_sec;
+}
+
+// Each row gets its own index out of the same path hash
+size_t sketch_index(size_t const hash, unsigned const row)
+{
+	static uint64_t const seeds[SKETCH_ROWS] = {
+		0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL,
+		0x165667b19e3779f9ULL, 0x27d4eb2f165667c5ULL
+	};
+	uint64_t const mixed = ((uint64_t) hash + seeds[row]) * 0xff51afd7ed558ccdULL;
+	return (size_t) (mixed >> 32) & (SKETCH_WIDTH - 1);
+}
+
+void sketch_increment(FrequencySketch *const sketch, size_t const hash)
+{
+	for (unsigned row = 0; row < SKETCH_ROWS; row++) {
+		uint8_t *const counter = &sketch->counters[row * SKETCH_WIDTH + sketch_index(hash, row)];
+		if (*counter < SKETCH_MAXIMUM_COUNT)
+			(*counter)++;
+	}
+
+	if (++sketch->additions >= sketch->resetAfter) {
+		for (size_t i = 0; i < (size_t) SKETCH_ROWS * SKETCH_WIDTH; i++)
+			sketch->counters[i] /= 2;
+		sketch->additions /= 2;
+	}
+}
+
+unsigned sketch_estimate(FrequencySketch const *const sketch, size_t const hash)
+{
+	unsigned estimate = SKETCH_MAXIMUM_COUNT;
+	for (unsigned row = 0; row < SKETCH_ROWS; row++) {
+		unsigned const count = sketch->counters[row * SKETCH_WIDTH + sketch_index(hash, row)];
+		if (count < estimate)
+			estimate = count;
+	}
+	return estimate;
+}
+
+ContentCache *content_cache_create(size_t const budget, time_t const checkInterval)
+{
+	ContentCache *const cache = calloc(1, sizeof(ContentCache));
+	if (cache == NULL) {
+		perror("content_cache_create(): Failed to allocate cache");
+		return NULL;
+	}
+	cache->buckets = calloc(CONTENT_CACHE_INITIAL_BUCKETS, sizeof(CachedContent *));
+	cache->sketch.counters = calloc((size_t) SKETCH_ROWS * SKETCH_WIDTH, sizeof(uint8_t));
+	if (cache->buckets == NULL || cache->sketch.counters == NULL) {
+		perror("content_cache_create(): Failed to allocate tables");
+		free(cache->buckets);
+		free(cache->sketch.counters);
+		free(cache);
+		return NULL;
+	}
+	cache->bucketCount = CONTENT_CACHE_INITIAL_BUCKETS;
+	cache->sketch.width = SKETCH_WIDTH;
+	cache->sketch.resetAfter = (unsigned long) SKETCH_WIDTH * SKETCH_SAMPLE_FACTOR;
+
+	cache->windowBudget = budget / 100 * WINDOW_PERCENT;
+	cache->mainBudget = budget - cache->windowBudget;
+	cache->protectedBudget = cache->mainBudget / 100 * PROTECTED_PERCENT;
+	cache->checkInterval = checkInterval;
+	return cache;
+}
+
+CacheList *cache_list_of(ContentCache *const cache, CacheQueue const queue)
+{
+	switch (queue) {
+	case CACHE_WINDOW:
+		return &cache->window;
+	case CACHE_PROBATION:
+		return &cache->probation;
+	case CACHE_PROTECTED:
+		return &cache->protected;
+	}
+	return NULL;
+}
+
+void cache_list_remove(CacheList *const list, CachedContent *const entry)
+{
+	if (entry->newer != NULL)
+		entry->newer->older = entry->older;
+	else
+		list->newest = entry->older;
+	if (entry->older != NULL)
+		entry->older->newer = entry->newer;
+	else
+		list->oldest = entry->newer;
+	entry->newer = entry->older = NULL;
+	list->bytes -= (size_t) entry->size;
+}
+
+void cache_list_push_newest(CacheList *const list, CachedContent *const entry)
+{
+	entry->older = list->newest;
+	entry->newer = NULL;
+	if (list->newest != NULL)
+		list->newest->newer = entry;
+	list->newest = entry;
+	if (list->oldest == NULL)
+		list->oldest = entry;
+	list->bytes += (size_t) entry->size;
+}
+
+void cache_move_to_queue(ContentCache *const cache, CachedContent *const entry,
+		CacheQueue const queue)
+{
+	cache_list_remove(cache_list_of(cache, entry->queue), entry);
+	entry->queue = queue;
+	cache_list_push_newest(cache_list_of(cache, queue), entry);
+}
+
+void free_content(CachedContent *const entry)
+{
+	free(entry->data);
+	free(entry->header);
+	free(entry->path);
+	free(entry);
+}
+
+// Takes an entry out of the cache. The data itself stays around until the
+// last response using it lets go.
+void evict_content(ContentCache *const cache, CachedContent *const entry)
+{
+	CachedContent **link = &cache->buckets[entry->hash & (cache->bucketCount - 1)];
+	while (*link != entry)
+		link = &(*link)->nextInBucket;
+	*link = entry->nextInBucket;
+
+	cache_list_remove(cache_list_of(cache, entry->queue), entry);
+	cache->entryCount--;
+	entry->stale = true;
+	if (entry->references == 0)
+		free_content(entry);
+}
+
+void content_cache_destroy(ContentCache *const cache)
+{
+	while (cache->window.newest != NULL)
+		evict_content(cache, cache->window.newest);
+	while (cache->probation.newest != NULL)
+		evict_content(cache, cache->probation.newest);
+	while (cache->protected.newest != NULL)
+		evict_content(cache, cache->protected.newest);
+	free(cache->buckets);
+	free(cache->sketch.counters);
+	free(cache);
+}
+
+void grow_content_buckets(ContentCache *const cache)
+{
+	size_t const newCount = cache->bucketCount * 2;
+	CachedContent **const buckets = calloc(newCount, sizeof(CachedContent *));
+	// Long chains are slower but still correct, so just carry on
+	if (buckets == NULL)
+		return;
+
+	for (size_t i = 0; i < cache->bucketCount; i++) {
+		CachedContent *entry = cache->buckets[i];
+		while (entry != NULL) {
+			CachedContent *const next = entry->nextInBucket;
+			size_t const bucket = entry->hash & (newCount - 1);
+			entry->nextInBucket = buckets[bucket];
+			buckets[bucket] = entry;
+			entry = next;
+		}
+	}
+	free(cache->buckets);
+	cache->buckets = buckets;
+	cache->bucketCount = newCount;
+}
+
+// The entry the main space would give up next to make room
+CachedContent *cache_main_victim(ContentCache *const cache)
+{
+	if (cache->probation.oldest != NULL)
+		return cache->probation.oldest;
+	return cache->protected.oldest;
+}
+
+size_t cache_main_bytes(ContentCache const *const cache)
+{
+	return cache->probation.bytes + cache->protected.bytes;
+}
+
+// Moves whatever no longer fits in the window into the main space, as long
+// as it has been requested more often than each entry it would replace.
+// Otherwise it is the one that gets evicted.
+void admit_from_window(ContentCache *const cache)
+{
+	while (cache->window.bytes > cache->windowBudget) {
+		CachedContent *candidate = cache->window.oldest;
+		unsigned const candidateFrequency = sketch_estimate(&cache->sketch, candidate->hash);
+
+		while (cache_main_bytes(cache) + (size_t) candidate->size > cache->mainBudget) {
+			CachedContent *const victim = cache_main_victim(cache);
+			if (victim == NULL
+					|| sketch_estimate(&cache->sketch, victim->hash) >= candidateFrequency) {
+				evict_content(cache, candidate);
+				candidate = NULL;
+				break;
+			}
+			evict_content(cache, victim);
+		}
+
+		if (candidate != NULL)
+			cache_move_to_queue(cache, candidate, CACHE_PROBATION);
+	}
+}
+
+CachedContent *content_cache_lookup(ContentCache *const cache, char const *const path,
+		bool *const needsCheck)
+{
+	size_t const hash = hash_path(path);
+	sketch_increment(&cache->sketch, hash);
+
+	CachedContent *entry = cache->buckets[hash & (cache->bucketCount - 1)];
+	while (entry != NULL && (entry->hash != hash || strcmp(entry->path, path) != 0))
+		entry = entry->nextInBucket;
+	if (entry == NULL)
+		return NULL;
+
+	switch (entry->queue) {
+	case CACHE_WINDOW:
+	case CACHE_PROTECTED:
+		cache_move_to_queue(cache, entry, entry->queue);
+		break;
+	case CACHE_PROBATION:
+		cache_move_to_queue(cache, entry, CACHE_PROTECTED);
+		// Keep the protected segment to its share, the overflow gets
+		// another chance on probation.
+		while (cache->protected.bytes > cache->protectedBudget
+				&& cache->protected.oldest != entry)
+			cache_move_to_queue(cache, cache->protected.oldest, CACHE_PROBATION);
+		break;
+	}
+
+	*needsCheck = current_second() - entry->lastChecked >= cache->checkInterval;
+	entry->references++;
+	return entry;
+}
+
+bool content_cache_revalidate(ContentCache *const cache, CachedContent *const entry,
+		struct stat const *const st)
+{
+	if (entry->device == st->st_dev && entry->inode == st->st_ino
+			&& entry->size == st->st_size
+			&& entry->modified.tv_sec == st->st_mtim.tv_sec
+			&& entry->modified.tv_nsec == st->st_mtim.tv_nsec) {
+		entry->lastChecked = current_second();
+		return true;
+	}
+	content_cache_evict(cache, entry);
+	return false;
+}
+
+void cached_content_stat(CachedContent const *const entry, struct stat *const st)
+{
+	memset(st, 0, sizeof(*st));
+	st->st_dev = entry->device;
+	st->st_ino = entry->inode;
+	st->st_mode = S_IFREG;
+	st->st_size = entry->size;
+	st->st_mtim = entry->modified;
+}
+
+void content_cache_evict(ContentCache *const cache, CachedContent *const entry)
+{
+	// Already replaced by a newer copy if another request got there first
+	if (!entry->stale)
+		evict_content(cache, entry);
+}
+
+// Reads the whole file, returns NULL if it doesn't match what stat() said
+char *read_whole_file(char const *const path, size_t const size)
+{
+	int const fileFD = open(path, O_RDONLY | O_CLOEXEC);
+	if (fileFD == -1) {
+		perror("read_whole_file(): Could not open file");
+		return NULL;
+	}
+	char *const data = malloc(size);
+	if (data == NULL) {
+		perror("read_whole_file(): Failed to allocate file data");
+		close(fileFD);
+		return NULL;
+	}
+
+	size_t done = 0;
+	while (done < size) {
+		ssize_t const status = pread(fileFD, data + done, size - done, (off_t) done);
+		if (status == -1 && errno == EINTR)
+			continue;
+		if (status <= 0) {
+			if (status == -1)
+				perror("read_whole_file(): pread() errored");
+			else
+				fprintf(stderr, "read_whole_file(): File shrank while reading %s\n", path);
+			close(fileFD);
+			free(data);
+			return NULL;
+		}
+		done += (size_t) status;
+	}
+	close(fileFD);
+	return data;
+}
+
+CachedContent *content_cache_admit(ContentCache *const cache, char const *const path,
+		struct stat const *const st)
+{
+	// Empty files have nothing worth caching
+	if (st->st_size <= 0 || st->st_size > MAXIMUM_CACHED_FILE_SIZE
+			|| (size_t) st->st_size > cache->mainBudget)
+		return NULL;
+	size_t const size = (size_t) st->st_size;
+	size_t const hash = hash_path(path);
+
+	// Something too big for the window goes straight into competing for
+	// the main space, so skip reading it if it would lose anyway.
+	if (size > cache->windowBudget && cache_main_bytes(cache) + size > cache->mainBudget) {
+		CachedContent const *const victim = cache_main_victim(cache);
+		if (victim == NULL || sketch_estimate(&cache->sketch, victim->hash)
+				>= sketch_estimate(&cache->sketch, hash))
+			return NULL;
+	}
+
+	char *const data = read_whole_file(path, size);
+	if (data == NULL)
+		return NULL;
+
+	// Another request may have loaded it while this one was checking the
+	// file, the copy just read is at least as new.
+	CachedContent *existing = cache->buckets[hash & (cache->bucketCount - 1)];
+	while (existing != NULL && (existing->hash != hash || strcmp(existing->path, path) != 0))
+		existing = existing->nextInBucket;
+	if (existing != NULL)
+		evict_content(cache, existing);
+
+	CachedContent *const entry = calloc(1, sizeof(CachedContent));
+	char *const pathCopy = strdup(path);
+	if (entry == NULL || pathCopy == NULL) {
+		perror("content_cache_admit(): Failed to allocate entry");
+		free(data);
+		free(entry);
+		free(pathCopy);
+		return NULL;
+	}
+	entry->path = pathCopy;
+	entry->hash = hash;
+	entry->device = st->st_dev;
+	entry->inode = st->st_ino;
+	entry->size = st->st_size;
+	entry->modified = st->st_mtim;
+	entry->lastChecked = current_second();
+	entry->data = data;
+	// Held across admission so the caller gets to send it even if it
+	// loses straight away.
+	entry->references = 1;
+
+	if (cache->entryCount >= cache->bucketCount)
+		grow_content_buckets(cache);
+	size_t const bucket = hash & (cache->bucketCount - 1);
+	entry->nextInBucket = cache->buckets[bucket];
+	cache->buckets[bucket] = entry;
+	cache->entryCount++;
+	entry->queue = CACHE_WINDOW;
+	cache_list_push_newest(&cache->window, entry);
+
+	admit_from_window(cache);
+	return entry;
+}
+
+void content_cache_release(ContentCache *const cache, CachedContent *const entry)
+{
+	(void) cache;
+	entry->references--;
+	if (entry->references == 0 && entry->stale)
+		free_content(entry);
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+
+typedef enum {
+	// Newly loaded files wait here before competing for the main space
+	CACHE_WINDOW,
+	// Main space, entries that have not been hit since entering it
+	CACHE_PROBATION,
+	// Main space, entries hit at least once while on probation
+	CACHE_PROTECTED,
+} CacheQueue;
+
+// The complete contents of a file, shared by every response that sends it
+typedef struct CachedContent {
+	char *path;
+	size_t hash;
+	// What the file looked like when it was read, compared against a fresh
+	// stat() once the check interval has passed.
+	dev_t device;
+	ino_t inode;
+	off_t size;
+	struct timespec modified;
+	time_t lastChecked;
+
+	char *data;
+	// Header block of a 200 response for the file, built by the server
+	// the first time the entry is sent and copied by every response after.
+	char *header;
+	size_t headerLength;
+	// The Content-Encoding and Vary the header was built with, which only
+	// responses sending the file the same way can share
+	unsigned headerVariant;
+	// Responses currently sending this entry. It is only freed once this
+	// drops to zero, even if it was evicted in the meantime.
+	unsigned references;
+	// Set once the entry has left the cache
+	bool stale;
+
+	CacheQueue queue;
+	struct CachedContent *nextInBucket;
+	struct CachedContent *newer;
+	struct CachedContent *older;
+} CachedContent;
+
+typedef struct {
+	CachedContent *newest;
+	CachedContent *oldest;
+	size_t bytes;
+} CacheList;
+
+// Approximate access counts of recently requested paths, cached or not.
+// Counters are halved every so often so old popularity fades out.
+typedef struct {
+	uint8_t *counters;
+	size_t width;
+	unsigned long additions;
+	unsigned long resetAfter;
+} FrequencySketch;
+
+// Bounded cache of whole files keyed by their normalized path, using
+// W-TinyLFU: new files go through a small LRU window and only make it into
+// the main segmented LRU if they have been requested more often than what
+// they would push out. A one-off download of a large file therefore can't
+// flush the hot set. Belongs to a single worker and is not thread safe.
+typedef struct {
+	CachedContent **buckets;
+	size_t bucketCount;
+	size_t entryCount;
+
+	CacheList window;
+	CacheList probation;
+	CacheList protected;
+	size_t windowBudget;
+	size_t mainBudget;
+	size_t protectedBudget;
+
+	FrequencySketch sketch;
+	// Seconds an entry is trusted before it is checked against the file
+	time_t checkInterval;
+} ContentCache;
+
+ContentCache *content_cache_create(size_t const budget, time_t const checkInterval);
+void content_cache_destroy(ContentCache *const cache);
+
+// Records a request for path and returns a referenced entry if the file is
+// cached. *needsCheck is set when the entry has to be compared with a fresh
+// stat() through content_cache_revalidate() before it can be used.
+CachedContent *content_cache_lookup(ContentCache *const cache, char const *const path,
+		bool *const needsCheck);
+
+// Returns true if st, a fresh stat() of the entry's file, still matches
+// it. Otherwise the entry is dropped from the cache, the caller still has
+// to release its reference.
+bool content_cache_revalidate(ContentCache *const cache, CachedContent *const entry,
+		struct stat const *const st);
+// What the entry's file looked like when it was last checked, filled in
+// the way stat() would have
+void cached_content_stat(CachedContent const *const entry, struct stat *const st);
+
+// Drops the entry from the cache, for when its file can't be stat()ed any
+// more. The caller still has to release its reference.
+void content_cache_evict(ContentCache *const cache, CachedContent *const entry);
+
+// Reads the file into the cache if it is small enough to be read without
+// holding up the event loop for long and the admission policy thinks it is
+// worth it, st must be a fresh stat() of it. Returns a referenced entry or
+// NULL if the file has to be sent some other way.
+CachedContent *content_cache_admit(ContentCache *const cache, char const *const path,
+		struct stat const *const st);
+
+void content_cache_release(ContentCache *const cache, CachedContent *const entry);
+
+// Seconds of CLOCK_MONOTONIC_COARSE, which the times entries were last
+// checked at are kept in
+time_t current_second(void);
@@ -0,0 +1,238 @@
+#include "content-encoding.h"
+#include "content-cache.h"
+#include "hash.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+static char const *const encodingNames[ENCODING_COUNT] = {
+	"identity", "br", "zstd", "gzip", "deflate"
+};
+static char const *const encodingHeaders[ENCODING_COUNT] = {
+	"", "Content-Encoding: br\r\n", "Content-Encoding: zstd\r\n", "Content-Encoding: gzip\r\n",
+	"Content-Encoding: deflate\r\n"
+};
+static char const *const encodingSuffixes[ENCODING_COUNT] = { "", ".br", ".zst", ".gz", "" };
+
+// Order sidecars are picked in, brotli and zstd both beat gzip for text
+static ContentEncoding const encodingPreference[] = {
+	ENCODING_BROTLI, ENCODING_ZSTD, ENCODING_GZIP
+};
+
+char const *encoding_name(ContentEncoding const encoding)
+{
+	return encodingNames[encoding];
+}
+
+char const *encoding_header(ContentEncoding const encoding)
+{
+	return encodingHeaders[encoding];
+}
+
+char const *encoding_suffix(ContentEncoding const encoding)
+{
+	return encodingSuffixes[encoding];
+}
+
+// Whether a q parameter value is some spelling of 0, "0", "0." or "0.000"
+bool qvalue_is_zero(char const *const value, size_t const length)
+{
+	if (length == 0 || value[0] != '0')
+		return false;
+	if (length == 1)
+		return true;
+	if (value[1] != '.')
+		return false;
+	for (size_t i = 2; i < length; i++) {
+		if (value[i] != '0')
+			return false;
+	}
+	return true;
+}
+
+unsigned parse_accept_encoding(char const *const value, size_t const length)
+{
+	unsigned accepted = 0;
+	unsigned refused = 0;
+	bool wildcard = false;
+	bool wildcardRefused = false;
+
+	size_t i = 0;
+	while (i < length) {
+		while (i < length && (value[i] == ' ' || value[i] == '\t' || value[i] == ','))
+			i++;
+		size_t const nameStart = i;
+		while (i < length && value[i] != ',' && value[i] != ';' && value[i] != ' '
+				&& value[i] != '\t')
+			i++;
+		size_t const nameLength = i - nameStart;
+
+		// Parameters, of which only the weight matters
+		bool zeroWeight = false;
+		while (i < length && value[i] != ',') {
+			if (value[i] != ';') {
+				i++;
+				continue;
+			}
+			i++;
+			while (i < length && (value[i] == ' ' || value[i] == '\t'))
+				i++;
+			size_t const parameterStart = i;
+			while (i < length && value[i] != ',' && value[i] != ';' && value[i] != ' '
+					&& value[i] != '\t')
+				i++;
+			if (i - parameterStart >= 2 && (value[parameterStart] == 'q'
+					|| value[parameterStart] == 'Q') && value[parameterStart + 1] == '=')
+				zeroWeight = qvalue_is_zero(value + parameterStart + 2,
+						i - parameterStart - 2);
+		}
+
+		if (nameLength == 1 && value[nameStart] == '*') {
+			wildcard = true;
+			wildcardRefused = zeroWeight;
+			continue;
+		}
+		unsigned bit = 0;
+		for (unsigned j = ENCODING_IDENTITY + 1; j < ENCODING_COUNT; j++) {
+			if (strlen(encodingNames[j]) == nameLength
+					&& strncasecmp(value + nameStart, encodingNames[j], nameLength) == 0)
+				bit = ENCODING_BIT(j);
+		}
+		// Old spelling some clients still send
+		if (nameLength == 6 && strncasecmp(value + nameStart, "x-gzip", 6) == 0)
+			bit = ENCODING_BIT(ENCODING_GZIP);
+		if (zeroWeight)
+			refused |= bit;
+		else
+			accepted |= bit;
+	}
+
+	// A wildcard stands for every coding not named on its own
+	if (wildcard && !wildcardRefused)
+		accepted |= (ENCODING_BIT(ENCODING_COUNT) - 1) & ~ENCODING_BIT(ENCODING_IDENTITY);
+	return accepted & ~refused;
+}
+
+ContentEncoding pick_encoding(unsigned const accepted, unsigned const available)
+{
+	unsigned const usable = accepted & available;
+	for (size_t i = 0; i < sizeof(encodingPreference) / sizeof(encodingPreference[0]); i++) {
+		if (usable & ENCODING_BIT(encodingPreference[i]))
+			return encodingPreference[i];
+	}
+	return ENCODING_IDENTITY;
+}
+
+SidecarTable *sidecar_table_create(size_t const size, time_t const checkInterval)
+{
+	SidecarTable *const table = malloc(sizeof(SidecarTable));
+	if (table == NULL) {
+		perror("sidecar_table_create(): Failed to allocate table");
+		return NULL;
+	}
+	table->slotCount = 1;
+	while (table->slotCount < size)
+		table->slotCount *= 2;
+	table->slots = calloc(table->slotCount, sizeof(SidecarEntry));
+	if (table->slots == NULL) {
+		perror("sidecar_table_create(): Failed to allocate slots");
+		free(table);
+		return NULL;
+	}
+	table->checkInterval = checkInterval;
+	return table;
+}
+
+void sidecar_table_destroy(SidecarTable *const table)
+{
+	for (size_t i = 0; i < table->slotCount; i++)
+		free(table->slots[i].path);
+	free(table->slots);
+	free(table);
+}
+
+// The slot path is kept in if it is in the table, otherwise NULL
+SidecarEntry *sidecar_table_entry(SidecarTable const *const table, char const *const path)
+{
+	size_t const hash = hash_path(path);
+	SidecarEntry *const entry = &table->slots[hash & (table->slotCount - 1)];
+	if (entry->path == NULL || entry->hash != hash || strcmp(entry->path, path) != 0)
+		return NULL;
+	return entry;
+}
+
+bool sidecar_table_recent(SidecarTable const *const table, char const *const path,
+		unsigned *const sidecars)
+{
+	SidecarEntry const *const entry = sidecar_table_entry(table, path);
+	if (entry == NULL || current_second() - entry->checked >= table->checkInterval)
+		return false;
+	*sidecars = entry->sidecars;
+	return true;
+}
+
+bool sidecar_table_find(SidecarTable *const table, char const *const path,
+		struct stat const *const st, unsigned *const sidecars)
+{
+	SidecarEntry *const entry = sidecar_table_entry(table, path);
+	if (entry == NULL || entry->device != st->st_dev || entry->inode != st->st_ino
+			|| entry->size != st->st_size || entry->modified.tv_sec != st->st_mtim.tv_sec
+			|| entry->modified.tv_nsec != st->st_mtim.tv_nsec)
+		return false;
+	entry->checked = current_second();
+	*sidecars = entry->sidecars;
+	return true;
+}
+
+void sidecar_table_store(SidecarTable *const table, char const *const path,
+		struct stat const *const st, unsigned const sidecars)
+{
+	size_t const hash = hash_path(path);
+	SidecarEntry *const entry = &table->slots[hash & (table->slotCount - 1)];
+	if (entry->path == NULL || entry->hash != hash || strcmp(entry->path, path) != 0) {
+		// Not being able to remember it only means looking again
+		char *const pathCopy = strdup(path);
+		if (pathCopy == NULL)
+			return;
+		free(entry->path);
+		entry->path = pathCopy;
+		entry->hash = hash;
+	}
+	entry->sidecars = sidecars;
+	entry->checked = current_second();
+	entry->device = st->st_dev;
+	entry->inode = st->st_ino;
+	entry->size = st->st_size;
+	entry->modified = st->st_mtim;
+}
+
+void sidecar_table_forget(SidecarTable *const table, char const *const path,
+		ContentEncoding const encoding)
+{
+	SidecarEntry *const entry = sidecar_table_entry(table, path);
+	if (entry != NULL)
+		entry->sidecars &= ~ENCODING_BIT(encoding);
+}
+
+unsigned find_sidecars(char const *const path)
+{
+	unsigned sidecars = 0;
+	for (unsigned i = ENCODING_IDENTITY + 1; i < ENCODING_COUNT; i++) {
+		if (encodingSuffixes[i][0] == '\0')
+			continue;
+		char sidecar[PATH_MAX];
+		int const length = snprintf(sidecar, sizeof(sidecar), "%s%s", path,
+				encodingSuffixes[i]);
+		if (length < 0 || (size_t) length >= sizeof(sidecar))
+			continue;
+		struct stat st;
+		if (stat(sidecar, &st) == 0 && S_ISREG(st.st_mode))
+			sidecars |= ENCODING_BIT(i);
+	}
+	return sidecars;
+}
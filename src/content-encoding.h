@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+
+// Codings files can be sent in, identity being the file as it is. The
+// others are served from precompressed sidecar files next to it, or for
+// gzip and deflate compressed by the server itself.
+typedef enum {
+	ENCODING_IDENTITY,
+	ENCODING_BROTLI,
+	ENCODING_ZSTD,
+	ENCODING_GZIP,
+	ENCODING_DEFLATE,
+	ENCODING_COUNT,
+} ContentEncoding;
+
+#define ENCODING_BIT(encoding) (1u << (encoding))
+
+// Name used in Accept-Encoding and Content-Encoding, for example "br"
+char const *encoding_name(ContentEncoding const encoding);
+// "Content-Encoding: br\r\n" and so on, nothing for identity
+char const *encoding_header(ContentEncoding const encoding);
+// Appended to a file's name to get its sidecar, for example ".br", or
+// empty for codings that don't have sidecars
+char const *encoding_suffix(ContentEncoding const encoding);
+
+// Returns the codings an Accept-Encoding header value allows as a mask of
+// ENCODING_BIT()s, identity aside. Codings given a q of 0 are left out,
+// other weights are ignored in favour of the server's own preference.
+unsigned parse_accept_encoding(char const *const value, size_t const length);
+
+// The coding to send out of the allowed ones a file has sidecars for,
+// smallest first, or ENCODING_IDENTITY when there is none
+ContentEncoding pick_encoding(unsigned const accepted, unsigned const available);
+
+typedef struct {
+	// NULL while the slot is empty
+	char *path;
+	size_t hash;
+	// ENCODING_BIT()s of the sidecars found next to the file
+	unsigned sidecars;
+	time_t checked;
+	// What the file itself looked like when the sidecars were looked for,
+	// they are only looked for again once it changes
+	dev_t device;
+	ino_t inode;
+	off_t size;
+	struct timespec modified;
+} SidecarEntry;
+
+// Remembers which sidecars exist next to recently requested files, so
+// negotiating the coding costs no stat() calls on the hot path. Direct
+// mapped by path hash, a colliding path just takes the slot over, which
+// keeps it a fixed size however many paths get requested. Belongs to a
+// single worker and is not thread safe.
+//
+// Entries are only made for files that turned out to exist, from the stat()
+// the server made of the file anyway. A sidecar is expected to be replaced
+// along with its file, so they are looked for again only once such a
+// stat() shows the file changed.
+typedef struct {
+	SidecarEntry *slots;
+	// Always a power of two
+	size_t slotCount;
+	// Seconds an entry is trusted without a stat() of its file
+	time_t checkInterval;
+} SidecarTable;
+
+// Returns a table of at least size slots
+SidecarTable *sidecar_table_create(size_t const size, time_t const checkInterval);
+void sidecar_table_destroy(SidecarTable *const table);
+
+// Sets *sidecars to the ENCODING_BIT()s of the sidecars next to path if
+// the file was checked less than checkInterval ago, without looking at it.
+// Returns false otherwise.
+bool sidecar_table_recent(SidecarTable const *const table, char const *const path,
+		unsigned *const sidecars);
+
+// Sets *sidecars like sidecar_table_recent() if they were looked for since
+// the file last changed, st being a fresh stat() of it. Returns false if
+// they have to be looked for again.
+bool sidecar_table_find(SidecarTable *const table, char const *const path,
+		struct stat const *const st, unsigned *const sidecars);
+
+// Remembers the sidecars found next to path, st being what the file looked
+// like when they were looked for
+void sidecar_table_store(SidecarTable *const table, char const *const path,
+		struct stat const *const st, unsigned const sidecars);
+
+// Forgets one of the sidecars next to path, for when it has gone away
+void sidecar_table_forget(SidecarTable *const table, char const *const path,
+		ContentEncoding const encoding);
+
+// Looks for every kind of sidecar next to path with stat(), which blocks.
+// Returns their ENCODING_BIT()s.
+unsigned find_sidecars(char const *const path);
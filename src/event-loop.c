@@ -0,0 +1,378 @@
+// accept4()
+#define _GNU_SOURCE
+
+#include "event-loop.h"
+#include "http-server.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// How many readiness notifications are pulled out of the kernel at once
+#define MAXIMUM_EVENTS 256
+
+// Upper bound on a single sendfile() so one huge file can't keep the loop
+// from getting to other connections.
+#define MAXIMUM_SENDFILE_CHUNK (1024 * 1024)
+
+bool set_nonblocking(int const fd)
+{
+	int const flags = fcntl(fd, F_GETFL, 0);
+	if (flags == -1)
+		return false;
+	return fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+}
+
+void close_connection(Worker *const worker, Connection *const conn)
+{
+	// Closing the descriptor also removes it from the epoll set
+	close(conn->fd);
+	mark_connection_busy(worker, conn);
+	release_responses(worker, conn);
+	arena_release(&conn->arena);
+	free(conn);
+	if (worker->metrics != NULL)
+		metrics_add(&worker->metrics->connectionsClosed, 1);
+}
+
+// Pulls in whatever the client has sent so far. Returns false if the
+// connection should be dropped.
+bool read_request(Connection *const conn)
+{
+	// The previous request may have brought this one along with it
+	if (request_complete(conn))
+		return true;
+
+	while (conn->requestLength < MAXIMUM_REQUEST_SIZE) {
+		ssize_t const status = recv(conn->fd, conn->request + conn->requestLength,
+				MAXIMUM_REQUEST_SIZE - conn->requestLength, 0);
+		if (status == 0) {
+			// The client is done sending, anything it is still owed
+			// gets sent before hanging up.
+			conn->closing = true;
+			return conn->responseCount > 0;
+		} else if (status == -1) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+			if (errno == EINTR)
+				continue;
+			perror("read_request(): Failed to receive data");
+			return false;
+		}
+		conn->requestLength += (size_t) status;
+		conn->request[conn->requestLength] = '\0';
+		if (request_complete(conn))
+			break;
+	}
+	return true;
+}
+
+// Whether a failed send only means the client has gone away
+bool client_disconnected(int const error)
+{
+	return error == EPIPE || error == ECONNRESET;
+}
+
+// Sends the file piece at the head of the queue through the connection's
+// chunk buffer, reading the next chunk only once the socket has taken the
+// last one. A client that goes away therefore costs at most the chunk
+// already read. Returns false if the connection should be dropped, and
+// sets *blocked when the socket is full.
+bool stream_file_range(Worker *const worker, Connection *const conn, int const fileFD,
+		bool *const blocked)
+{
+	*blocked = false;
+	if (conn->streamLength == 0) {
+		off_t offset;
+		size_t length;
+		if (!next_stream_chunk(conn, &offset, &length))
+			return false;
+		ssize_t status;
+		do {
+			status = pread(fileFD, conn->streamBuffer, length, offset);
+		} while (status == -1 && errno == EINTR);
+		if (status == -1) {
+			perror("stream_file_range(): Failed to read file");
+			return false;
+		}
+		// Shrunk since it was looked at, see write_responses()
+		if (status == 0)
+			return false;
+		conn->streamLength = (size_t) status;
+	}
+
+	while (conn->streamLength > 0) {
+		ssize_t const status = send(conn->fd, conn->streamBuffer + conn->streamSent,
+				conn->streamLength - conn->streamSent, MSG_NOSIGNAL);
+		if (status == -1) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				*blocked = true;
+				return true;
+			}
+			if (errno == EINTR)
+				continue;
+			if (!client_disconnected(errno))
+				perror("stream_file_range(): send() errored");
+			return false;
+		}
+		mark_stream_sent(worker, conn, (size_t) status);
+	}
+	return true;
+}
+
+// Sends as much of the queued responses as the socket takes. Everything in
+// memory up to the next piece of a file goes out in one sendmsg(). Returns
+// false if the connection should be dropped.
+bool write_responses(Worker *const worker, Connection *const conn)
+{
+	while (conn->responseCount > 0) {
+		struct iovec iov[MAXIMUM_GATHERED_SEGMENTS];
+		bool fileNext;
+		size_t const count = gather_responses(conn, iov,
+				sizeof(iov) / sizeof(iov[0]), &fileNext);
+		if (count > 0) {
+			struct msghdr msg = { .msg_iov = iov, .msg_iovlen = count };
+			ssize_t const status = sendmsg(conn->fd, &msg,
+					MSG_NOSIGNAL | (fileNext ? MSG_MORE : 0));
+			if (status == -1) {
+				if (errno == EAGAIN || errno == EWOULDBLOCK)
+					return true;
+				if (errno == EINTR)
+					continue;
+				return false;
+			}
+			mark_responses_sent(worker, conn, (size_t) status);
+			continue;
+		}
+
+		// A piece of the file is next. A partial write just carries on
+		// from where it stopped next time the socket is writable.
+		off_t offset;
+		size_t length;
+		if (!next_file_range(conn, &offset, &length)) {
+			mark_responses_sent(worker, conn, 0);
+			continue;
+		}
+		Response const *const response = &conn->responses[conn->responseHead];
+		if (worker->streamFiles) {
+			bool blocked;
+			if (!stream_file_range(worker, conn, response->fileFD, &blocked))
+				return false;
+			if (blocked)
+				return true;
+			continue;
+		}
+		size_t const chunk = length > MAXIMUM_SENDFILE_CHUNK ? MAXIMUM_SENDFILE_CHUNK : length;
+		ssize_t const status = sendfile(conn->fd, response->fileFD, &offset, chunk);
+		if (status == -1) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return true;
+			if (errno == EINTR)
+				continue;
+			if (!client_disconnected(errno))
+				perror("write_responses(): sendfile() errored");
+			return false;
+		}
+		// The file got shorter since it was looked at, the header
+		// already went out so all we can do is hang up.
+		if (status == 0)
+			return false;
+		mark_responses_sent(worker, conn, (size_t) status);
+	}
+	return true;
+}
+
+// Moves a connection along after epoll reported activity on it. Returns
+// false once the connection has been closed and freed.
+bool handle_connection(Worker *const worker, Connection *const conn, uint32_t const events)
+{
+	// A reset or both directions shut, nothing more can reach the client
+	// so whatever is still being streamed to it stops right here
+	if (events & (EPOLLERR | EPOLLHUP)) {
+		close_connection(worker, conn);
+		return false;
+	}
+
+	// Every complete request that is already buffered gets answered before
+	// anything is written, so their responses leave together. Kept open
+	// connections go round again for as long as requests keep coming in
+	// without the socket blocking.
+	while (1) {
+		while (!conn->closing && conn->responseCount < MAXIMUM_PIPELINED_RESPONSES) {
+			if (!read_request(conn)) {
+				close_connection(worker, conn);
+				return false;
+			}
+			if (!request_complete(conn))
+				break;
+			mark_connection_busy(worker, conn);
+			prepare_response(worker, conn);
+		}
+		// Still waiting for the rest of a request
+		if (conn->responseCount == 0)
+			return true;
+
+		if (!write_responses(worker, conn)) {
+			close_connection(worker, conn);
+			return false;
+		}
+		if (conn->responseCount > 0)
+			return true;
+
+		if (conn->closing) {
+			close_connection(worker, conn);
+			return false;
+		}
+		mark_connection_idle(worker, conn, monotonic_milliseconds());
+	}
+}
+
+// Closes connections that have waited too long for a request. Returns how
+// many were closed.
+unsigned long close_idle_connections(Worker *const worker, long long const now)
+{
+	unsigned long closed = 0;
+	while (worker->idleOldest != NULL && worker->idleOldest->idleDeadline <= now) {
+		close_connection(worker, worker->idleOldest);
+		closed++;
+	}
+	return closed;
+}
+
+// How long epoll_wait() may sleep before the next idle connection is due
+int idle_wait_timeout(Worker const *const worker, long long const now)
+{
+	if (worker->idleOldest == NULL)
+		return -1;
+	long long const left = worker->idleOldest->idleDeadline - now;
+	if (left <= 0)
+		return 0;
+	return left > INT_MAX ? INT_MAX : (int) left;
+}
+
+// Accepts every pending connection. Returns how many were accepted.
+unsigned long accept_connections(Worker *const worker, int const epollFD, int const listenFD)
+{
+	unsigned long accepted = 0;
+
+	while (1) {
+		struct sockaddr_in peer;
+		socklen_t peerLength = sizeof(peer);
+		int const clientFD = accept4(listenFD, (struct sockaddr *) &peer, &peerLength,
+				SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (clientFD == -1) {
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				perror("accept_connections(): accept4() errored");
+			break;
+		}
+
+		Connection *const conn = calloc(1, sizeof(Connection));
+		if (conn == NULL) {
+			perror("accept_connections(): Failed to allocate connection");
+			close(clientFD);
+			continue;
+		}
+		conn->fd = clientFD;
+		conn->peerAddress = peer.sin_addr.s_addr;
+		arena_init(&conn->arena, &worker->slabs);
+		if (worker->metrics != NULL)
+			metrics_add(&worker->metrics->connectionsAccepted, 1);
+		mark_connection_idle(worker, conn, monotonic_milliseconds());
+
+		// Edge triggered, so the handlers always drain the socket
+		struct epoll_event event = {
+			.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET,
+			.data.ptr = conn
+		};
+		if (epoll_ctl(epollFD, EPOLL_CTL_ADD, clientFD, &event) == -1) {
+			perror("accept_connections(): Failed to add client to epoll");
+			close_connection(worker, conn);
+			continue;
+		}
+		accepted++;
+	}
+
+	return accepted;
+}
+
+void run_event_loop(Worker *const worker, int const listenFD, unsigned long const maxRequests)
+{
+	if (!set_nonblocking(listenFD)) {
+		perror("run_event_loop(): Failed to make listening socket non-blocking");
+		return;
+	}
+
+	int const epollFD = epoll_create1(EPOLL_CLOEXEC);
+	if (epollFD == -1) {
+		perror("run_event_loop(): epoll_create1() errored");
+		return;
+	}
+
+	// Other workers wait on the same socket, EPOLLEXCLUSIVE stops every one
+	// of them from waking up for each new connection.
+	struct epoll_event listenEvent = {
+		.events = EPOLLIN | EPOLLEXCLUSIVE,
+		.data.ptr = NULL
+	};
+	if (epoll_ctl(epollFD, EPOLL_CTL_ADD, listenFD, &listenEvent) == -1) {
+		perror("run_event_loop(): Failed to add listening socket to epoll");
+		close(epollFD);
+		return;
+	}
+
+	bool accepting = true;
+	unsigned long active = 0;
+	struct epoll_event events[MAXIMUM_EVENTS];
+
+	while (accepting || active > 0) {
+		int const count = epoll_wait(epollFD, events, MAXIMUM_EVENTS,
+				idle_wait_timeout(worker, monotonic_milliseconds()));
+		if (count == -1) {
+			if (errno == EINTR)
+				continue;
+			perror("run_event_loop(): epoll_wait() errored");
+			break;
+		}
+
+		for (int i = 0; i < count; i++) {
+			if (events[i].data.ptr == NULL) {
+				active += accept_connections(worker, epollFD, listenFD);
+			} else if (!handle_connection(worker, events[i].data.ptr, events[i].events)) {
+				active--;
+			}
+		}
+		active -= close_idle_connections(worker, monotonic_milliseconds());
+
+		// Stop taking new clients once the limit is reached but let the
+		// ones we already have finish. Anyone just keeping a connection
+		// open is sent away right now. Requests rather than connections
+		// are counted, one kept alive connection can carry any number.
+		if (accepting && maxRequests != 0 && worker->requestsAnswered >= maxRequests) {
+			epoll_ctl(epollFD, EPOLL_CTL_DEL, listenFD, NULL);
+			accepting = false;
+			worker->draining = true;
+			Connection *conn = worker->idleOldest;
+			while (conn != NULL) {
+				Connection *const newer = conn->idleNewer;
+				if (conn->requestCount > 0 && conn->requestLength == 0) {
+					close_connection(worker, conn);
+					active--;
+				}
+				conn = newer;
+			}
+		}
+	}
+
+	close(epollFD);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "worker.h"
+
+// Serves connections from listenFD until maxRequests requests have been
+// answered (0 means forever). The listening socket is switched to
+// non-blocking mode and every client socket is driven by epoll, so a single
+// process can juggle as many clients as it has file descriptors for.
+void run_event_loop(Worker *const worker, int const listenFD, unsigned long const maxRequests);
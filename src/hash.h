@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// FNV-1a, plenty for short paths
+static inline size_t hash_path(char const *path)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	while (*path != '\0') {
+		hash ^= (unsigned char) *path++;
+		hash *= 1099511628211ULL;
+	}
+	return (size_t) hash;
+}
+
+// FNV-1a over text with ASCII letters folded to lowercase, finished off with
+// a murmur3 style mix so every seed gives an unrelated hash. mimeTypeGen.py
+// has a copy of this and the two must stay the same.
+static inline uint32_t hash_lowercase(char const *text, size_t length, uint32_t seed)
+{
+	uint32_t hash = 2166136261u ^ (seed * 0x9e3779b9u);
+	for (size_t i = 0; i < length; i++) {
+		unsigned char ch = (unsigned char) text[i];
+		if (ch >= 'A' && ch <= 'Z')
+			ch |= 0x20;
+		hash ^= ch;
+		hash *= 16777619u;
+	}
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	return hash;
+}
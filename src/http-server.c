@@ -1,26 +1,33 @@
-/* mime-types.h contains:
- *
- * typedef struct {
- *	 char const *const extension;
- *	 char const *const type;
- * } MimeType;
- *
- * MimeType const mimeTypes[] = {
- *	 {"html", "Content-Type: text/html\r\n"},
- *	 // This goes on for quite some time with various mime types
- * };
- */
-#include "mime-types.h"
+// pthread_setaffinity_np()
+#define _GNU_SOURCE
+
+#include "byte-ranges.h"
+#include "byte-scan.h"
+#include "event-loop.h"
+#include "http-server.h"
+#include "location.h"
+#include "uring.h"
 
 #include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <sys/socket.h>
 #include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
+#include <time.h>
 #include <unistd.h>
 
 /* This is free and unencumbered software released into the public domain.
@@ -55,253 +62,1393 @@
 
 #define PORT 8080
 
-// This limits the maximum amount of request that can be read
-#define MAXIMUM_REQUEST_SIZE (1024 * 2)
-
-// This is the limit on how long path you can request like:
-// http://cool.website/path/to/file.txt
-#define MAXIMUM_REQUEST_LOCATION_SIZE 1024
-
-// OK
-#define REPLY_200 "HTTP/1.0 200 OK\r\n"
-// Bad Request
-#define REPLY_400  \
-	"HTTP/1.0 400 Bad Request\r\n" \
-	"<html>\n\t<body>\n\t\t<h1>400 Bad Request</h1>\n\t</body>\n</html>"
-// Not Found
-#define REPLY_404 \
-	"HTTP/1.0 404 Not Found\r\n\r\n" \
-	"<html>\n\t<body>\n\t\t<h1>404 Not Found</h1>\n\t</body>\n</html>"
-// Internal Server Error
-#define REPLY_500 \
-	"HTTP/1.0 500 Internal Server Error\r\n\r\n" \
-	"<html>\n\t<body>\n\t\t<h1>500 Internal Server Error.</h1>\n\t\t" \
-	"Please try again\n\t</body>\n</html>"
-// Not Implemented
-#define REPLY_501 \
-	"HTTP/1.0 501 Not Implemented\r\n\r\n" \
-	"<html>\n\t<body>\n\t\t<h1>501 Not Implemented</h1>\n\t</body>\n</html>"
-
-// Sent at the end of the header the server sends to the client.
-#define END "\r\n"
-
-void trim_right_whitespace(char *const data)
-{
-	// The data is from a subsection of a request so limit
-	// it to the maximum size of a request
-	unsigned int len = strnlen(data, MAXIMUM_REQUEST_SIZE);
-	unsigned int i;
-	for (i = len - 1; i != UINT_MAX; i--) {
-		char const ch = data[i];
-		if (!(ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'))
-			break;
+// How many worker processes get forked at startup to share the listening
+// socket. Can be changed with -w.
+#define DEFAULT_WORKER_COUNT 4
+
+// How many connections a worker handles before it exits and gets replaced
+// by a fresh one, so slow leaks can't build up forever. Can be changed with
+// -r, 0 means workers are never recycled.
+#define DEFAULT_WORKER_MAX_REQUESTS 10000
+
+// Seconds an open connection may sit without sending its next request.
+// Can be changed with -k, 0 closes connections after every response.
+#define DEFAULT_IDLE_TIMEOUT 5
+
+// How many requests a single connection gets answered before it is closed.
+// Can be changed with -n.
+#define DEFAULT_CONNECTION_MAX_REQUESTS 100
+
+// Upper bound for -w, mostly so a typo doesn't fork bomb the machine
+#define MAXIMUM_WORKER_COUNT 1024
+
+// Upper bound for -p, the table is allocated up front
+#define MAXIMUM_SIDECAR_TABLE_SIZE (1024 * 1024)
+
+// How many bytes of files each worker keeps mapped with -f mmap before it
+// starts unmapping the least recently used ones. Can be changed with -m.
+#define DEFAULT_MAPPING_BUDGET_MB 256
+#define DEFAULT_MAPPING_BUDGET ((size_t) DEFAULT_MAPPING_BUDGET_MB * 1024 * 1024)
+
+// How many bytes of file contents each worker keeps in memory, 0 turns the
+// cache off. Can be changed with -c.
+#define DEFAULT_CONTENT_CACHE_BUDGET_MB 32
+#define DEFAULT_CONTENT_CACHE_BUDGET ((size_t) DEFAULT_CONTENT_CACHE_BUDGET_MB * 1024 * 1024)
+
+// Seconds a cached file is served before checking whether it changed on
+// disk, sidecars included. Can be changed with -i, 0 checks on every
+// request.
+#define DEFAULT_CONTENT_CHECK_INTERVAL 1
+
+// How many paths each worker remembers the precompressed .br, .zst and
+// .gz sidecars of, 0 stops them being looked for at all. Can be changed
+// with -p.
+#define DEFAULT_SIDECAR_TABLE_SIZE 1024
+
+// How many files each worker keeps open, with their stat(), so serving
+// them again skips the path lookups. Entries are checked against the file
+// like cached contents are. 0 turns this off, can be changed with -o.
+#define DEFAULT_OPEN_FILE_CACHE_SIZE 256
+
+// How many bytes of compressed copies of files each worker keeps, 0 turns
+// compressing on the fly off. Can be changed with -z.
+#define DEFAULT_COMPRESSION_CACHE_BUDGET_MB 0
+
+// Threads each worker compresses files on, off its event loop
+#define COMPRESSION_THREADS 2
+
+// Only files of a compressible type between these sizes get compressed.
+// Anything smaller barely gains from it and anything bigger would take the
+// threads too long.
+#define MINIMUM_COMPRESSED_FILE_SIZE 1024
+#define MAXIMUM_COMPRESSED_FILE_SIZE (16 * 1024 * 1024)
+
+// Files bigger than this are never mapped, they would only push the hot
+// ones out and sendfile() does just as well for them.
+#define MAXIMUM_MAPPED_FILE_SIZE (16 * 1024 * 1024)
+
+bool request_complete(Connection *const conn)
+{
+	ParseStatus const status = parse_request(&conn->parser, conn->request, conn->requestLength);
+	if (status == REQUEST_INCOMPLETE)
+		return false;
+	// Failed requests end the connection, so their length does not matter
+	conn->requestEnd = status == REQUEST_COMPLETE ? conn->parser.end : conn->requestLength;
+	return true;
+}
+
+// Formats t the way HTTP wants dates, "Sun, 06 Nov 1994 08:49:37 GMT"
+size_t format_http_date(char *const out, size_t const size, time_t const t)
+{
+	struct tm tm;
+	if (gmtime_r(&t, &tm) == NULL)
+		return 0;
+	return strftime(out, size, "%a, %d %b %Y %H:%M:%S GMT", &tm);
+}
+
+void refresh_date_header(Worker *const worker)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME_COARSE, &now);
+	if (worker->dateHeaderLength > 0 && now.tv_sec == worker->dateSecond)
+		return;
+	worker->dateSecond = now.tv_sec;
+
+	char date[DATE_HEADER_SIZE];
+	size_t const length = format_http_date(date, sizeof(date), now.tv_sec);
+	int const headerLength = snprintf(worker->dateHeader, DATE_HEADER_SIZE,
+			"Date: %.*s\r\n", (int) length, date);
+	worker->dateHeaderLength = headerLength > 0 && headerLength < DATE_HEADER_SIZE
+		? (size_t) headerLength : 0;
+}
+
+// The Connection header to send back, HTTP/1.1 clients assume keep-alive
+// unless told otherwise while HTTP/1.0 ones need to be told.
+char const *connection_header(Connection const *const conn)
+{
+	if (!conn->keepAlive)
+		return "Connection: close\r\n";
+	return conn->http11 ? "" : "Connection: keep-alive\r\n";
+}
+
+Response *pending_response(Connection *const conn)
+{
+	return &conn->responses[(conn->responseHead + conn->responseCount)
+		% MAXIMUM_PIPELINED_RESPONSES];
+}
+
+Response *begin_response(Worker *const worker, Connection *const conn)
+{
+	// Nothing refers to what the earlier requests left in the arena once
+	// their responses are out
+	if (conn->responseCount == 0) {
+		arena_reset(&conn->arena);
+		conn->streamBuffer = NULL;
 	}
-	if (i < len - 1)
-		data[i + 1] = '\0';
-}
-
-char *get_mime_type(char const *const location)
-{
-	// Get position of file extension ("main.txt" -> ".txt")
-	char const *extension = strrchr(location, '.');
-	if (extension == NULL)
-		// As per RFC-7231, data with an unknown type should not get a
-		// Content-Type header.
-		return "";
-	// Skip over the . character. ("txt")
-	extension += 1;
-
-	for (unsigned int i = 0; i < sizeof(mimeTypes) / sizeof(MimeType); i++) {
-		if (strncmp(extension, mimeTypes[i].extension, 64) == 0) {
-			// More padding than needed but yea
-			size_t const limit = strnlen(mimeTypes[i].type, 512) + 32;
-			// Add an extra byte so we always have a null terminator
-			char *const type = calloc(limit + 1, sizeof(char));
-			strncat(type, "Content-Type: ", limit);
-			strncat(type, mimeTypes[i].type, limit);
-			return type;
-		}
+	Response *const response = pending_response(conn);
+	response->headerLength = 0;
+	response->segmentCount = response->headerSegments = response->segmentsSent = 0;
+	response->segmentOffset = 0;
+	response->cached = NULL;
+	response->mapping = NULL;
+	response->compressed = NULL;
+	response->openFile = NULL;
+	response->accessRecord = NULL;
+	response->fileFD = -1;
+	response->keepAlive = false;
+	response->started = worker->metrics != NULL ? monotonic_microseconds() : 0;
+	return response;
+}
+
+// The status code at the start of the response's status line, 0 if it
+// does not have one
+unsigned response_status(Response const *const response)
+{
+	ResponseSegment const *const segment = &response->segments[0];
+	size_t const prefix = sizeof("HTTP/1.1 ") - 1;
+	if (response->segmentCount == 0 || segment->data == NULL || segment->length < prefix + 3)
+		return 0;
+	unsigned status = 0;
+	for (size_t i = prefix; i < prefix + 3; i++) {
+		if (segment->data[i] < '0' || segment->data[i] > '9')
+			return 0;
+		status = status * 10 + (unsigned) (segment->data[i] - '0');
 	}
-	// As per RFC-7231, data with an unknown type should not get a
-	// Content-Type header.
-	return "";
+	return status;
 }
 
-void handle_connection(int const clientFD)
+// Puts together the access log record of the request being answered.
+// Runs before the request is dropped from the buffer, the record takes
+// copies of the bits of it that get logged. It goes to the log with
+// log_access() once the response is done with.
+void prepare_access_record(Worker *const worker, Connection *const conn)
 {
-	char *const requestData = calloc(MAXIMUM_REQUEST_SIZE + 1, sizeof(char));
-	if (requestData == NULL) {
-		perror("handle_connection(): Failed to allocate requestData");
-		send(clientFD, REPLY_500, sizeof(REPLY_500)-1, 0);
-		close(clientFD);
+	Response *const response = pending_response(conn);
+	AccessRecord *const record = arena_allocate(&conn->arena, sizeof(AccessRecord));
+	response->accessRecord = record;
+	if (record == NULL) {
+		if (worker->metrics != NULL)
+			metrics_add(&worker->metrics->accessLogDropped, 1);
 		return;
 	}
+	record->time = worker->dateSecond;
+	record->address = conn->peerAddress;
+	record->status = response_status(response);
 
-	ssize_t const status = recv(clientFD, requestData, MAXIMUM_REQUEST_SIZE, 0);
-	if (status == -1) {
-		perror("handle_connection(): Failed to receive data");
-		send(clientFD, REPLY_500, sizeof(REPLY_500) - 1, 0);
-		close(clientFD);
-		free(requestData);
-		return;
+	// What the parser gave up on may not be a request line at all, so it is
+	// just whatever comes before the first line break
+	size_t const available = conn->requestEnd > 0 ? conn->requestEnd : conn->requestLength;
+	char const *const lineEnd = memchr(conn->request, '\n', available);
+	size_t lineLength = lineEnd != NULL ? (size_t) (lineEnd - conn->request) : available;
+	if (lineLength > 0 && conn->request[lineLength - 1] == '\r')
+		lineLength--;
+	access_record_text(record->requestLine, &record->requestLineLength,
+		ACCESS_LOG_REQUEST_LINE_SIZE, conn->request, lineLength);
+
+	record->refererLength = record->userAgentLength = 0;
+	RequestParser const *const parser = &conn->parser;
+	for (unsigned i = 0; i < parser->headerCount && parser->stage != PARSER_FAILED; i++) {
+		HeaderView const *const header = &parser->headers[i];
+		char const *const value = conn->request + header->value.offset;
+		if (view_equals_ignoring_case(conn->request, header->name, "Referer"))
+			access_record_text(record->referer, &record->refererLength,
+				ACCESS_LOG_HEADER_SIZE, value, header->value.length);
+		else if (view_equals_ignoring_case(conn->request, header->name, "User-Agent"))
+			access_record_text(record->userAgent, &record->userAgentLength,
+				ACCESS_LOG_HEADER_SIZE, value, header->value.length);
 	}
+}
 
-	char *tokState = NULL;
-	char *reqType = strtok_r(requestData, " ", &tokState);
-	if (reqType == NULL) {
-		fprintf(stderr, "handle_connection(): Malformed request type: %s\n", requestData);
-		send(clientFD, REPLY_400, sizeof(REPLY_400) - 1, 0);
-		close(clientFD);
-		free(requestData);
+// Bytes of the response's body that went out, which falls short of all of
+// it when the connection is closed before it was sent
+uint64_t body_bytes_sent(Response const *const response)
+{
+	uint64_t sent = 0;
+	for (unsigned i = response->headerSegments; i < response->segmentsSent; i++)
+		sent += response->segments[i].length;
+	if (response->segmentsSent >= response->headerSegments
+			&& response->segmentsSent < response->segmentCount)
+		sent += response->segmentOffset;
+	return sent;
+}
+
+// Hands the record of a response that is done with to the access log
+void log_access(Worker *const worker, Response const *const response)
+{
+	AccessRecord *const record = access_log_reserve(worker->accessLog);
+	if (record == NULL) {
+		if (worker->metrics != NULL)
+			metrics_add(&worker->metrics->accessLogDropped, 1);
 		return;
 	}
+	*record = *response->accessRecord;
+	record->bytes = body_bytes_sent(response);
+	access_log_commit(worker->accessLog);
+}
 
-	bool headRequest = strncmp(reqType, "HEAD", 5) == 0;
-	bool getRequest = strncmp(reqType, "GET", 4) == 0;
-	if (getRequest || headRequest) {
-		// Get the actual file requested:
-		char *data = strtok_r(NULL, " ", &tokState);
-		trim_right_whitespace(data);
-
-		char *const location = calloc(MAXIMUM_REQUEST_LOCATION_SIZE + 1, sizeof(char));
-		if (location == NULL) {
-			perror("handle_connection(): Failed to allocate location");
-			send(clientFD, REPLY_500, sizeof(REPLY_500) - 1, 0);
-			close(clientFD);
-			free(data);
-			free(requestData);
-			return;
+void count_request(Worker *const worker, Connection *const conn)
+{
+	MetricsMethod method = METRICS_OTHER_METHOD;
+	if (conn->headRequest)
+		method = METRICS_HEAD;
+	else if (conn->parser.stage != PARSER_FAILED
+			&& view_equals(conn->request, conn->parser.method, "GET"))
+		method = METRICS_GET;
+	unsigned const status = metrics_status_index(response_status(pending_response(conn)));
+	metrics_add(&worker->metrics->requests[method][status], 1);
+}
+
+// Whether some of the response is sent from its file rather than memory
+bool response_has_file(Response const *const response)
+{
+	for (unsigned i = 0; i < response->segmentCount; i++) {
+		if (response->segments[i].data == NULL)
+			return true;
+	}
+	return false;
+}
+
+void queue_response(Worker *const worker, Connection *const conn)
+{
+	// Every header is finished off here with what depends on the time and
+	// the connection rather than on what is being sent, in front of the
+	// body that was added already.
+	Response *const response = pending_response(conn);
+	// Streamed files need the chunk buffer, which had better be missing
+	// now than once the header is out
+	if (worker->streamFiles && conn->streamBuffer == NULL && response_has_file(response)) {
+		conn->streamBuffer = arena_allocate(&conn->arena, STREAM_CHUNK_SIZE);
+		if (conn->streamBuffer == NULL) {
+			fprintf(stderr, "queue_response(): No memory for the stream buffer\n");
+			SET_REPLY(conn, 500);
 		}
+	}
+	refresh_date_header(worker);
+	char const *const connection = connection_header(conn);
+	response_add_text(response, worker->dateHeader, worker->dateHeaderLength);
+	response_add_text(response, connection, strlen(connection));
+	response_add_text(response, END, sizeof(END) - 1);
+	if (worker->metrics != NULL)
+		count_request(worker, conn);
+	if (worker->accessLog != NULL)
+		prepare_access_record(worker, conn);
 
-		if (strncmp(data, "/", 2) == 0) {
-			// Redirect / to index.html
-			strncat(location, "./index.html", MAXIMUM_REQUEST_LOCATION_SIZE);
-		} else {
-			// Prepend a ./ just incase they try doing a funny
-			snprintf(location, MAXIMUM_REQUEST_LOCATION_SIZE, "./%s", data);
-
-			// This strips any possible .. comedy
-			char *temp;
-			while ((temp = strstr(location, "..")) != NULL) {
-				temp[0] = '.';
-				temp[1] = '/';
+	response->keepAlive = conn->keepAlive;
+	conn->responseCount++;
+	if (!conn->keepAlive)
+		conn->closing = true;
+
+	// The request has been dealt with, make room for the next one
+	conn->requestLength -= conn->requestEnd;
+	memmove(conn->request, conn->request + conn->requestEnd, conn->requestLength);
+	conn->request[conn->requestLength] = '\0';
+	conn->requestEnd = 0;
+	request_parser_reset(&conn->parser);
+}
+
+void finish_response(Worker *const worker, Connection *const conn)
+{
+	Response *const response = &conn->responses[conn->responseHead];
+	if (response->accessRecord != NULL)
+		log_access(worker, response);
+	if (response->cached != NULL)
+		content_cache_release(worker->content, response->cached);
+	if (response->mapping != NULL)
+		mapping_table_release(worker->mappings, response->mapping);
+	if (response->compressed != NULL)
+		compression_cache_release(worker->compressed, response->compressed);
+	if (response->openFile != NULL)
+		open_file_cache_release(worker->openFiles, response->openFile);
+	else if (response->fileFD != -1)
+		close(response->fileFD);
+	conn->responseHead = (conn->responseHead + 1) % MAXIMUM_PIPELINED_RESPONSES;
+	conn->responseCount--;
+	worker->requestsAnswered++;
+}
+
+void release_responses(Worker *const worker, Connection *const conn)
+{
+	while (conn->responseCount > 0)
+		finish_response(worker, conn);
+}
+
+// Puts a segment at index, moving anything from there on back. Memory
+// that carries straight on from the segment before just lengthens it,
+// which is what happens to text written into the header buffer in a row.
+bool insert_segment(Response *const response, unsigned const index, char const *const data,
+		off_t const fileOffset, size_t const length)
+{
+	if (length == 0)
+		return true;
+	if (index > 0 && data != NULL) {
+		ResponseSegment *const previous = &response->segments[index - 1];
+		if (previous->data != NULL && previous->data + previous->length == data) {
+			previous->length += length;
+			return true;
+		}
+	}
+	if (response->segmentCount == MAXIMUM_RESPONSE_SEGMENTS) {
+		fprintf(stderr, "insert_segment(): Response is made of too many pieces\n");
+		return false;
+	}
+	memmove(&response->segments[index + 1], &response->segments[index],
+		(response->segmentCount - index) * sizeof(ResponseSegment));
+	response->segments[index].data = data;
+	response->segments[index].fileOffset = fileOffset;
+	response->segments[index].length = length;
+	response->segmentCount++;
+	return true;
+}
+
+void response_clear(Response *const response)
+{
+	response->headerLength = 0;
+	response->segmentCount = response->headerSegments = 0;
+}
+
+bool response_add_segment(Response *const response, void const *const data, size_t const length)
+{
+	unsigned const count = response->segmentCount;
+	if (!insert_segment(response, response->headerSegments, data, 0, length))
+		return false;
+	response->headerSegments += response->segmentCount - count;
+	return true;
+}
+
+bool response_add_text(Response *const response, char const *const text, size_t const length)
+{
+	if (length > MAXIMUM_RESPONSE_HEADER_SIZE - response->headerLength) {
+		fprintf(stderr, "response_add_text(): Header does not fit\n");
+		return false;
+	}
+	char *const out = response->header + response->headerLength;
+	memcpy(out, text, length);
+	if (!response_add_segment(response, out, length))
+		return false;
+	response->headerLength += length;
+	return true;
+}
+
+char const *response_vformat(Response *const response, size_t const limit, size_t *const length,
+		char const *const format, va_list arguments)
+{
+	size_t const room = limit > response->headerLength ? limit - response->headerLength : 0;
+	char *const out = response->header + response->headerLength;
+	int const written = vsnprintf(out, room, format, arguments);
+	if (written < 0 || (size_t) written >= room)
+		return NULL;
+	response->headerLength += (size_t) written;
+	*length = (size_t) written;
+	return out;
+}
+
+bool response_add_format(Response *const response, size_t const limit,
+		char const *const format, ...)
+{
+	size_t length;
+	va_list arguments;
+	va_start(arguments, format);
+	char const *const text = response_vformat(response, limit, &length, format, arguments);
+	va_end(arguments);
+	if (text == NULL) {
+		fprintf(stderr, "response_add_format(): Header does not fit\n");
+		return false;
+	}
+	return response_add_segment(response, text, length);
+}
+
+bool response_add_body(Response *const response, void const *const data, size_t const length)
+{
+	return insert_segment(response, response->segmentCount, data, 0, length);
+}
+
+bool response_add_file(Response *const response, off_t const offset, size_t const length)
+{
+	return insert_segment(response, response->segmentCount, NULL, offset, length);
+}
+
+size_t gather_responses(Connection const *const conn, struct iovec *const iov,
+		size_t const maximum, bool *const fileNext)
+{
+	size_t count = 0;
+	*fileNext = false;
+	for (unsigned i = 0; i < conn->responseCount; i++) {
+		Response const *const response =
+			&conn->responses[(conn->responseHead + i) % MAXIMUM_PIPELINED_RESPONSES];
+		for (unsigned j = response->segmentsSent; j < response->segmentCount; j++) {
+			ResponseSegment const *const segment = &response->segments[j];
+			// Nothing after this can go out before the file has
+			if (segment->data == NULL) {
+				*fileNext = true;
+				return count;
 			}
+			if (count == maximum)
+				return count;
+			size_t const offset = j == response->segmentsSent ? response->segmentOffset : 0;
+			iov[count].iov_base = (void *) (segment->data + offset);
+			iov[count].iov_len = segment->length - offset;
+			count++;
+		}
+	}
+	return count;
+}
+
+bool next_file_range(Connection const *const conn, off_t *const offset, size_t *const length)
+{
+	if (conn->responseCount == 0)
+		return false;
+	Response const *const response = &conn->responses[conn->responseHead];
+	if (response->segmentsSent == response->segmentCount)
+		return false;
+	ResponseSegment const *const segment = &response->segments[response->segmentsSent];
+	if (segment->data != NULL)
+		return false;
+	*offset = segment->fileOffset + (off_t) response->segmentOffset;
+	*length = segment->length - response->segmentOffset;
+	return true;
+}
 
-			// Check if the last character is / and redirect to that
-			// directory's index.html
-			if (location[strlen(location) - 1] == '/') {
-				strncat(location, "./index.html", MAXIMUM_REQUEST_LOCATION_SIZE);
+void mark_responses_sent(Worker *const worker, Connection *const conn, size_t sent)
+{
+	if (worker->metrics != NULL)
+		metrics_add(&worker->metrics->bytesSent, sent);
+	while (conn->responseCount > 0) {
+		Response *const response = &conn->responses[conn->responseHead];
+		while (response->segmentsSent < response->segmentCount) {
+			size_t const left = response->segments[response->segmentsSent].length
+				- response->segmentOffset;
+			if (sent < left) {
+				response->segmentOffset += sent;
+				return;
 			}
+			sent -= left;
+			response->segmentsSent++;
+			response->segmentOffset = 0;
 		}
+		if (worker->metrics != NULL)
+			metrics_record_latency(worker->metrics,
+				monotonic_microseconds() - response->started);
+		finish_response(worker, conn);
+	}
+}
 
-		struct stat st;
-		// If stat() errors assume the file does not exist
-		if (stat(location, &st) == -1) {
-			perror("handle_connection(): Could not stat requested file");
-			fprintf(stderr, "File requested: %s\n", location);
-			send(clientFD, REPLY_404, sizeof(REPLY_404) - 1, 0);
-			close(clientFD);
-			free(requestData);
-			free(location);
-			return;
+bool next_stream_chunk(Connection *const conn, off_t *const offset, size_t *const length)
+{
+	if (!next_file_range(conn, offset, length) || conn->streamBuffer == NULL)
+		return false;
+	if (*length > STREAM_CHUNK_SIZE)
+		*length = STREAM_CHUNK_SIZE;
+	return true;
+}
+
+void mark_stream_sent(Worker *const worker, Connection *const conn, size_t const sent)
+{
+	conn->streamSent += sent;
+	if (conn->streamSent == conn->streamLength)
+		conn->streamLength = conn->streamSent = 0;
+	mark_responses_sent(worker, conn, sent);
+}
+
+void set_reply(Connection *const conn, char const *const status, char const *const body,
+		size_t const length)
+{
+	// Replaces whatever was put together before things went wrong
+	Response *const response = pending_response(conn);
+	response_clear(response);
+	response_add_format(response, MAXIMUM_FILE_HEADER_SIZE,
+		"HTTP/1.1 %s\r\nContent-Length: %lu\r\nContent-Type: text/html\r\n",
+		status, (unsigned long) length);
+	if (!conn->headRequest)
+		response_add_body(response, body, length);
+}
+
+// Works out from the request version and Connection headers whether the
+// client wants to send more requests over this connection.
+void parse_connection_options(Connection *const conn)
+{
+	RequestParser const *const parser = &conn->parser;
+	char const *const request = conn->request;
+
+	bool const http10 = view_equals(request, parser->version, "HTTP/1.0");
+	conn->http11 = !http10;
+	conn->keepAlive = conn->http11;
+
+	for (unsigned i = 0; i < parser->headerCount; i++) {
+		HeaderView const *const header = &parser->headers[i];
+		if (!view_equals_ignoring_case(request, header->name, "Connection"))
+			continue;
+
+		// A comma separated list of options, only these two matter
+		size_t position = header->value.offset;
+		size_t const end = position + header->value.length;
+		while (position < end) {
+			while (position < end && (request[position] == ' '
+					|| request[position] == '\t' || request[position] == ','))
+				position++;
+			size_t optionEnd = position;
+			while (optionEnd < end && request[optionEnd] != ','
+					&& request[optionEnd] != ' ' && request[optionEnd] != '\t')
+				optionEnd++;
+			TextView const option = { (uint16_t) position, (uint16_t) (optionEnd - position) };
+			if (view_equals_ignoring_case(request, option, "close"))
+				conn->keepAlive = false;
+			else if (view_equals_ignoring_case(request, option, "keep-alive"))
+				conn->keepAlive = true;
+			position = optionEnd + 1;
 		}
+	}
+}
 
-		// If this returns null its most likely an
-		// internal error as the stat check passed
-		FILE *const file = fopen(location, "r");
-		if (file == NULL) {
-			perror("handle_connection(): Could not fopen requested file");
-			fprintf(stderr, "File requested: %s\n", location);
-			send(clientFD, REPLY_500, sizeof(REPLY_500) - 1, 0);
-			close(clientFD);
-			free(requestData);
-			free(location);
-			return;
+// Returns the status to refuse a GET or HEAD request that announces a body
+// with, or 0 if it does not. The body is never read, so on a connection
+// that stays open it would be taken for the next request, which is how
+// requests get smuggled past proxies that do read it.
+unsigned body_framing_error(Connection const *const conn)
+{
+	RequestParser const *const parser = &conn->parser;
+	for (unsigned i = 0; i < parser->headerCount; i++) {
+		HeaderView const *const header = &parser->headers[i];
+		if (view_equals_ignoring_case(conn->request, header->name, "Transfer-Encoding"))
+			return 501;
+		// Some clients send an explicitly empty body
+		if (view_equals_ignoring_case(conn->request, header->name, "Content-Length")
+				&& !view_equals(conn->request, header->value, "0"))
+			return 400;
+	}
+	return 0;
+}
+
+// Answers a request the parser gave up on
+void reject_request(Worker *const worker, Connection *const conn)
+{
+	if (worker->accessLog == NULL)
+		fprintf(stderr, "reject_request(): Malformed request, answering with %u\n",
+			conn->parser.error);
+	switch (conn->parser.error) {
+	case 414:
+		SET_REPLY(conn, 414);
+		break;
+	case 431:
+		SET_REPLY(conn, 431);
+		break;
+	case 505:
+		SET_REPLY(conn, 505);
+		break;
+	default:
+		SET_REPLY(conn, 400);
+		break;
+	}
+}
+
+bool resolve_request(Worker *const worker, Connection *const conn, char *const location)
+{
+	RequestParser const *const parser = &conn->parser;
+	char const *const request = conn->request;
+
+	conn->requestCount++;
+	conn->headRequest = false;
+	conn->encoding = ENCODING_IDENTITY;
+	conn->sidecar = false;
+	conn->varyEncoding = false;
+	if (parser->stage == PARSER_FAILED) {
+		// Where this request ends and the next begins is anyone's guess
+		conn->keepAlive = false;
+		reject_request(worker, conn);
+		return false;
+	}
+
+	parse_connection_options(conn);
+	if (worker->idleTimeout == 0 || worker->draining
+			|| conn->requestCount >= worker->maxConnectionRequests)
+		conn->keepAlive = false;
+
+	conn->headRequest = view_equals(request, parser->method, "HEAD");
+	bool const getRequest = view_equals(request, parser->method, "GET");
+	if (!getRequest && !conn->headRequest) {
+		if (worker->accessLog == NULL)
+			fprintf(stderr, "resolve_request(): Client sent a %.*s request, "
+				"for which handling is unimplemented\n",
+				(int) parser->method.length, request + parser->method.offset);
+		// Whatever body came with it would be mistaken for the next request
+		conn->keepAlive = false;
+		SET_REPLY(conn, 501);
+		return false;
+	}
+	switch (body_framing_error(conn)) {
+	case 400:
+		conn->keepAlive = false;
+		SET_REPLY(conn, 400);
+		return false;
+	case 501:
+		conn->keepAlive = false;
+		SET_REPLY(conn, 501);
+		return false;
+	}
+
+	TextView const target = parser->target;
+	if (worker->metricsPath != NULL && view_equals(request, target, worker->metricsPath)) {
+		add_metrics_response(worker, conn);
+		return false;
+	}
+	if (!build_location(location, request + target.offset, target.length)) {
+		if (worker->accessLog == NULL)
+			fprintf(stderr, "resolve_request(): Requested path is too long\n");
+		SET_REPLY(conn, 414);
+		return false;
+	}
+	// Files checked recently go straight to their sidecar, anything else
+	// waits for the file's own stat() to show it exists
+	unsigned sidecars;
+	if (worker->sidecars != NULL && sidecar_table_recent(worker->sidecars, location, &sidecars))
+		choose_sidecar(conn, location, sidecars);
+	return true;
+}
+
+void add_metrics_response(Worker *const worker, Connection *const conn)
+{
+	// Scrapes are rare enough that putting the text together from every
+	// worker's counters each time costs nothing worth keeping them for.
+	// It is put together in the worker's buffer and only what it came to
+	// is kept in the arena, which pipelined requests share.
+	size_t const length = metrics_format(worker->allMetrics, worker->metricsText,
+			METRICS_MAXIMUM_SIZE);
+	if (length == 0) {
+		fprintf(stderr, "add_metrics_response(): Metrics did not fit in the response\n");
+		SET_REPLY(conn, 500);
+		return;
+	}
+	char *const body = arena_allocate(&conn->arena, length);
+	if (body == NULL) {
+		SET_REPLY(conn, 500);
+		return;
+	}
+	memcpy(body, worker->metricsText, length);
+	Response *const response = pending_response(conn);
+	response_add_format(response, MAXIMUM_FILE_HEADER_SIZE,
+		REPLY_200 "Content-Length: %zu\r\n"
+		"Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+		"Cache-Control: no-store\r\n", length);
+	if (!conn->headRequest)
+		response_add_body(response, body, length);
+}
+
+bool choose_sidecar(Connection *const conn, char *const location, unsigned const sidecars)
+{
+	if (sidecars == 0)
+		return false;
+	conn->varyEncoding = true;
+
+	HeaderView const *const acceptEncoding = find_header(&conn->parser, conn->request,
+			"Accept-Encoding");
+	if (acceptEncoding == NULL)
+		return false;
+	ContentEncoding const encoding = pick_encoding(parse_accept_encoding(
+			conn->request + acceptEncoding->value.offset, acceptEncoding->value.length),
+			sidecars);
+	if (encoding == ENCODING_IDENTITY)
+		return false;
+	size_t const length = strlen(location);
+	char const *const suffix = encoding_suffix(encoding);
+	if (length + strlen(suffix) > MAXIMUM_REQUEST_LOCATION_SIZE)
+		return false;
+	strcpy(location + length, suffix);
+	conn->encoding = encoding;
+	conn->sidecar = true;
+	return true;
+}
+
+bool negotiate_encoding(Worker *const worker, Connection *const conn, char *const location,
+		struct stat const *const st)
+{
+	if (worker->sidecars == NULL || conn->sidecar)
+		return false;
+	unsigned sidecars;
+	if (!sidecar_table_find(worker->sidecars, location, st, &sidecars)) {
+		sidecars = find_sidecars(location);
+		sidecar_table_store(worker->sidecars, location, st, sidecars);
+	}
+	return choose_sidecar(conn, location, sidecars);
+}
+
+bool use_original_file(Worker *const worker, Connection *const conn, char *const location)
+{
+	if (!conn->sidecar)
+		return false;
+	location[strlen(location) - strlen(encoding_suffix(conn->encoding))] = '\0';
+	sidecar_table_forget(worker->sidecars, location, conn->encoding);
+	conn->encoding = ENCODING_IDENTITY;
+	conn->sidecar = false;
+	return true;
+}
+
+char const *content_type(Connection const *const conn, char const *const location)
+{
+	if (!conn->sidecar)
+		return get_mime_type(location);
+	char original[MAXIMUM_REQUEST_LOCATION_SIZE + 1];
+	size_t const length = strlen(location) - strlen(encoding_suffix(conn->encoding));
+	memcpy(original, location, length);
+	original[length] = '\0';
+	return get_mime_type(original);
+}
+
+char const *vary_header(Connection const *const conn)
+{
+	return conn->varyEncoding ? "Vary: Accept-Encoding\r\n" : "";
+}
+
+size_t format_etag(char *const out, size_t const size, off_t const fileSize,
+		struct timespec const modified)
+{
+	int const length = snprintf(out, size, "\"%lx-%lx-%lx\"", (unsigned long) modified.tv_sec,
+			(unsigned long) modified.tv_nsec, (unsigned long) fileSize);
+	if (length < 0 || (size_t) length >= size)
+		return 0;
+	return (size_t) length;
+}
+
+// Last-Modified and ETag, what requests can check their copy against
+size_t format_validators(char *const out, size_t const size, off_t const fileSize,
+		struct timespec const modified)
+{
+	char lastModified[64];
+	char etag[64];
+	size_t const dateLength = format_http_date(lastModified, sizeof(lastModified),
+			modified.tv_sec);
+	size_t const etagLength = format_etag(etag, sizeof(etag), fileSize, modified);
+	int const length = snprintf(out, size, "Last-Modified: %.*s\r\nETag: %.*s\r\n",
+			(int) dateLength, lastModified, (int) etagLength, etag);
+	if (length < 0 || (size_t) length >= size)
+		return 0;
+	return (size_t) length;
+}
+
+size_t format_file_header(char *const out, size_t const size, Connection const *const conn,
+		char const *const location, off_t const fileSize, struct timespec const modified)
+{
+	char validators[128];
+	if (format_validators(validators, sizeof(validators), fileSize, modified) == 0)
+		return 0;
+	int const length = snprintf(out, size,
+			REPLY_200 "Content-Length: %lld\r\n%s%s%sAccept-Ranges: bytes\r\n%s",
+			(long long) fileSize, content_type(conn, location),
+			encoding_header(conn->encoding), vary_header(conn), validators);
+	if (length < 0 || (size_t) length >= size)
+		return 0;
+	return (size_t) length;
+}
+
+bool build_file_header(Connection *const conn, char const *const location, off_t const size,
+		struct timespec const modified)
+{
+	Response *const response = pending_response(conn);
+	size_t const headerLength = format_file_header(response->header + response->headerLength,
+			MAXIMUM_FILE_HEADER_SIZE - response->headerLength, conn, location, size, modified);
+	if (headerLength == 0
+			|| !response_add_segment(response, response->header + response->headerLength,
+				headerLength)) {
+		fprintf(stderr, "build_file_header(): Header too long for file %s\n", location);
+		SET_REPLY(conn, 500);
+		return false;
+	}
+	response->headerLength += headerLength;
+	return true;
+}
+
+bool add_file_header(Connection *const conn, char **const header, size_t *const headerLength,
+		char const *const location, off_t const size, struct timespec const modified)
+{
+	if (header == NULL)
+		return build_file_header(conn, location, size, modified);
+
+	Response *const response = pending_response(conn);
+	if (*header == NULL) {
+		size_t const start = response->headerLength;
+		if (!build_file_header(conn, location, size, modified))
+			return false;
+		// Not being able to keep it only means building it again next time
+		*header = malloc(response->headerLength - start);
+		if (*header != NULL) {
+			memcpy(*header, response->header + start, response->headerLength - start);
+			*headerLength = response->headerLength - start;
 		}
+		return true;
+	}
+	// HEAD responses let go of the entry straight away, so they can't
+	// point at its copy
+	if (conn->headRequest)
+		return response_add_text(response, *header, *headerLength);
+	return response_add_segment(response, *header, *headerLength);
+}
 
-		char *buffer = NULL;
-		if (!headRequest) {
-			buffer = calloc((uint64_t) st.st_size + 1, sizeof(char));
-			// If we cannot allocate the buffer thats an internal server error
-			if (buffer == NULL) {
-				perror("handle_connection(): Could not allocate file buffer");
-				fprintf(stderr, "File requested: %s\n", location);
-				send(clientFD, REPLY_500, sizeof(REPLY_500) - 1, 0);
-				close(clientFD);
-				free(requestData);
-				free(location);
-				return;
-			}
-			if (fread(buffer, sizeof(char), (size_t) st.st_size, file) != (size_t) st.st_size) {
-				bool foundProblem = false;
-				if (feof(file)) {
-					perror("handle_connection(): fread returned shorter than stat expected");
-					foundProblem = true;
-				}
-				if (ferror(file)) {
-					perror("handle_connection(): fread errored");
-					foundProblem = true;
+// Whether the comma separated list of entity tags in an If-None-Match
+// value has etag in it. Weak tags match their strong counterpart, as
+// revalidating only needs the copies to be interchangeable.
+bool entity_tag_listed(char const *const value, size_t const length, char const *const etag,
+		size_t const etagLength)
+{
+	size_t i = 0;
+	while (i < length) {
+		while (i < length && (value[i] == ' ' || value[i] == '\t' || value[i] == ','))
+			i++;
+		if (i == length)
+			break;
+		if (value[i] == '*')
+			return true;
+		if (length - i >= 2 && value[i] == 'W' && value[i + 1] == '/')
+			i += 2;
+		size_t const start = i;
+		// The tag is quoted, so the first comma after its closing quote
+		// ends it
+		if (i < length && value[i] == '"') {
+			i++;
+			while (i < length && value[i] != '"')
+				i++;
+			if (i < length)
+				i++;
+		}
+		if (i - start == etagLength && memcmp(value + start, etag, etagLength) == 0)
+			return true;
+		while (i < length && value[i] != ',')
+			i++;
+	}
+	return false;
+}
+
+// Reads an HTTP date like the ones format_http_date() writes, returning
+// false when it is anything else
+bool parse_http_date(char const *const value, size_t const length, time_t *const result)
+{
+	char date[64];
+	if (length >= sizeof(date))
+		return false;
+	memcpy(date, value, length);
+	date[length] = '\0';
+	struct tm tm;
+	memset(&tm, 0, sizeof(tm));
+	char const *const end = strptime(date, "%a, %d %b %Y %H:%M:%S GMT", &tm);
+	if (end == NULL || *end != '\0')
+		return false;
+	*result = timegm(&tm);
+	return true;
+}
+
+bool client_copy_current(Connection const *const conn, off_t const size,
+		struct timespec const modified)
+{
+	// If-None-Match is the more precise of the two, so it wins when a
+	// request has both
+	HeaderView const *const ifNoneMatch = find_header(&conn->parser, conn->request,
+			"If-None-Match");
+	if (ifNoneMatch != NULL) {
+		char etag[64];
+		size_t const etagLength = format_etag(etag, sizeof(etag), size, modified);
+		return etagLength > 0 && entity_tag_listed(conn->request + ifNoneMatch->value.offset,
+				ifNoneMatch->value.length, etag, etagLength);
+	}
+	HeaderView const *const ifModifiedSince = find_header(&conn->parser, conn->request,
+			"If-Modified-Since");
+	if (ifModifiedSince == NULL)
+		return false;
+	time_t since;
+	if (!parse_http_date(conn->request + ifModifiedSince->value.offset,
+			ifModifiedSince->value.length, &since))
+		return false;
+	return modified.tv_sec <= since;
+}
+
+bool add_not_modified(Connection *const conn, off_t const size, struct timespec const modified)
+{
+	if (!client_copy_current(conn, size, modified))
+		return false;
+	Response *const response = pending_response(conn);
+	char validators[128];
+	if (format_validators(validators, sizeof(validators), size, modified) == 0)
+		return false;
+	response_clear(response);
+	response_add_format(response, MAXIMUM_FILE_HEADER_SIZE, REPLY_304 "%s%s",
+		vary_header(conn), validators);
+	return true;
+}
+
+bool range_requested(Connection const *const conn)
+{
+	return !conn->headRequest && find_header(&conn->parser, conn->request, "Range") != NULL;
+}
+
+// Works out which parts of the file the request wants. Ranges are only a
+// thing for GET, and If-Range drops them when the client's copy is of some
+// other version of the file.
+RangeStatus requested_ranges(Connection const *const conn, off_t const size,
+		struct timespec const modified, ByteRange *const ranges, unsigned *const count)
+{
+	*count = 0;
+	if (conn->headRequest)
+		return RANGES_IGNORED;
+	HeaderView const *const range = find_header(&conn->parser, conn->request, "Range");
+	if (range == NULL)
+		return RANGES_IGNORED;
+
+	HeaderView const *const ifRange = find_header(&conn->parser, conn->request, "If-Range");
+	if (ifRange != NULL) {
+		// Entity tags are compared with the ETag and anything else is a
+		// date compared with Last-Modified. Weak tags never match.
+		char validator[64];
+		char const first = conn->request[ifRange->value.offset];
+		if (first == '"' || first == 'W')
+			format_etag(validator, sizeof(validator), size, modified);
+		else
+			format_http_date(validator, sizeof(validator), modified.tv_sec);
+		if (!view_equals(conn->request, ifRange->value, validator))
+			return RANGES_IGNORED;
+	}
+	return parse_byte_ranges(conn->request + range->value.offset, range->value.length, size,
+			ranges, count);
+}
+
+bool add_file_part(Response *const response, char const *const data, off_t const offset,
+		size_t const length)
+{
+	if (data != NULL)
+		return response_add_body(response, data + offset, length);
+	return response_add_file(response, offset, length);
+}
+
+// Adds a 206 response for the ranges, with a multipart/byteranges body
+// when there is more than one. Returns false, leaving the response half
+// built, if it does not fit.
+bool add_ranges(Connection *const conn, char const *const location, off_t const size,
+		struct timespec const modified, char const *const data, ByteRange const *const ranges,
+		unsigned const count)
+{
+	Response *const response = pending_response(conn);
+	char validators[128];
+	if (format_validators(validators, sizeof(validators), size, modified) == 0)
+		return false;
+	char const *const mime = content_type(conn, location);
+
+	if (count == 1) {
+		off_t const length = ranges[0].last - ranges[0].first + 1;
+		return response_add_format(response, MAXIMUM_FILE_HEADER_SIZE,
+				REPLY_206 "Content-Range: bytes %lld-%lld/%lld\r\nContent-Length: %lld\r\n"
+				"%s%s%s%s",
+				(long long) ranges[0].first, (long long) ranges[0].last, (long long) size,
+				(long long) length, mime, encoding_header(conn->encoding), vary_header(conn),
+				validators)
+			&& add_file_part(response, data, ranges[0].first, (size_t) length);
+	}
+	// The coding would be of the multipart body rather than of the parts,
+	// so several ranges of a sidecar get all of it instead
+	if (conn->encoding != ENCODING_IDENTITY)
+		return false;
+
+	// Only has to be unlikely to turn up in the file
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	char boundary[32];
+	snprintf(boundary, sizeof(boundary), "%08lx%08lx", (unsigned long) now.tv_nsec,
+		(unsigned long) now.tv_sec ^ (unsigned long) conn->fd);
+
+	// Every part starts the same apart from its Content-Range, so they all
+	// point at one copy of that. The text between the parts lives in the
+	// connection's arena until the response has been sent.
+	size_t introLength;
+	char const *const intro = arena_format(&conn->arena, &introLength,
+			"\r\n--%s\r\n%sContent-Range: bytes ", boundary, mime);
+	if (intro == NULL)
+		return false;
+	off_t contentLength = 0;
+	for (unsigned i = 0; i < count; i++) {
+		off_t const length = ranges[i].last - ranges[i].first + 1;
+		size_t rangeLength;
+		char const *const range = arena_format(&conn->arena, &rangeLength,
+				"%lld-%lld/%lld\r\n\r\n", (long long) ranges[i].first,
+				(long long) ranges[i].last, (long long) size);
+		if (range == NULL || !response_add_body(response, intro, introLength)
+				|| !response_add_body(response, range, rangeLength)
+				|| !add_file_part(response, data, ranges[i].first, (size_t) length))
+			return false;
+		contentLength += (off_t) (introLength + rangeLength) + length;
+	}
+	size_t endLength;
+	char const *const end = arena_format(&conn->arena, &endLength, "\r\n--%s--\r\n", boundary);
+	if (end == NULL || !response_add_body(response, end, endLength))
+		return false;
+	contentLength += (off_t) endLength;
+
+	return response_add_format(response, MAXIMUM_FILE_HEADER_SIZE,
+			REPLY_206 "Content-Type: multipart/byteranges; boundary=%s\r\n"
+			"Content-Length: %lld\r\n%s%s",
+			boundary, (long long) contentLength, vary_header(conn), validators);
+}
+
+bool add_file_response(Connection *const conn, char const *const location, off_t const size,
+		struct timespec const modified, char const *const data, char **const header,
+		size_t *const headerLength)
+{
+	if (add_not_modified(conn, size, modified))
+		return false;
+
+	Response *const response = pending_response(conn);
+	ByteRange ranges[MAXIMUM_RANGES];
+	unsigned rangeCount;
+	RangeStatus const status = requested_ranges(conn, size, modified, ranges, &rangeCount);
+	if (status == RANGES_UNSATISFIABLE) {
+		SET_REPLY(conn, 416);
+		response_add_format(response, MAXIMUM_FILE_HEADER_SIZE, "Content-Range: bytes */%lld\r\n",
+			(long long) size);
+		return false;
+	}
+	if (status == RANGES_SATISFIABLE) {
+		if (add_ranges(conn, location, size, modified, data, ranges, rangeCount))
+			return true;
+		// Sending the whole file is always allowed instead
+		response_clear(response);
+	}
+
+	if (!add_file_header(conn, header, headerLength, location, size, modified)
+			|| conn->headRequest)
+		return false;
+	return add_file_part(response, data, 0, (size_t) size);
+}
+
+// Tells apart the different headers one file can be sent with, as the
+// sidecar of the requested file or as itself
+unsigned header_variant(Connection const *const conn)
+{
+	return (unsigned) conn->encoding << 1 | conn->varyEncoding;
+}
+
+void use_cached_content(Worker *const worker, Connection *const conn,
+		CachedContent *const cached, char const *const location)
+{
+	if (cached->header == NULL)
+		cached->headerVariant = header_variant(conn);
+	bool const keptHeader = cached->headerVariant == header_variant(conn);
+	if (!add_file_response(conn, location, cached->size, cached->modified, cached->data,
+			keptHeader ? &cached->header : NULL, &cached->headerLength)) {
+		content_cache_release(worker->content, cached);
+		return;
+	}
+	pending_response(conn)->cached = cached;
+}
+
+void use_mapped_file(Worker *const worker, Connection *const conn,
+		MappedFile *const mapping, char const *const location)
+{
+	if (mapping->header == NULL)
+		mapping->headerVariant = header_variant(conn);
+	bool const keptHeader = mapping->headerVariant == header_variant(conn);
+	if (!add_file_response(conn, location, mapping->size, mapping->modified, mapping->data,
+			keptHeader ? &mapping->header : NULL, &mapping->headerLength)) {
+		mapping_table_release(worker->mappings, mapping);
+		return;
+	}
+	pending_response(conn)->mapping = mapping;
+}
+
+// Types that are text underneath and shrink well, going by the
+// Content-Type header get_mime_type() returns
+bool compressible_type(char const *const contentType)
+{
+	static char const *const compressible[] = {
+		"Content-Type: text/", "javascript", "json", "xml", "wasm"
+	};
+	for (size_t i = 0; i < sizeof(compressible) / sizeof(compressible[0]); i++) {
+		if (strstr(contentType, compressible[i]) != NULL)
+			return true;
+	}
+	return false;
+}
+
+bool use_compressed_variant(Worker *const worker, Connection *const conn,
+		char const *const location, off_t const size, struct timespec const modified)
+{
+	// Files with sidecars are left to those
+	if (worker->compressed == NULL || conn->varyEncoding
+			|| size < MINIMUM_COMPRESSED_FILE_SIZE || size > MAXIMUM_COMPRESSED_FILE_SIZE
+			|| !compressible_type(get_mime_type(location)))
+		return false;
+	conn->varyEncoding = true;
+
+	HeaderView const *const acceptEncoding = find_header(&conn->parser, conn->request,
+			"Accept-Encoding");
+	if (acceptEncoding == NULL)
+		return false;
+	unsigned const accepted = parse_accept_encoding(conn->request
+			+ acceptEncoding->value.offset, acceptEncoding->value.length);
+	ContentEncoding encoding;
+	if (accepted & ENCODING_BIT(ENCODING_GZIP))
+		encoding = ENCODING_GZIP;
+	else if (accepted & ENCODING_BIT(ENCODING_DEFLATE))
+		encoding = ENCODING_DEFLATE;
+	else
+		return false;
+
+	CompressedVariant *const variant = compression_cache_lookup(worker->compressed, location,
+			encoding, size, modified);
+	if (variant == NULL)
+		return false;
+	conn->encoding = encoding;
+	if (variant->header == NULL)
+		variant->headerVariant = header_variant(conn);
+	bool const keptHeader = variant->headerVariant == header_variant(conn);
+	if (!add_file_response(conn, location, (off_t) variant->size, modified, variant->data,
+			keptHeader ? &variant->header : NULL, &variant->headerLength)) {
+		compression_cache_release(worker->compressed, variant);
+		return true;
+	}
+	pending_response(conn)->compressed = variant;
+	return true;
+}
+
+// Answers the request with the file at location, leaving it in the
+// pending response
+void fill_file_response(Worker *const worker, Connection *const conn, char *const location)
+{
+	// Ranges are sent from the file, so only the bytes asked for get read,
+	// unless the whole file happens to be in memory already.
+	bool const wholeFile = !conn->headRequest && !range_requested(conn);
+
+	struct stat st;
+	bool haveStat = false;
+
+	// Cache hits skip the file system entirely until the entry is due for
+	// another look at the file.
+	if (worker->content != NULL) {
+		bool needsCheck = false;
+		CachedContent *const cached = content_cache_lookup(worker->content, location, &needsCheck);
+		if (cached != NULL) {
+			if (needsCheck) {
+				haveStat = stat(location, &st) == 0;
+				if (!haveStat)
+					content_cache_evict(worker->content, cached);
+				if (!haveStat || !content_cache_revalidate(worker->content, cached, &st)) {
+					content_cache_release(worker->content, cached);
+					needsCheck = true;
+				} else {
+					needsCheck = false;
 				}
-				if (!foundProblem) {
-					perror("handle_connection(): fread had unknown file error without setting feof() or ferror()");
+			}
+			count_content_lookup(worker, !needsCheck);
+			if (!needsCheck) {
+				struct stat cachedStat;
+				cached_content_stat(cached, &cachedStat);
+				if (negotiate_encoding(worker, conn, location, &cachedStat)) {
+					content_cache_release(worker->content, cached);
+					fill_file_response(worker, conn, location);
+					return;
 				}
-				fprintf(stderr, "fread failed for file %s\n", location);
-				// Clean up and don't give the client the
-				// partial data, just in case they found an exploit.
-				fclose(file);
-				send(clientFD, REPLY_500, sizeof(REPLY_500) - 1, 0);
-				close(clientFD);
-				free(buffer);
-				free(requestData);
-				free(location);
+				if (use_compressed_variant(worker, conn, location, cached->size,
+						cached->modified))
+					content_cache_release(worker->content, cached);
+				else
+					use_cached_content(worker, conn, cached, location);
 				return;
 			}
-			fclose(file);
+		} else {
+			count_content_lookup(worker, false);
+		}
+	}
+
+	// A cached open file comes with its stat(), and the response holds on
+	// to it from here on whatever it ends up sending
+	if (!haveStat && worker->openFiles != NULL) {
+		OpenFile *const openFile = open_file_cache_acquire(worker->openFiles, location);
+		if (openFile != NULL) {
+			pending_response(conn)->openFile = openFile;
+			st = openFile->st;
+			haveStat = true;
+		} else if (errno != ENOENT && errno != ENOTDIR) {
+			// Out of descriptors or not allowed to open it, which does not
+			// mean it isn't there. Going the way it would without the
+			// cache answers those the same as without it.
+			haveStat = stat(location, &st) == 0;
 		}
+	} else if (!haveStat) {
+		haveStat = stat(location, &st) == 0;
+	}
 
-		char *const mime = get_mime_type(location);
-		// Reuse the location buffer to store the Content-Length header,
-		// to prevent a second alloc. Assigned to new variable name so
-		// it still makes sense.
-		char *const header = location;
-		snprintf(header, MAXIMUM_REQUEST_LOCATION_SIZE,
-				"Content-Length: %lu\r\n", st.st_size);
-
-		send(clientFD, REPLY_200, sizeof(REPLY_200) - 1, MSG_MORE);
-		send(clientFD, header,    strlen(location),      MSG_MORE);
-		send(clientFD, mime,      strlen(mime),          MSG_MORE);
-		if (!headRequest) {
-			send(clientFD, END, sizeof(END) - 1, MSG_MORE);
-			send(clientFD, buffer, (size_t)st.st_size, 0);
-		} else {
-			send(clientFD, END, sizeof(END) - 1, 0);
+	// If stat() errors assume the file does not exist
+	if (!haveStat) {
+		// The sidecar went away since it was looked for
+		if (use_original_file(worker, conn, location)) {
+			fill_file_response(worker, conn, location);
+			return;
+		}
+		// The access log has these already, without the event loop
+		// waiting on stderr for every scanner probing for files
+		if (worker->accessLog == NULL) {
+			perror("fill_file_response(): Could not stat requested file");
+			fprintf(stderr, "File requested: %s\n", location);
 		}
+		SET_REPLY(conn, 404);
+		return;
+	}
 
-		close(clientFD);
-		free(buffer);
-		// Note that this also frees location, since they are the same
-		// pointer.
-		free(header);
-		free(mime);
-		free(requestData);
+	// Anything else would only fail halfway through sendfile(), after
+	// the header already went out.
+	if (!S_ISREG(st.st_mode)) {
+		fprintf(stderr, "fill_file_response(): Requested file is not a regular file: %s\n",
+			location);
+		SET_REPLY(conn, 500);
 		return;
 	}
-	fprintf(stderr,
-		"handle_connection(): Client sent a %s request, for which handling is unimplemented\n",
-		reqType);
-	send(clientFD, REPLY_501, sizeof(REPLY_501) - 1, 0);
-	close(clientFD);
-	free(requestData);
+
+	// Sidecars are only looked for next to files that exist
+	if (negotiate_encoding(worker, conn, location, &st)) {
+		Response *const response = pending_response(conn);
+		if (response->openFile != NULL) {
+			open_file_cache_release(worker->openFiles, response->openFile);
+			response->openFile = NULL;
+		}
+		fill_file_response(worker, conn, location);
+		return;
+	}
+
+	if (use_compressed_variant(worker, conn, location, st.st_size, st.st_mtim))
+		return;
+	// Nothing of the file has to be read for a 304
+	if (add_not_modified(conn, st.st_size, st.st_mtim))
+		return;
+
+	if (worker->content != NULL && wholeFile) {
+		CachedContent *const cached = content_cache_admit(worker->content, location, &st);
+		if (cached != NULL) {
+			use_cached_content(worker, conn, cached, location);
+			return;
+		}
+	}
+
+	// Hot files are sent straight from a mapping shared with every other
+	// request for them, anything that can't be mapped goes out with
+	// sendfile() instead.
+	if (worker->mappings != NULL && wholeFile) {
+		MappedFile *const mapping = mapping_table_acquire(worker->mappings, location, &st);
+		if (mapping != NULL) {
+			use_mapped_file(worker, conn, mapping, location);
+			return;
+		}
+	}
+
+	OpenFile const *const openFile = pending_response(conn)->openFile;
+	if (openFile != NULL) {
+		if (add_file_response(conn, location, st.st_size, st.st_mtim, NULL, NULL, NULL))
+			pending_response(conn)->fileFD = openFile->fd;
+		return;
+	}
+
+	// If this fails its most likely an
+	// internal error as the stat check passed
+	int const fileFD = open(location, O_RDONLY | O_CLOEXEC);
+	if (fileFD == -1) {
+		perror("fill_file_response(): Could not open requested file");
+		fprintf(stderr, "File requested: %s\n", location);
+		SET_REPLY(conn, 500);
+		return;
+	}
+
+	if (!add_file_response(conn, location, st.st_size, st.st_mtim, NULL, NULL, NULL)) {
+		close(fileFD);
+		return;
+	}
+	pending_response(conn)->fileFD = fileFD;
+}
+
+// Works out the answer to the request, leaving it in the pending response
+void fill_response(Worker *const worker, Connection *const conn)
+{
+	char location[MAXIMUM_REQUEST_LOCATION_SIZE + 1];
+	if (resolve_request(worker, conn, location))
+		fill_file_response(worker, conn, location);
+}
+
+void prepare_response(Worker *const worker, Connection *const conn)
+{
+	begin_response(worker, conn);
+	fill_response(worker, conn);
+	queue_response(worker, conn);
+}
+
+long long monotonic_milliseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+long long monotonic_microseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+void count_content_lookup(Worker *const worker, bool const hit)
+{
+	if (worker->metrics != NULL)
+		metrics_add(hit ? &worker->metrics->contentCacheHits
+			: &worker->metrics->contentCacheMisses, 1);
+}
+
+void mark_connection_idle(Worker *const worker, Connection *const conn, long long const now)
+{
+	if (conn->idle)
+		return;
+	conn->idle = true;
+	// Waiting costs no memory beyond the connection itself, the next
+	// request gets a slab again when it needs one
+	arena_release(&conn->arena);
+	conn->streamBuffer = NULL;
+	// Without keep-alive only the first request is waited for, and that
+	// has never had a time limit.
+	conn->idleDeadline = worker->idleTimeout > 0 ? now + worker->idleTimeout : LLONG_MAX;
+	conn->idleNewer = NULL;
+	conn->idleOlder = worker->idleNewest;
+	if (worker->idleNewest != NULL)
+		worker->idleNewest->idleNewer = conn;
+	else
+		worker->idleOldest = conn;
+	worker->idleNewest = conn;
+}
+
+void mark_connection_busy(Worker *const worker, Connection *const conn)
+{
+	if (!conn->idle)
+		return;
+	conn->idle = false;
+	if (conn->idleNewer != NULL)
+		conn->idleNewer->idleOlder = conn->idleOlder;
+	else
+		worker->idleNewest = conn->idleOlder;
+	if (conn->idleOlder != NULL)
+		conn->idleOlder->idleNewer = conn->idleNewer;
+	else
+		worker->idleOldest = conn->idleNewer;
+	conn->idleNewer = conn->idleOlder = NULL;
 }
 
-int main()
+// Creates the socket clients connect to. With reusePort set, several
+// sockets can be bound to the same port and the kernel spreads incoming
+// connections between them. Returns -1 on failure.
+int create_listener(bool const reusePort)
 {
 	int const socketFD = socket(AF_INET, SOCK_STREAM, 0);
+	if (socketFD == -1) {
+		perror("create_listener(): socket() errored");
+		return -1;
+	}
 
 	// Unfortunately required to setup the sockets.
 	{
 		int const optVal = 1;
 		setsockopt(socketFD, SOL_SOCKET, SO_REUSEADDR, (void const*)&optVal, sizeof(optVal));
+		if (reusePort && setsockopt(socketFD, SOL_SOCKET, SO_REUSEPORT,
+					(void const*)&optVal, sizeof(optVal)) != 0) {
+			perror("create_listener(): Failed to set SO_REUSEPORT");
+			close(socketFD);
+			return -1;
+		}
 	}
 
 	struct sockaddr_in const serverAddr = {
@@ -311,39 +1458,544 @@ int main()
 	};
 
 	if (bind(socketFD, (struct sockaddr const *) &serverAddr, sizeof(serverAddr)) != 0) {
-		perror("main(): Binding of socket to port failed");
-		exit(1);
+		perror("create_listener(): Binding of socket to port failed");
+		close(socketFD);
+		return -1;
 	}
 
-	if (listen(socketFD, 32) != 0) {
-		perror("main(): Failed to listen on port " STRING_VALUE(PORT));
-		exit(1);
+	// The backlog may be shared by several workers so give it some room
+	if (listen(socketFD, SOMAXCONN) != 0) {
+		perror("create_listener(): Failed to listen on port " STRING_VALUE(PORT));
+		close(socketFD);
+		return -1;
 	}
 
-	socklen_t clientLen = sizeof(struct sockaddr_in);
+	return socketFD;
+}
 
-	signal(SIGCHLD, SIG_IGN);
+// Set by the command line before any worker starts, only read afterwards
+static bool useUring = false;
+static bool useMappings = false;
+static bool streamFiles = false;
+static size_t mappingBudget = DEFAULT_MAPPING_BUDGET;
+static size_t contentBudget = DEFAULT_CONTENT_CACHE_BUDGET;
+static size_t compressionBudget = (size_t) DEFAULT_COMPRESSION_CACHE_BUDGET_MB * 1024 * 1024;
+static time_t contentCheckInterval = DEFAULT_CONTENT_CHECK_INTERVAL;
+static unsigned long openFileCacheSize = DEFAULT_OPEN_FILE_CACHE_SIZE;
+static unsigned long sidecarTableSize = DEFAULT_SIDECAR_TABLE_SIZE;
+static unsigned long idleTimeout = DEFAULT_IDLE_TIMEOUT;
+static unsigned long connectionMaxRequests = DEFAULT_CONNECTION_MAX_REQUESTS;
+static char const *metricsPath = NULL;
+static char const *accessLogPath = NULL;
+// Set up before the workers start when metricsPath is, so every one of
+// them shares it
+static Metrics *metrics = NULL;
 
-	while (1) {
-		struct sockaddr_in client;
-		int const clientFD = accept(socketFD, (struct sockaddr *)&client, &clientLen);
-		pid_t const pid = fork();
-		if (pid == -1) {
-			perror("main(): fork() errored");
-			send(clientFD, REPLY_500, sizeof(REPLY_500) - 1, 0);
-			close(clientFD);
-		} else if (pid == 0) {
-			// Child Process
-			handle_connection(clientFD);
-			close(socketFD);
-			exit(0);
+// Runs the event loop of whichever backend was picked, falling back to
+// epoll when io_uring is unavailable. index is the worker's slot, which
+// its counters are kept in.
+void serve(int const socketFD, unsigned long const maxRequests, unsigned long const index)
+{
+	Worker worker = {
+		.mappings = NULL,
+		.content = NULL,
+		.sidecars = NULL,
+		.compressed = NULL,
+		.openFiles = NULL,
+		.streamFiles = streamFiles,
+		.slabs = { NULL, 0 },
+		.metrics = NULL,
+		.allMetrics = metrics,
+		.metricsPath = NULL,
+		.metricsText = NULL,
+		.accessLog = NULL,
+		.idleTimeout = (long long) idleTimeout * 1000,
+		.maxConnectionRequests = connectionMaxRequests,
+		.requestsAnswered = 0,
+		.draining = false,
+		.idleOldest = NULL,
+		.idleNewest = NULL,
+		.dateHeaderLength = 0,
+		.dateSecond = 0
+	};
+	if (contentBudget > 0) {
+		worker.content = content_cache_create(contentBudget, contentCheckInterval);
+		if (worker.content == NULL)
+			fprintf(stderr, "serve(): Running this worker without a content cache\n");
+	}
+	if (sidecarTableSize > 0) {
+		worker.sidecars = sidecar_table_create(sidecarTableSize, contentCheckInterval);
+		if (worker.sidecars == NULL)
+			fprintf(stderr, "serve(): Running this worker without precompressed files\n");
+	}
+	if (compressionBudget > 0) {
+		worker.compressed = compression_cache_create(compressionBudget, COMPRESSION_THREADS);
+		if (worker.compressed == NULL)
+			fprintf(stderr, "serve(): Running this worker without compression\n");
+	}
+	if (metrics != NULL) {
+		worker.metricsText = malloc(METRICS_MAXIMUM_SIZE);
+		if (worker.metricsText == NULL) {
+			perror("serve(): Failed to allocate the metrics buffer");
 		} else {
-			// Parent Process
-			close(clientFD);
+			worker.metrics = &metrics->workers[index];
+			worker.metricsPath = metricsPath;
+			metrics_worker_started(worker.metrics);
+		}
+	}
+	if (openFileCacheSize > 0 && !useUring) {
+		worker.openFiles = open_file_cache_create((unsigned) openFileCacheSize,
+				contentCheckInterval);
+		if (worker.openFiles == NULL)
+			fprintf(stderr, "serve(): Running this worker without an open file cache\n");
+	}
+	if (accessLogPath != NULL) {
+		worker.accessLog = access_log_create(accessLogPath);
+		if (worker.accessLog == NULL)
+			fprintf(stderr, "serve(): Running this worker without an access log\n");
+	}
+	if (useMappings) {
+		worker.mappings = mapping_table_create(mappingBudget, MAXIMUM_MAPPED_FILE_SIZE);
+		if (worker.mappings == NULL)
+			fprintf(stderr, "serve(): Serving this worker's files with sendfile() instead\n");
+	}
+
+	bool served = false;
+	if (useUring) {
+		served = run_uring_loop(&worker, socketFD, maxRequests);
+		if (!served)
+			fprintf(stderr, "serve(): io_uring unavailable, falling back to epoll\n");
+	}
+	if (!served)
+		run_event_loop(&worker, socketFD, maxRequests);
+
+	if (worker.mappings != NULL)
+		mapping_table_destroy(worker.mappings);
+	if (worker.content != NULL)
+		content_cache_destroy(worker.content);
+	if (worker.sidecars != NULL)
+		sidecar_table_destroy(worker.sidecars);
+	if (worker.compressed != NULL)
+		compression_cache_destroy(worker.compressed);
+	if (worker.accessLog != NULL)
+		access_log_destroy(worker.accessLog);
+	if (worker.openFiles != NULL)
+		open_file_cache_destroy(worker.openFiles);
+	free(worker.metricsText);
+	slab_pool_empty(&worker.slabs);
+}
+
+static volatile sig_atomic_t shutdownRequested = 0;
+static volatile sig_atomic_t reopenRequested = 0;
+
+void request_shutdown(int const signal)
+{
+	(void) signal;
+	shutdownRequested = 1;
+}
+
+// SIGHUP in the parent, which passes it on to the workers
+void request_reopen(int const signal)
+{
+	(void) signal;
+	reopenRequested = 1;
+}
+
+// SIGHUP in a process that serves, so the log file can be rotated by
+// renaming it and sending one
+void reopen_access_log(int const signal)
+{
+	(void) signal;
+	access_log_reopen();
+}
+
+// Body of a worker process. Serves connections from its own event loop
+// until it has answered maxRequests requests, after which it finishes the
+// connections still open, exits and the parent forks a replacement.
+void run_worker(int const socketFD, unsigned long const maxRequests, unsigned long const index)
+{
+	serve(socketFD, maxRequests, index);
+	close(socketFD);
+	exit(0);
+}
+
+// Forks the worker for slot index, returns its pid in the parent or -1 on
+// failure.
+pid_t spawn_worker(int const socketFD, unsigned long const maxRequests, unsigned long const index)
+{
+	pid_t const pid = fork();
+	if (pid == -1) {
+		perror("spawn_worker(): fork() errored");
+	} else if (pid == 0) {
+		// Child Process, the parent's handlers must not stick around
+		signal(SIGINT, SIG_DFL);
+		signal(SIGTERM, SIG_DFL);
+		if (accessLogPath != NULL)
+			signal(SIGHUP, reopen_access_log);
+		run_worker(socketFD, maxRequests, index);
+	}
+	return pid;
+}
+
+// Pre-forked mode: workerCount processes share one listening socket and the
+// parent replaces any that exit.
+int run_prefork(unsigned long const workerCount, unsigned long const maxRequests)
+{
+	int const socketFD = create_listener(false);
+	if (socketFD == -1)
+		return 1;
+	if (metricsPath != NULL) {
+		metrics = metrics_create((unsigned) workerCount);
+		if (metrics == NULL)
+			return 1;
+	}
+
+	{
+		struct sigaction action = { .sa_handler = request_shutdown };
+		sigemptyset(&action.sa_mask);
+		sigaction(SIGINT, &action, NULL);
+		sigaction(SIGTERM, &action, NULL);
+		if (accessLogPath != NULL) {
+			action.sa_handler = request_reopen;
+			sigaction(SIGHUP, &action, NULL);
+		}
+	}
+
+	pid_t workers[MAXIMUM_WORKER_COUNT];
+	for (unsigned long i = 0; i < workerCount; i++)
+		workers[i] = spawn_worker(socketFD, maxRequests, i);
+
+	// The parent only supervises, replacing workers that exit either
+	// because they hit their request limit or because they crashed.
+	while (!shutdownRequested) {
+		if (reopenRequested) {
+			reopenRequested = 0;
+			for (unsigned long i = 0; i < workerCount; i++) {
+				if (workers[i] > 0)
+					kill(workers[i], SIGHUP);
+			}
+		}
+
+		int status;
+		pid_t const pid = waitpid(-1, &status, 0);
+		if (pid == -1) {
+			if (errno != EINTR) {
+				perror("run_prefork(): waitpid() errored");
+				sleep(1);
+			}
+			// Retry any slot that failed to fork earlier
+			for (unsigned long i = 0; i < workerCount && !shutdownRequested; i++) {
+				if (workers[i] == -1)
+					workers[i] = spawn_worker(socketFD, maxRequests, i);
+			}
+			continue;
+		}
+
+		if (WIFSIGNALED(status))
+			fprintf(stderr, "run_prefork(): Worker %d was killed by signal %d\n",
+				(int) pid, WTERMSIG(status));
+
+		for (unsigned long i = 0; i < workerCount; i++) {
+			if (workers[i] == pid) {
+				workers[i] = spawn_worker(socketFD, maxRequests, i);
+				break;
+			}
 		}
 	}
 
+	for (unsigned long i = 0; i < workerCount; i++) {
+		if (workers[i] > 0)
+			kill(workers[i], SIGTERM);
+	}
+	while (waitpid(-1, NULL, 0) > 0 || errno == EINTR)
+		;
+
 	close(socketFD);
+	if (metrics != NULL)
+		metrics_destroy(metrics);
+	return 0;
+}
+
+typedef struct {
+	pthread_t thread;
+	unsigned long index;
+	int listenFD;
+} ServerThread;
+
+void *run_server_thread(void *const arg)
+{
+	ServerThread const *const self = arg;
+
+	// Keep each loop on its own core so its connections stay cache hot,
+	// this only matters when there are no more threads than cores.
+	long const cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores > 0 && self->index < (unsigned long) cores) {
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		CPU_SET(self->index, &cpus);
+		pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+	}
+
+	// Threads never get recycled, closing a SO_REUSEPORT socket throws
+	// away the connections still waiting in its queue.
+	serve(self->listenFD, 0, self->index);
+	close(self->listenFD);
+	return NULL;
+}
+
+// Threaded mode: every thread has its own SO_REUSEPORT listener and event
+// loop and shares nothing with the others, so the kernel does all the load
+// balancing and no lock sits on the accept path.
+int run_threads(unsigned long threadCount)
+{
+	if (threadCount == 0) {
+		long const cores = sysconf(_SC_NPROCESSORS_ONLN);
+		threadCount = cores > 0 ? (unsigned long) cores : 1;
+		if (threadCount > MAXIMUM_WORKER_COUNT)
+			threadCount = MAXIMUM_WORKER_COUNT;
+	}
+
+	ServerThread *const threads = calloc(threadCount, sizeof(ServerThread));
+	if (threads == NULL) {
+		perror("run_threads(): Failed to allocate threads");
+		return 1;
+	}
+	if (metricsPath != NULL) {
+		metrics = metrics_create((unsigned) threadCount);
+		if (metrics == NULL)
+			return 1;
+	}
+	if (accessLogPath != NULL) {
+		struct sigaction action = { .sa_handler = reopen_access_log, .sa_flags = SA_RESTART };
+		sigemptyset(&action.sa_mask);
+		sigaction(SIGHUP, &action, NULL);
+	}
+
+	// All listeners are created up front so a port that is already taken
+	// is reported before anything starts serving.
+	for (unsigned long i = 0; i < threadCount; i++) {
+		threads[i].index = i;
+		threads[i].listenFD = create_listener(true);
+		if (threads[i].listenFD == -1)
+			return 1;
+	}
+
+	for (unsigned long i = 0; i < threadCount; i++) {
+		int const error = pthread_create(&threads[i].thread, NULL,
+				run_server_thread, &threads[i]);
+		if (error != 0) {
+			fprintf(stderr, "run_threads(): pthread_create() errored: %s\n",
+				strerror(error));
+			return 1;
+		}
+	}
 
+	for (unsigned long i = 0; i < threadCount; i++)
+		pthread_join(threads[i].thread, NULL);
+
+	free(threads);
+	if (metrics != NULL)
+		metrics_destroy(metrics);
 	return 0;
 }
+
+void print_usage(char const *const name)
+{
+	fprintf(stderr,
+		"Usage: %s [-w workers] [-r requests] [-t threads] [-b backend]\n"
+		"          [-f files] [-m megabytes] [-c megabytes] [-i seconds]\n"
+		"          [-k seconds] [-n requests] [-z megabytes] [-o files]\n"
+		"          [-p paths] [-s path] [-l file]\n"
+		"  -w workers   number of pre-forked worker processes (default "
+			STRING_VALUE(DEFAULT_WORKER_COUNT) ")\n"
+		"  -r requests  requests a worker answers before it is replaced,\n"
+		"               0 never replaces workers (default "
+			STRING_VALUE(DEFAULT_WORKER_MAX_REQUESTS) ")\n"
+		"  -t threads   serve from this many threads in one process instead,\n"
+		"               each with its own SO_REUSEPORT listener, 0 starts one\n"
+		"               per core\n"
+		"  -b backend   epoll or io_uring, io_uring falls back to epoll when\n"
+		"               the kernel does not support it (default epoll)\n"
+		"  -f files     sendfile, mmap or read. mmap keeps hot files mapped\n"
+		"               and sends them from memory, files must then be\n"
+		"               replaced with rename() rather than truncated in\n"
+		"               place. read streams them through a 64 KiB\n"
+		"               buffer per connection (default sendfile)\n"
+		"  -m megabytes how much each worker keeps mapped with -f mmap\n"
+		"               (default " STRING_VALUE(DEFAULT_MAPPING_BUDGET_MB) ")\n"
+		"  -c megabytes size of each worker's cache of hot file contents,\n"
+		"               0 turns it off (default "
+			STRING_VALUE(DEFAULT_CONTENT_CACHE_BUDGET_MB) ")\n"
+		"  -o files     how many files each worker keeps open to skip looking\n"
+		"               them up again, 0 turns it off. Not used with io_uring\n"
+		"               (default " STRING_VALUE(DEFAULT_OPEN_FILE_CACHE_SIZE) ")\n"
+		"  -i seconds   how long a cached or open file is served before\n"
+		"               checking it for changes. Precompressed .br, .zst and\n"
+		"               .gz files next to a file are looked for again once\n"
+		"               such a check finds the file changed (default "
+			STRING_VALUE(DEFAULT_CONTENT_CHECK_INTERVAL) ")\n"
+		"  -p paths     how many files each worker remembers precompressed\n"
+		"               .br, .zst and .gz files next to, which are only looked\n"
+		"               for once a file is found. 0 serves files as they are\n"
+		"               (default " STRING_VALUE(DEFAULT_SIDECAR_TABLE_SIZE) ")\n"
+		"  -k seconds   how long an open connection may wait for its next\n"
+		"               request, 0 turns keep-alive off (default "
+			STRING_VALUE(DEFAULT_IDLE_TIMEOUT) ")\n"
+		"  -n requests  requests answered on one connection before it is\n"
+		"               closed (default "
+			STRING_VALUE(DEFAULT_CONNECTION_MAX_REQUESTS) ")\n"
+		"  -z megabytes size of each worker's cache of gzip and deflate\n"
+		"               compressed copies of text files, which it makes on\n"
+		"               threads of its own. 0 turns compressing off (default "
+			STRING_VALUE(DEFAULT_COMPRESSION_CACHE_BUDGET_MB) ")\n"
+		"  -s path      answer requests for path, like /__metrics, with\n"
+		"               counters of every worker in the Prometheus text\n"
+		"               format (default off)\n"
+		"  -l file      append a line in the combined log format to file\n"
+		"               for every request, written from a thread of each\n"
+		"               worker's own. SIGHUP reopens it (default off)\n",
+		name);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long workerCount = DEFAULT_WORKER_COUNT;
+	unsigned long maxRequests = DEFAULT_WORKER_MAX_REQUESTS;
+	bool threaded = false;
+	unsigned long threadCount = 0;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "w:r:t:b:f:m:c:i:k:n:z:o:p:s:l:h")) != -1) {
+		char *end = NULL;
+		switch (opt) {
+		case 'w':
+			workerCount = strtoul(optarg, &end, 10);
+			if (*end != '\0' || workerCount == 0 || workerCount > MAXIMUM_WORKER_COUNT) {
+				fprintf(stderr, "main(): Worker count must be between 1 and "
+					STRING_VALUE(MAXIMUM_WORKER_COUNT) "\n");
+				exit(1);
+			}
+			break;
+		case 'r':
+			maxRequests = strtoul(optarg, &end, 10);
+			if (*end != '\0') {
+				fprintf(stderr, "main(): Invalid request limit: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 't':
+			threaded = true;
+			threadCount = strtoul(optarg, &end, 10);
+			if (*end != '\0' || threadCount > MAXIMUM_WORKER_COUNT) {
+				fprintf(stderr, "main(): Thread count must be between 0 and "
+					STRING_VALUE(MAXIMUM_WORKER_COUNT) "\n");
+				exit(1);
+			}
+			break;
+		case 'b':
+			if (strcmp(optarg, "io_uring") == 0) {
+				useUring = true;
+			} else if (strcmp(optarg, "epoll") == 0) {
+				useUring = false;
+			} else {
+				fprintf(stderr, "main(): Unknown backend: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'f':
+			useMappings = streamFiles = false;
+			if (strcmp(optarg, "mmap") == 0) {
+				useMappings = true;
+			} else if (strcmp(optarg, "read") == 0) {
+				streamFiles = true;
+			} else if (strcmp(optarg, "sendfile") != 0) {
+				fprintf(stderr, "main(): Unknown file mode: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'm': {
+			unsigned long const megabytes = strtoul(optarg, &end, 10);
+			if (*end != '\0' || megabytes == 0 || megabytes > SIZE_MAX / (1024 * 1024)) {
+				fprintf(stderr, "main(): Invalid mapping budget: %s\n", optarg);
+				exit(1);
+			}
+			mappingBudget = (size_t) megabytes * 1024 * 1024;
+			break;
+		}
+		case 'c': {
+			unsigned long const megabytes = strtoul(optarg, &end, 10);
+			if (*end != '\0' || megabytes > SIZE_MAX / (1024 * 1024)) {
+				fprintf(stderr, "main(): Invalid content cache size: %s\n", optarg);
+				exit(1);
+			}
+			contentBudget = (size_t) megabytes * 1024 * 1024;
+			break;
+		}
+		case 'z': {
+			unsigned long const megabytes = strtoul(optarg, &end, 10);
+			if (*end != '\0' || megabytes > SIZE_MAX / (1024 * 1024)) {
+				fprintf(stderr, "main(): Invalid compression cache size: %s\n", optarg);
+				exit(1);
+			}
+			compressionBudget = (size_t) megabytes * 1024 * 1024;
+			break;
+		}
+		case 'o':
+			openFileCacheSize = strtoul(optarg, &end, 10);
+			if (*end != '\0' || openFileCacheSize > UINT_MAX) {
+				fprintf(stderr, "main(): Invalid open file cache size: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'p':
+			sidecarTableSize = strtoul(optarg, &end, 10);
+			if (*end != '\0' || sidecarTableSize > MAXIMUM_SIDECAR_TABLE_SIZE) {
+				fprintf(stderr, "main(): Invalid sidecar table size: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'i':
+			contentCheckInterval = (time_t) strtoul(optarg, &end, 10);
+			if (*end != '\0') {
+				fprintf(stderr, "main(): Invalid check interval: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'k':
+			idleTimeout = strtoul(optarg, &end, 10);
+			if (*end != '\0' || idleTimeout > 24 * 60 * 60) {
+				fprintf(stderr, "main(): Invalid idle timeout: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'n':
+			connectionMaxRequests = strtoul(optarg, &end, 10);
+			if (*end != '\0' || connectionMaxRequests == 0) {
+				fprintf(stderr, "main(): Invalid per connection request limit: %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 's':
+			if (optarg[0] != '/') {
+				fprintf(stderr, "main(): Metrics path must start with /: %s\n", optarg);
+				exit(1);
+			}
+			metricsPath = optarg;
+			break;
+		case 'l':
+			accessLogPath = optarg;
+			break;
+		default:
+			print_usage(argv[0]);
+			exit(opt == 'h' ? 0 : 1);
+		}
+	}
+
+	// A client hanging up mid-send would otherwise kill the worker
+	signal(SIGPIPE, SIG_IGN);
+	byte_scan_init();
+
+	if (threaded)
+		return run_threads(threadCount);
+	return run_prefork(workerCount, maxRequests);
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include "connection.h"
+#include "location.h"
+#include "worker.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <time.h>
+
+// OK
+#define REPLY_200 "HTTP/1.1 200 OK\r\n"
+// Partial Content
+#define REPLY_206 "HTTP/1.1 206 Partial Content\r\n"
+// Not Modified, sent without a body
+#define REPLY_304 "HTTP/1.1 304 Not Modified\r\n"
+
+// Error replies are a status and a small html body, set_reply() puts the
+// header around them.
+// Bad Request
+#define REPLY_400_STATUS "400 Bad Request"
+#define REPLY_400_BODY \
+	"<html>\n\t<body>\n\t\t<h1>400 Bad Request</h1>\n\t</body>\n</html>"
+// Not Found
+#define REPLY_404_STATUS "404 Not Found"
+#define REPLY_404_BODY \
+	"<html>\n\t<body>\n\t\t<h1>404 Not Found</h1>\n\t</body>\n</html>"
+// Internal Server Error
+#define REPLY_500_STATUS "500 Internal Server Error"
+#define REPLY_500_BODY \
+	"<html>\n\t<body>\n\t\t<h1>500 Internal Server Error.</h1>\n\t\t" \
+	"Please try again\n\t</body>\n</html>"
+// URI Too Long
+#define REPLY_414_STATUS "414 URI Too Long"
+#define REPLY_414_BODY \
+	"<html>\n\t<body>\n\t\t<h1>414 URI Too Long</h1>\n\t</body>\n</html>"
+// Range Not Satisfiable
+#define REPLY_416_STATUS "416 Range Not Satisfiable"
+#define REPLY_416_BODY \
+	"<html>\n\t<body>\n\t\t<h1>416 Range Not Satisfiable</h1>\n\t</body>\n</html>"
+// Request Header Fields Too Large
+#define REPLY_431_STATUS "431 Request Header Fields Too Large"
+#define REPLY_431_BODY \
+	"<html>\n\t<body>\n\t\t<h1>431 Request Header Fields Too Large</h1>\n\t</body>\n</html>"
+// Not Implemented
+#define REPLY_501_STATUS "501 Not Implemented"
+#define REPLY_501_BODY \
+	"<html>\n\t<body>\n\t\t<h1>501 Not Implemented</h1>\n\t</body>\n</html>"
+// HTTP Version Not Supported
+#define REPLY_505_STATUS "505 HTTP Version Not Supported"
+#define REPLY_505_BODY \
+	"<html>\n\t<body>\n\t\t<h1>505 HTTP Version Not Supported</h1>\n\t</body>\n</html>"
+
+// Sent at the end of the header the server sends to the client, by
+// queue_response() rather than whatever builds the rest of the header.
+#define END "\r\n"
+
+// Feeds what has arrived so far to the connection's parser. Returns true
+// once the whole request is there, or the parser has given up on it, and
+// sets conn->requestEnd.
+bool request_complete(Connection *const conn);
+
+// Answers with one of the REPLY_<code> error pages, for example
+// SET_REPLY(conn, 404).
+#define SET_REPLY(conn, code) \
+	set_reply((conn), REPLY_##code##_STATUS, REPLY_##code##_BODY, \
+		sizeof(REPLY_##code##_BODY) - 1)
+
+void set_reply(Connection *const conn, char const *const status, char const *const body,
+		size_t const length);
+
+// Looks at the parsed request in conn->request, deciding whether the connection is
+// kept open afterwards, and writes the path of the file it asks for into
+// location, which must hold MAXIMUM_REQUEST_LOCATION_SIZE + 1 bytes.
+// Returns false after setting an error reply if the request can't be
+// served, or after answering it if it is for the worker's metricsPath.
+bool resolve_request(Worker *const worker, Connection *const conn, char *const location);
+
+// Most the answer to a scrape of metricsPath can take up, before it is
+// copied into the connection's arena
+#define METRICS_MAXIMUM_SIZE (16 * 1024)
+
+// Answers with every worker's counters
+void add_metrics_response(Worker *const worker, Connection *const conn);
+
+// Picks the coding to send the file at location in out of the sidecars it
+// has and the request's Accept-Encoding, adding the sidecar's suffix to
+// location and setting conn->encoding when it is not identity. Returns
+// true if location now names a sidecar.
+bool choose_sidecar(Connection *const conn, char *const location, unsigned const sidecars);
+// Does the same for the file at location once st, a fresh stat() of it,
+// shows it exists, looking for its sidecars with stat() if they are not
+// known for the file as it is now. The caller answers with the sidecar
+// instead when this returns true.
+bool negotiate_encoding(Worker *const worker, Connection *const conn, char *const location,
+		struct stat const *const st);
+// Goes back to the requested file when its sidecar turns out to be gone,
+// which is forgotten about. Returns false if location already is that
+// file.
+bool use_original_file(Worker *const worker, Connection *const conn, char *const location);
+// Content-Type header of the file at location by the name it was
+// requested with, which for a sidecar is without its suffix
+char const *content_type(Connection const *const conn, char const *const location);
+
+// Writes the status line and every header describing a file into out:
+// Content-Length, Content-Type, Content-Encoding and Vary when the
+// connection negotiated them, Accept-Ranges, Last-Modified and ETag.
+// Returns the length, or 0 if it does not fit in size bytes.
+size_t format_file_header(char *const out, size_t const size, Connection const *const conn,
+		char const *const location, off_t const fileSize, struct timespec const modified);
+
+// Fills the pending response's header with the 200 header for a file.
+// Returns false after setting an error reply if it does not fit.
+bool build_file_header(Connection *const conn, char const *const location, off_t const size,
+		struct timespec const modified);
+// Same, but points at the header kept in *header instead of building it,
+// or keeps what it built there if this is the first time. header may be
+// NULL when there is nowhere to keep it.
+bool add_file_header(Connection *const conn, char **const header, size_t *const headerLength,
+		char const *const location, off_t const size, struct timespec const modified);
+
+// Whether the request asks for parts of the file rather than all of it
+bool range_requested(Connection const *const conn);
+
+// Whether the request's If-None-Match, or If-Modified-Since without one,
+// says the client already has the file of the given size and mtime
+bool client_copy_current(Connection const *const conn, off_t const size,
+		struct timespec const modified);
+// Answers with 304 and the file's validators if the client's copy is
+// current, returning whether it did
+bool add_not_modified(Connection *const conn, off_t const size, struct timespec const modified);
+
+// Answers the request with a file of the given size: all of it, 304 when
+// the client's copy is current, the ranges it asks for or 416 when none
+// of them are in the file. data is its
+// contents if they are in memory, NULL sends them from the response's
+// file. header and headerLength are passed on to add_file_header().
+// Returns whether the response sends anything of the file, which is not
+// the case for HEAD requests, 304, 416 and errors.
+bool add_file_response(Connection *const conn, char const *const location, off_t const size,
+		struct timespec const modified, char const *const data, char **const header,
+		size_t *const headerLength);
+
+// Answers the request from a referenced content cache entry or file
+// mapping, which is either handed to the response or released.
+void use_cached_content(Worker *const worker, Connection *const conn,
+		CachedContent *const cached, char const *const location);
+void use_mapped_file(Worker *const worker, Connection *const conn,
+		MappedFile *const mapping, char const *const location);
+
+// Answers the request from a compressed copy of the file if it is of a
+// compressible type and the client takes gzip or deflate, given the size
+// and mtime of the file as it is now. Copies that are not ready yet get
+// made in the background. Returns false if the file has to be sent as it
+// is, which also sets conn->varyEncoding when a copy would be an option.
+bool use_compressed_variant(Worker *const worker, Connection *const conn,
+		char const *const location, off_t const size, struct timespec const modified);
+
+// Looks at the fully received request in conn->request and queues the
+// header and body that should be sent back.
+void prepare_response(Worker *const worker, Connection *const conn);
+
+// The response being put together, right after the queued ones.
+// begin_response() clears it, set_reply() and build_file_header() write
+// into it and queue_response() adds the Date and Connection headers and
+// puts it on the queue, dropping the request it answers from the buffer.
+Response *pending_response(Connection *const conn);
+Response *begin_response(Worker *const worker, Connection *const conn);
+void queue_response(Worker *const worker, Connection *const conn);
+
+// Formats t as an HTTP date, returning its length or 0 if it did not fit
+size_t format_http_date(char *const out, size_t const size, time_t const t);
+// Brings the worker's Date header up to date if the second has changed
+void refresh_date_header(Worker *const worker);
+
+// Takes the response at the head of the queue off once it has been sent
+void finish_response(Worker *const worker, Connection *const conn);
+// Drops every queued response, for connections that are being closed
+void release_responses(Worker *const worker, Connection *const conn);
+
+// Response writer. A response is a list of segments, header pieces first
+// and then body pieces. Memory segments of every queued response up to the
+// next piece of a file get sent with a single sendmsg(), file pieces with
+// sendfile() or splice. Header pieces are either referenced or copied into
+// the response's own header buffer, consecutive copies ending up in one
+// segment. These return false if the response has run out of segments or
+// header space.
+void response_clear(Response *const response);
+bool response_add_segment(Response *const response, void const *const data, size_t const length);
+bool response_add_text(Response *const response, char const *const text, size_t const length);
+// Formats a header piece, keeping the header buffer within limit bytes
+bool response_add_format(Response *const response, size_t const limit,
+		char const *const format, ...) __attribute__((format(printf, 3, 4)));
+// Body pieces are always referenced, the memory has to stay around until
+// the response is finished
+bool response_add_body(Response *const response, void const *const data, size_t const length);
+// length bytes of the response's file from offset
+bool response_add_file(Response *const response, off_t const offset, size_t const length);
+
+// Enough iovecs for the usual three segments of every queued response
+#define MAXIMUM_GATHERED_SEGMENTS (MAXIMUM_PIPELINED_RESPONSES * 4)
+
+// Points iov at the unsent segments of as many queued responses as fit in
+// maximum entries, stopping after one that still has a file to send.
+// fileNext tells whether that is why it stopped.
+size_t gather_responses(Connection const *const conn, struct iovec *const iov,
+		size_t const maximum, bool *const fileNext);
+// Where the unsent part of the file piece the queue has got to starts and
+// how long it is. Returns false if the next thing to send is not a file.
+bool next_file_range(Connection const *const conn, off_t *const offset, size_t *const length);
+// Accounts for sent bytes of what gather_responses() returned, or of the
+// file range next_file_range() returned, and finishes every response that
+// is now complete.
+void mark_responses_sent(Worker *const worker, Connection *const conn, size_t sent);
+
+// Streaming with -f read. Where the next chunk of the file piece at the
+// head of the queue starts and how long it is. The buffer to read it into
+// is set aside when a response with a file is queued, which answers with a
+// 500 instead if there is no memory for it. Returns false if there is no
+// buffer or no file piece is next.
+bool next_stream_chunk(Connection *const conn, off_t *const offset, size_t *const length);
+// Accounts for sent bytes of the chunk in the buffer like
+// mark_responses_sent(), emptying the buffer once all of it is out
+void mark_stream_sent(Worker *const worker, Connection *const conn, size_t const sent);
+
+// Current CLOCK_MONOTONIC time in milliseconds
+long long monotonic_milliseconds(void);
+// And in microseconds, for timing requests
+long long monotonic_microseconds(void);
+
+// Counts a look in the content cache towards the worker's metrics, a hit
+// being a file that got served from it
+void count_content_lookup(Worker *const worker, bool const hit);
+
+// Puts a connection waiting for a request on the worker's idle list, or
+// takes it back off once the request is there.
+void mark_connection_idle(Worker *const worker, Connection *const conn, long long const now);
+void mark_connection_busy(Worker *const worker, Connection *const conn);
@@ -0,0 +1,105 @@
+// Request targets and file names, kept apart from the rest of the server so
+// they can be benchmarked on their own. See bench/micro-bench.c.
+
+/* mime-types.h is generated by mimeTypeGen.py and contains:
+ *
+ * typedef struct {
+ *	 char const *const extension;
+ *	 char const *const header;
+ *	 uint8_t const extensionLength;
+ *	 uint8_t const headerLength;
+ * } MimeType;
+ *
+ * // A perfect hash table of extensions, see get_mime_type()
+ * static uint16_t const mimeDisplacements[MIME_BUCKET_COUNT] = { ... };
+ * static MimeType const mimeTypes[MIME_SLOT_COUNT] = {
+ *	 {"html", "Content-Type: text/html\r\n", 4, 25},
+ *	 // This goes on for quite some time with various mime types
+ * };
+ */
+#include "mime-types.h"
+
+#include "connection.h"
+#include "hash.h"
+#include "location.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+
+void trim_right_whitespace(char *const data)
+{
+	// The data is from a subsection of a request so limit
+	// it to the maximum size of a request
+	size_t const length = strnlen(data, MAXIMUM_REQUEST_SIZE);
+	size_t kept = length;
+	while (kept > 0) {
+		char const ch = data[kept - 1];
+		if (!(ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'))
+			break;
+		kept--;
+	}
+	if (kept < length)
+		data[kept] = '\0';
+}
+
+char const *get_mime_type(char const *const location)
+{
+	// Get position of file extension ("main.txt" -> ".txt")
+	char const *extension = strrchr(location, '.');
+	if (extension == NULL)
+		// As per RFC-7231, data with an unknown type should not get a
+		// Content-Type header.
+		return "";
+	// Skip over the . character. ("txt")
+	extension += 1;
+	size_t const length = strnlen(extension, MIME_LONGEST_EXTENSION + 1);
+	if (length == 0 || length > MIME_LONGEST_EXTENSION)
+		return "";
+
+	// The first hash picks the bucket, whose seed for the second hash was
+	// chosen so that it lands on the only slot the extension can be in
+	uint32_t const bucket = hash_lowercase(extension, length, 0) % MIME_BUCKET_COUNT;
+	MimeType const *const type = &mimeTypes[hash_lowercase(extension, length,
+			mimeDisplacements[bucket]) & (MIME_SLOT_COUNT - 1)];
+	if (type->extensionLength != length || strncasecmp(extension, type->extension, length) != 0)
+		return "";
+	return type->header;
+}
+
+bool build_location(char *const location, char const *const target, size_t const length)
+{
+	static char const index[] = "./index.html";
+
+	if (length == 1 && target[0] == '/') {
+		// Redirect / to index.html
+		memcpy(location, index, sizeof(index));
+		return true;
+	}
+
+	// Prepend a ./ just incase they try doing a funny
+	if (length + 2 > MAXIMUM_REQUEST_LOCATION_SIZE)
+		return false;
+	location[0] = '.';
+	location[1] = '/';
+	memcpy(location + 2, target, length);
+	location[length + 2] = '\0';
+
+	// This strips any possible .. comedy
+	char *temp;
+	while ((temp = strstr(location, "..")) != NULL) {
+		temp[0] = '.';
+		temp[1] = '/';
+	}
+
+	// Check if the last character is / and redirect to that
+	// directory's index.html
+	size_t const locationLength = strlen(location);
+	if (location[locationLength - 1] == '/') {
+		if (locationLength + sizeof(index) - 1 > MAXIMUM_REQUEST_LOCATION_SIZE)
+			return false;
+		memcpy(location + locationLength, index, sizeof(index));
+	}
+	return true;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// This is the limit on how long path you can request like:
+// http://cool.website/path/to/file.txt
+#define MAXIMUM_REQUEST_LOCATION_SIZE 1024
+
+// Cuts off the spaces, tabs and line breaks at the end of data
+void trim_right_whitespace(char *const data);
+
+// The Content-Type header line for the file at location going by its
+// extension, or an empty string when the type is unknown
+char const *get_mime_type(char const *const location);
+
+// Turns the length bytes of a request target into the path of the file it
+// asks for, relative to the served directory, with any way out of it
+// taken away and directories pointing at their index.html. location must
+// hold MAXIMUM_REQUEST_LOCATION_SIZE + 1 bytes. Returns false if the path
+// does not fit.
+bool build_location(char *const location, char const *const target, size_t const length);
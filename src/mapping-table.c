@@ -0,0 +1,215 @@
+#include "mapping-table.h"
+#include "hash.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Starting size of the hash table, doubled whenever it gets full
+#define MAPPING_TABLE_INITIAL_BUCKETS 256
+
+MappingTable *mapping_table_create(size_t const budget, size_t const maximumFileSize)
+{
+	MappingTable *const table = calloc(1, sizeof(MappingTable));
+	if (table == NULL) {
+		perror("mapping_table_create(): Failed to allocate table");
+		return NULL;
+	}
+	table->buckets = calloc(MAPPING_TABLE_INITIAL_BUCKETS, sizeof(MappedFile *));
+	if (table->buckets == NULL) {
+		perror("mapping_table_create(): Failed to allocate buckets");
+		free(table);
+		return NULL;
+	}
+	table->bucketCount = MAPPING_TABLE_INITIAL_BUCKETS;
+	table->budget = budget;
+	table->maximumFileSize = maximumFileSize;
+	return table;
+}
+
+void free_mapping(MappedFile *const file)
+{
+	munmap(file->data, (size_t) file->size);
+	free(file->header);
+	free(file->path);
+	free(file);
+}
+
+void unlink_mapping_recency(MappingTable *const table, MappedFile *const file)
+{
+	if (file->newer != NULL)
+		file->newer->older = file->older;
+	else
+		table->newest = file->older;
+	if (file->older != NULL)
+		file->older->newer = file->newer;
+	else
+		table->oldest = file->newer;
+	file->newer = file->older = NULL;
+}
+
+void mark_mapping_newest(MappingTable *const table, MappedFile *const file)
+{
+	file->older = table->newest;
+	file->newer = NULL;
+	if (table->newest != NULL)
+		table->newest->newer = file;
+	table->newest = file;
+	if (table->oldest == NULL)
+		table->oldest = file;
+}
+
+// Takes an entry out of the table. The mapping itself stays around until
+// the last response using it lets go.
+void remove_mapping(MappingTable *const table, MappedFile *const file)
+{
+	MappedFile **link = &table->buckets[hash_path(file->path) & (table->bucketCount - 1)];
+	while (*link != file)
+		link = &(*link)->nextInBucket;
+	*link = file->nextInBucket;
+
+	unlink_mapping_recency(table, file);
+	table->entryCount--;
+	table->mappedBytes -= (size_t) file->size;
+	file->stale = true;
+	if (file->references == 0)
+		free_mapping(file);
+}
+
+void mapping_table_destroy(MappingTable *const table)
+{
+	while (table->newest != NULL)
+		remove_mapping(table, table->newest);
+	free(table->buckets);
+	free(table);
+}
+
+void grow_mapping_buckets(MappingTable *const table)
+{
+	size_t const newCount = table->bucketCount * 2;
+	MappedFile **const buckets = calloc(newCount, sizeof(MappedFile *));
+	// Long chains are slower but still correct, so just carry on
+	if (buckets == NULL)
+		return;
+
+	for (size_t i = 0; i < table->bucketCount; i++) {
+		MappedFile *file = table->buckets[i];
+		while (file != NULL) {
+			MappedFile *const next = file->nextInBucket;
+			size_t const bucket = hash_path(file->path) & (newCount - 1);
+			file->nextInBucket = buckets[bucket];
+			buckets[bucket] = file;
+			file = next;
+		}
+	}
+	free(table->buckets);
+	table->buckets = buckets;
+	table->bucketCount = newCount;
+}
+
+// Unmaps least recently used files nobody is sending until size more bytes
+// fit in the budget. Returns false if that is not possible.
+bool make_mapping_room(MappingTable *const table, size_t const size)
+{
+	MappedFile *file = table->oldest;
+	while (table->mappedBytes + size > table->budget && file != NULL) {
+		MappedFile *const newer = file->newer;
+		if (file->references == 0)
+			remove_mapping(table, file);
+		file = newer;
+	}
+	return table->mappedBytes + size <= table->budget;
+}
+
+MappedFile *map_file(char const *const path, struct stat const *const st)
+{
+	int const fileFD = open(path, O_RDONLY | O_CLOEXEC);
+	if (fileFD == -1) {
+		perror("map_file(): Could not open file");
+		return NULL;
+	}
+	// Fault everything in now rather than one page at a time while sending
+	void *const data = mmap(NULL, (size_t) st->st_size, PROT_READ,
+			MAP_SHARED | MAP_POPULATE, fileFD, 0);
+	// The mapping keeps the file alive on its own
+	close(fileFD);
+	if (data == MAP_FAILED) {
+		perror("map_file(): mmap() errored");
+		return NULL;
+	}
+
+	MappedFile *const file = calloc(1, sizeof(MappedFile));
+	char *const pathCopy = strdup(path);
+	if (file == NULL || pathCopy == NULL) {
+		perror("map_file(): Failed to allocate entry");
+		munmap(data, (size_t) st->st_size);
+		free(file);
+		free(pathCopy);
+		return NULL;
+	}
+	file->path = pathCopy;
+	file->device = st->st_dev;
+	file->inode = st->st_ino;
+	file->size = st->st_size;
+	file->modified = st->st_mtim;
+	file->data = data;
+	return file;
+}
+
+MappedFile *mapping_table_acquire(MappingTable *const table, char const *const path,
+		struct stat const *const st)
+{
+	// Empty files can't be mapped and have nothing to send anyway
+	if (st->st_size <= 0 || (size_t) st->st_size > table->maximumFileSize)
+		return NULL;
+
+	size_t const hash = hash_path(path);
+	MappedFile *file = table->buckets[hash & (table->bucketCount - 1)];
+	while (file != NULL && strcmp(file->path, path) != 0)
+		file = file->nextInBucket;
+
+	if (file != NULL) {
+		if (file->device == st->st_dev && file->inode == st->st_ino
+				&& file->size == st->st_size
+				&& file->modified.tv_sec == st->st_mtim.tv_sec
+				&& file->modified.tv_nsec == st->st_mtim.tv_nsec) {
+			unlink_mapping_recency(table, file);
+			mark_mapping_newest(table, file);
+			file->references++;
+			return file;
+		}
+		// The file was replaced or modified, drop the old mapping
+		remove_mapping(table, file);
+	}
+
+	if (!make_mapping_room(table, (size_t) st->st_size))
+		return NULL;
+
+	file = map_file(path, st);
+	if (file == NULL)
+		return NULL;
+
+	if (table->entryCount >= table->bucketCount)
+		grow_mapping_buckets(table);
+	size_t const bucket = hash & (table->bucketCount - 1);
+	file->nextInBucket = table->buckets[bucket];
+	table->buckets[bucket] = file;
+	mark_mapping_newest(table, file);
+	table->entryCount++;
+	table->mappedBytes += (size_t) file->size;
+
+	file->references = 1;
+	return file;
+}
+
+void mapping_table_release(MappingTable *const table, MappedFile *const file)
+{
+	(void) table;
+	file->references--;
+	if (file->references == 0 && file->stale)
+		free_mapping(file);
+}
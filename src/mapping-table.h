@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+// A whole file mapped into memory, shared by every response that sends it
+typedef struct MappedFile {
+	char *path;
+	// What the file looked like when it was mapped, a request that stats
+	// it differently gets a fresh mapping.
+	dev_t device;
+	ino_t inode;
+	off_t size;
+	struct timespec modified;
+
+	void *data;
+	// Same as CachedContent's, NULL until the mapping is first sent
+	char *header;
+	size_t headerLength;
+	// The Content-Encoding and Vary the header was built with, which only
+	// responses sending the file the same way can share
+	unsigned headerVariant;
+	// Responses currently sending from this mapping. It is only unmapped
+	// once this drops to zero, even if the file changed in the meantime.
+	unsigned references;
+	// Set once the entry has left the table
+	bool stale;
+
+	struct MappedFile *nextInBucket;
+	struct MappedFile *newer;
+	struct MappedFile *older;
+} MappedFile;
+
+// Maps files by path, hands out references to them and unmaps the least
+// recently used ones when the mapped total goes over the byte budget.
+// Belongs to a single worker and is not thread safe.
+typedef struct {
+	MappedFile **buckets;
+	size_t bucketCount;
+	size_t entryCount;
+
+	size_t mappedBytes;
+	size_t budget;
+	// Bigger files are always sent with sendfile()
+	size_t maximumFileSize;
+
+	MappedFile *newest;
+	MappedFile *oldest;
+} MappingTable;
+
+MappingTable *mapping_table_create(size_t const budget, size_t const maximumFileSize);
+void mapping_table_destroy(MappingTable *const table);
+
+// Returns a referenced mapping of path, which st must be a fresh stat() of.
+// Returns NULL when the file can't or shouldn't be mapped, in which case it
+// has to be sent some other way.
+MappedFile *mapping_table_acquire(MappingTable *const table, char const *const path,
+		struct stat const *const st);
+
+void mapping_table_release(MappingTable *const table, MappedFile *const file);
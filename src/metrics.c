@@ -0,0 +1,248 @@
+#include "metrics.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+static unsigned const statusCodes[METRICS_STATUS_COUNT - 1] = {
+	200, 206, 304, 400, 404, 414, 416, 431, 500, 501, 505
+};
+static char const *const methodNames[METRICS_METHOD_COUNT] = { "GET", "HEAD", "other" };
+
+// Bounds of the buckets http_request_duration_seconds is exported with,
+// powers of two from 16 microseconds to about 16 seconds. They line up
+// with the histogram's own buckets, so the counts are exact.
+#define EXPORTED_FIRST_BIT 4
+#define EXPORTED_LAST_BIT 24
+
+static double const exportedQuantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+Metrics *metrics_create(unsigned const workerCount)
+{
+	Metrics *const metrics = malloc(sizeof(Metrics));
+	if (metrics == NULL) {
+		perror("metrics_create(): Failed to allocate metrics");
+		return NULL;
+	}
+	// Anonymous shared memory stays shared with every process forked
+	// from here on, and comes zeroed
+	metrics->workers = mmap(NULL, (size_t) workerCount * sizeof(WorkerMetrics),
+			PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (metrics->workers == MAP_FAILED) {
+		perror("metrics_create(): Failed to map shared counters");
+		free(metrics);
+		return NULL;
+	}
+	metrics->workerCount = workerCount;
+	return metrics;
+}
+
+void metrics_destroy(Metrics *const metrics)
+{
+	munmap(metrics->workers, (size_t) metrics->workerCount * sizeof(WorkerMetrics));
+	free(metrics);
+}
+
+void metrics_worker_started(WorkerMetrics *const worker)
+{
+	__atomic_store_n(&worker->connectionsClosed,
+		__atomic_load_n(&worker->connectionsAccepted, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+}
+
+unsigned metrics_status_index(unsigned const status)
+{
+	for (unsigned i = 0; i < METRICS_STATUS_COUNT - 1; i++) {
+		if (statusCodes[i] == status)
+			return i;
+	}
+	return METRICS_STATUS_COUNT - 1;
+}
+
+unsigned latency_index(uint64_t const value)
+{
+	if (value < LATENCY_SUB_BUCKETS)
+		return (unsigned) value;
+	unsigned highest = 63 - (unsigned) __builtin_clzll(value);
+	if (highest > LATENCY_HIGHEST_BIT)
+		return LATENCY_BUCKETS - 1;
+	unsigned const shift = highest - LATENCY_SUB_BITS;
+	return (shift + 1) * LATENCY_SUB_BUCKETS + (unsigned) (value >> shift) - LATENCY_SUB_BUCKETS;
+}
+
+// The largest value that lands in the bucket, see metrics_record_latency()
+uint64_t latency_bucket_value(unsigned const index)
+{
+	if (index < LATENCY_SUB_BUCKETS)
+		return index + 1;
+	unsigned const shift = index / LATENCY_SUB_BUCKETS - 1;
+	uint64_t const top = LATENCY_SUB_BUCKETS + index % LATENCY_SUB_BUCKETS;
+	return (top + 1) << shift;
+}
+
+void metrics_record_latency(WorkerMetrics *const worker, long long const microseconds)
+{
+	uint64_t const value = microseconds > 0 ? (uint64_t) microseconds : 0;
+	// Filed one lower, so every bucket takes in its upper bound rather
+	// than its lower one, like a Prometheus le bucket. A value of exactly
+	// a power of two then counts towards the exported bucket it bounds.
+	metrics_add(&worker->latencies[latency_index(value > 0 ? value - 1 : 0)], 1);
+	metrics_add(&worker->latencySum, value);
+}
+
+uint64_t read_counter(uint64_t const *const counter)
+{
+	return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+// Appends to the text being put together in out, remembering once it no
+// longer fits
+typedef struct {
+	char *out;
+	size_t size;
+	size_t length;
+	bool full;
+} Writer;
+
+void write_text(Writer *const writer, char const *const format, ...)
+	__attribute__((format(printf, 2, 3)));
+
+void write_text(Writer *const writer, char const *const format, ...)
+{
+	if (writer->full)
+		return;
+	va_list arguments;
+	va_start(arguments, format);
+	int const written = vsnprintf(writer->out + writer->length, writer->size - writer->length,
+			format, arguments);
+	va_end(arguments);
+	if (written < 0 || (size_t) written >= writer->size - writer->length) {
+		writer->full = true;
+		return;
+	}
+	writer->length += (size_t) written;
+}
+
+size_t metrics_format(Metrics const *const metrics, char *const out, size_t const size)
+{
+	// Added up into a copy first, so every figure comes from the same
+	// moment as near as it can
+	WorkerMetrics *const total = calloc(1, sizeof(WorkerMetrics));
+	if (total == NULL) {
+		perror("metrics_format(): Failed to allocate totals");
+		return 0;
+	}
+	for (unsigned i = 0; i < metrics->workerCount; i++) {
+		WorkerMetrics const *const worker = &metrics->workers[i];
+		for (unsigned j = 0; j < METRICS_METHOD_COUNT; j++) {
+			for (unsigned k = 0; k < METRICS_STATUS_COUNT; k++)
+				total->requests[j][k] += read_counter(&worker->requests[j][k]);
+		}
+		total->bytesSent += read_counter(&worker->bytesSent);
+		total->connectionsAccepted += read_counter(&worker->connectionsAccepted);
+		total->connectionsClosed += read_counter(&worker->connectionsClosed);
+		total->contentCacheHits += read_counter(&worker->contentCacheHits);
+		total->contentCacheMisses += read_counter(&worker->contentCacheMisses);
+		total->accessLogDropped += read_counter(&worker->accessLogDropped);
+		for (unsigned j = 0; j < LATENCY_BUCKETS; j++)
+			total->latencies[j] += read_counter(&worker->latencies[j]);
+		total->latencySum += read_counter(&worker->latencySum);
+	}
+
+	Writer writer = { out, size, 0, false };
+	write_text(&writer,
+		"# HELP http_requests_total Requests answered, by method and status code.\n"
+		"# TYPE http_requests_total counter\n");
+	for (unsigned i = 0; i < METRICS_METHOD_COUNT; i++) {
+		for (unsigned j = 0; j < METRICS_STATUS_COUNT; j++) {
+			if (total->requests[i][j] == 0)
+				continue;
+			if (j < METRICS_STATUS_COUNT - 1)
+				write_text(&writer, "http_requests_total{method=\"%s\",code=\"%u\"} %llu\n",
+					methodNames[i], statusCodes[j],
+					(unsigned long long) total->requests[i][j]);
+			else
+				write_text(&writer, "http_requests_total{method=\"%s\",code=\"other\"} %llu\n",
+					methodNames[i], (unsigned long long) total->requests[i][j]);
+		}
+	}
+
+	// Connections closed in one worker can't be seen by the others at
+	// exactly the same time they were counted as accepted
+	uint64_t const active = total->connectionsAccepted > total->connectionsClosed
+		? total->connectionsAccepted - total->connectionsClosed : 0;
+	write_text(&writer,
+		"# HELP http_response_bytes_total Bytes of responses handed to the kernel.\n"
+		"# TYPE http_response_bytes_total counter\n"
+		"http_response_bytes_total %llu\n"
+		"# HELP http_connections_total Client connections accepted.\n"
+		"# TYPE http_connections_total counter\n"
+		"http_connections_total %llu\n"
+		"# HELP http_connections_active Client connections open right now.\n"
+		"# TYPE http_connections_active gauge\n"
+		"http_connections_active %llu\n"
+		"# HELP http_content_cache_lookups_total Files looked for in the content cache, "
+			"by whether they were there.\n"
+		"# TYPE http_content_cache_lookups_total counter\n"
+		"http_content_cache_lookups_total{result=\"hit\"} %llu\n"
+		"http_content_cache_lookups_total{result=\"miss\"} %llu\n"
+		"# HELP http_access_log_dropped_total Requests left out of the access log because "
+			"its writer fell behind.\n"
+		"# TYPE http_access_log_dropped_total counter\n"
+		"http_access_log_dropped_total %llu\n",
+		(unsigned long long) total->bytesSent,
+		(unsigned long long) total->connectionsAccepted, (unsigned long long) active,
+		(unsigned long long) total->contentCacheHits,
+		(unsigned long long) total->contentCacheMisses,
+		(unsigned long long) total->accessLogDropped);
+
+	uint64_t count = 0;
+	for (unsigned i = 0; i < LATENCY_BUCKETS; i++)
+		count += total->latencies[i];
+	write_text(&writer,
+		"# HELP http_request_duration_seconds Time from a request having arrived to the "
+			"last of its response having been sent.\n"
+		"# TYPE http_request_duration_seconds histogram\n");
+	uint64_t below = 0;
+	unsigned index = 0;
+	for (unsigned bit = EXPORTED_FIRST_BIT; bit <= EXPORTED_LAST_BIT; bit++) {
+		uint64_t const bound = (uint64_t) 1 << bit;
+		while (index < LATENCY_BUCKETS && latency_bucket_value(index) <= bound)
+			below += total->latencies[index++];
+		write_text(&writer, "http_request_duration_seconds_bucket{le=\"%.6f\"} %llu\n",
+			(double) bound / 1e6, (unsigned long long) below);
+	}
+	write_text(&writer,
+		"http_request_duration_seconds_bucket{le=\"+Inf\"} %llu\n"
+		"http_request_duration_seconds_sum %.6f\n"
+		"http_request_duration_seconds_count %llu\n",
+		(unsigned long long) count, (double) total->latencySum / 1e6,
+		(unsigned long long) count);
+
+	// The histogram above is coarse to keep scrapes small, these come
+	// from the full resolution one
+	write_text(&writer,
+		"# HELP http_request_duration_quantile_seconds Quantiles of "
+			"http_request_duration_seconds since the server started.\n"
+		"# TYPE http_request_duration_quantile_seconds gauge\n");
+	for (size_t i = 0; i < sizeof(exportedQuantiles) / sizeof(exportedQuantiles[0]); i++) {
+		uint64_t const wanted = (uint64_t) ((double) count * exportedQuantiles[i] + 0.5);
+		uint64_t seen = 0;
+		uint64_t value = 0;
+		for (unsigned j = 0; j < LATENCY_BUCKETS && count > 0; j++) {
+			seen += total->latencies[j];
+			if (seen >= wanted && seen > 0) {
+				value = latency_bucket_value(j);
+				break;
+			}
+		}
+		write_text(&writer, "http_request_duration_quantile_seconds{quantile=\"%g\"} %.6f\n",
+			exportedQuantiles[i], (double) value / 1e6);
+	}
+
+	free(total);
+	return writer.full ? 0 : writer.length;
+}
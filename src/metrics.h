@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+	METRICS_GET,
+	METRICS_HEAD,
+	// Anything the server does not implement, or could not parse
+	METRICS_OTHER_METHOD,
+	METRICS_METHOD_COUNT,
+} MetricsMethod;
+
+// Status codes the server answers with get a counter each, see
+// metrics_status_index(), and one more counts anything else
+#define METRICS_STATUS_COUNT 12
+
+// Latencies are kept in microseconds in buckets of 2^LATENCY_SUB_BITS per
+// power of two like an HDR histogram, every value being within 12.5% of
+// its bucket's bounds. A bucket takes in its upper bound but not its lower
+// one, as Prometheus buckets do. Anything over 2^LATENCY_HIGHEST_BIT
+// microseconds, about 19 hours, lands in the last bucket.
+#define LATENCY_SUB_BITS 3
+#define LATENCY_SUB_BUCKETS (1u << LATENCY_SUB_BITS)
+#define LATENCY_HIGHEST_BIT 35
+#define LATENCY_BUCKETS ((LATENCY_HIGHEST_BIT - LATENCY_SUB_BITS + 2) * LATENCY_SUB_BUCKETS)
+
+// Counters of a single worker. Only that worker ever writes them, so they
+// need no locks or atomic read-modify-writes, only stores that readers in
+// other workers can't see half done. Each worker's block starts on its own
+// cache line so they never share one.
+typedef struct {
+	uint64_t requests[METRICS_METHOD_COUNT][METRICS_STATUS_COUNT];
+	uint64_t bytesSent;
+	// Open connections are the difference between these two
+	uint64_t connectionsAccepted;
+	uint64_t connectionsClosed;
+	uint64_t contentCacheHits;
+	uint64_t contentCacheMisses;
+	// Requests the access log had no room for
+	uint64_t accessLogDropped;
+
+	// From a request having arrived to the last of its response having
+	// been sent
+	uint64_t latencies[LATENCY_BUCKETS];
+	uint64_t latencySum;
+} __attribute__((aligned(64))) WorkerMetrics;
+
+// Every worker's counters, in memory shared between the worker processes so
+// any of them can add them all up when asked. Workers that get replaced
+// leave their counters to their replacement, so they only ever go up.
+typedef struct {
+	WorkerMetrics *workers;
+	unsigned workerCount;
+} Metrics;
+
+Metrics *metrics_create(unsigned const workerCount);
+void metrics_destroy(Metrics *const metrics);
+
+// Adds to one of the worker's own counters
+static inline void metrics_add(uint64_t *const counter, uint64_t const amount)
+{
+	__atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + amount,
+		__ATOMIC_RELAXED);
+}
+
+// Called by a worker taking over a block, whose previous owner's
+// connections all went away with it
+void metrics_worker_started(WorkerMetrics *const worker);
+
+// Where a status code is counted in WorkerMetrics.requests
+unsigned metrics_status_index(unsigned const status);
+
+void metrics_record_latency(WorkerMetrics *const worker, long long const microseconds);
+
+// Writes every worker's counters added up into out in the Prometheus text
+// format. Returns the length, or 0 if it does not fit in size bytes.
+size_t metrics_format(Metrics const *const metrics, char *const out, size_t const size);
@@ -1,1337 +1,2099 @@
 #pragma once
+// Generated by mimeTypeGen.py, edit that rather than this
 
+#include <stdint.h>
+
+#define MIME_BUCKET_COUNT 330
+#define MIME_SLOT_COUNT 2048
+#define MIME_LONGEST_EXTENSION 25
 
 typedef struct {
 	char const *const extension;
-	char const *const type;
+	// The whole header line, ready to be copied into a response
+	char const *const header;
+	uint8_t const extensionLength;
+	uint8_t const headerLength;
 } MimeType;
 
+// Seed for each bucket's second hash
+static uint16_t const mimeDisplacements[MIME_BUCKET_COUNT] = {
+	3, 4, 2, 7, 1, 3, 2, 1, 3, 4, 2, 6,
+	3, 4, 2, 9, 8, 2, 2, 1, 1, 5, 1, 3,
+	12, 14, 2, 8, 2, 20, 10, 2, 1, 23, 1, 2,
+	5, 7, 2, 6, 1, 2, 17, 1, 1, 4, 2, 12,
+	1, 2, 2, 9, 3, 5, 1, 2, 1, 1, 4, 1,
+	1, 1, 7, 8, 3, 6, 2, 11, 9, 2, 1, 1,
+	2, 2, 0, 1, 7, 1, 18, 1, 8, 1, 15, 10,
+	16, 1, 6, 5, 14, 4, 13, 16, 2, 1, 3, 20,
+	8, 7, 0, 2, 5, 10, 12, 13, 17, 4, 11, 1,
+	6, 10, 2, 4, 1, 3, 0, 1, 4, 9, 5, 3,
+	6, 7, 4, 16, 2, 18, 4, 16, 3, 0, 4, 16,
+	1, 6, 27, 8, 3, 35, 1, 8, 2, 7, 1, 5,
+	1, 1, 6, 2, 4, 2, 9, 8, 2, 2, 25, 3,
+	13, 1, 3, 3, 3, 1, 3, 19, 3, 3, 1, 4,
+	2, 20, 1, 3, 20, 18, 9, 6, 5, 14, 1, 8,
+	23, 2, 1, 4, 4, 15, 8, 4, 6, 9, 8, 17,
+	14, 1, 23, 31, 4, 7, 5, 2, 13, 2, 2, 3,
+	1, 7, 8, 5, 15, 2, 2, 15, 4, 23, 5, 4,
+	4, 1, 1, 3, 2, 51, 3, 1, 2, 7, 2, 5,
+	5, 29, 9, 3, 7, 5, 3, 1, 13, 1, 2, 7,
+	13, 2, 0, 2, 1, 1, 5, 12, 15, 2, 5, 5,
+	3, 3, 14, 18, 6, 16, 2, 6, 17, 2, 1, 12,
+	3, 9, 6, 2, 1, 5, 21, 2, 1, 8, 3, 15,
+	13, 2, 3, 27, 7, 12, 5, 9, 10, 6, 2, 15,
+	1, 2, 18, 6, 1, 33, 3, 4, 3, 4, 7, 9,
+	6, 10, 13, 1, 39, 9, 5, 28, 2, 8, 23, 2,
+	11, 13, 1, 9, 16, 46, 33, 9, 25, 4, 36, 13,
+	2, 1, 0, 53, 35, 1,
+};
 
-MimeType const mimeTypes[] = {
-	{"a2l", "application/A2L\r\n"},
-	{"aml", "application/AML\r\n"},
-	{"ez", "application/andrew-inset\r\n"},
-	{"atf", "application/ATF\r\n"},
-	{"atfx", "application/ATFX\r\n"},
-	{"atxml", "application/ATXML\r\n"},
-	{"atom", "application/atom+xml\r\n"},
-	{"atomcat", "application/atomcat+xml\r\n"},
-	{"atomdeleted", "application/atomdeleted+xml\r\n"},
-	{"atomsvc", "application/atomsvc+xml\r\n"},
-	{"dwd", "application/atsc-dwd+xml\r\n"},
-	{"held", "application/atsc-held+xml\r\n"},
-	{"rsat", "application/atsc-rsat+xml\r\n"},
-	{"apxml", "application/auth-policy+xml\r\n"},
-	{"xdd", "application/bacnet-xdd+zip\r\n"},
-	{"xcs", "application/calendar+xml\r\n"},
-	{"cbor", "application/cbor\r\n"},
-	{"c3ex", "application/cccex\r\n"},
-	{"ccmp", "application/ccmp+xml\r\n"},
-	{"ccxml", "application/ccxml+xml\r\n"},
-	{"cdfx", "application/CDFX+XML\r\n"},
-	{"cdmia", "application/cdmi-capability\r\n"},
-	{"cdmic", "application/cdmi-container\r\n"},
-	{"cdmid", "application/cdmi-domain\r\n"},
-	{"cdmio", "application/cdmi-object\r\n"},
-	{"cdmiq", "application/cdmi-queue\r\n"},
-	{"cea", "application/CEA\r\n"},
-	{"cellml", "application/cellml+xml\r\n"},
-	{"cml", "application/cellml+xml\r\n"},
-	{"1clr", "application/clr\r\n"},
-	{"clue", "application/clue_info+xml\r\n"},
-	{"cmsc", "application/cms\r\n"},
-	{"cpl", "application/cpl+xml\r\n"},
-	{"csrattrs", "application/csrattrs\r\n"},
-	{"mpd", "application/dash+xml\r\n"},
-	{"mpdd", "application/dashdelta\r\n"},
-	{"davmount", "application/davmount+xml\r\n"},
-	{"dcd", "application/DCD\r\n"},
-	{"dcm", "application/dicom\r\n"},
-	{"dii", "application/DII\r\n"},
-	{"dit", "application/DIT\r\n"},
-	{"xmls", "application/dskpp+xml\r\n"},
-	{"dssc", "application/dssc+der\r\n"},
-	{"xdssc", "application/dssc+xml\r\n"},
-	{"dvc", "application/dvcs\r\n"},
-	{"es", "application/ecmascript\r\n"},
-	{"efi", "application/efi\r\n"},
-	{"emma", "application/emma+xml\r\n"},
-	{"emotionml", "application/emotionml+xml\r\n"},
-	{"epub", "application/epub+zip\r\n"},
-	{"exi", "application/exi\r\n"},
-	{"finf", "application/fastinfoset\r\n"},
-	{"fdt", "application/fdt+xml\r\n"},
-	{"pfr", "application/font-tdpfr\r\n"},
-	{"geojson", "application/geo+json\r\n"},
-	{"gpkg", "application/geopackage+sqlite3\r\n"},
-	{"glbin", "application/gltf-buffer\r\n"},
-	{"glbuf", "application/gltf-buffer\r\n"},
-	{"gml", "application/gml+xml\r\n"},
-	{"gz", "application/gzip\r\n"},
-	{"tgz", "application/gzip\r\n"},
-	{"stk", "application/hyperstudio\r\n"},
-	{"ink", "application/inkml+xml\r\n"},
-	{"inkml", "application/inkml+xml\r\n"},
-	{"ipfix", "application/ipfix\r\n"},
-	{"its", "application/its+xml\r\n"},
-	{"js", "application/javascript\r\n"},
-	{"jrd", "application/jrd+json\r\n"},
-	{"json", "application/json\r\n"},
-	{"json-patch", "application/json-patch+json\r\n"},
-	{"jsonld", "application/ld+json\r\n"},
-	{"lgr", "application/lgr+xml\r\n"},
-	{"wlnk", "application/link-format\r\n"},
-	{"lostxml", "application/lost+xml\r\n"},
-	{"lostsyncxml", "application/lostsync+xml\r\n"},
-	{"lpf", "application/lpf+zip\r\n"},
-	{"lxf", "application/LXF\r\n"},
-	{"hqx", "application/mac-binhex40\r\n"},
-	{"mads", "application/mads+xml\r\n"},
-	{"mrc", "application/marc\r\n"},
-	{"mrcx", "application/marcxml+xml\r\n"},
-	{"nb", "application/mathematica\r\n"},
-	{"ma", "application/mathematica\r\n"},
-	{"mb", "application/mathematica\r\n"},
-	{"mml", "application/mathml+xml\r\n"},
-	{"mbox", "application/mbox\r\n"},
-	{"meta4", "application/metalink4+xml\r\n"},
-	{"mets", "application/mets+xml\r\n"},
-	{"mf4", "application/MF4\r\n"},
-	{"h5", "application/mipc\r\n"},
-	{"maei", "application/mmt-aei+xml\r\n"},
-	{"musd", "application/mmt-usd+xml\r\n"},
-	{"mods", "application/mods+xml\r\n"},
-	{"m21", "application/mp21\r\n"},
-	{"mp21", "application/mp21\r\n"},
-	{"doc", "application/msword\r\n"},
-	{"mxf", "application/mxf\r\n"},
-	{"nq", "application/n-quads\r\n"},
-	{"nt", "application/n-triples\r\n"},
-	{"orq", "application/ocsp-request\r\n"},
-	{"ors", "application/ocsp-response\r\n"},
-	{"bin", "application/octet-stream\r\n"},
-	{"lha", "application/octet-stream\r\n"},
-	{"lzh", "application/octet-stream\r\n"},
-	{"exe", "application/octet-stream\r\n"},
-	{"class", "application/octet-stream\r\n"},
-	{"so", "application/octet-stream\r\n"},
-	{"dll", "application/octet-stream\r\n"},
-	{"img", "application/octet-stream\r\n"},
-	{"iso", "application/octet-stream\r\n"},
-	{"oda", "application/ODA\r\n"},
-	{"odx", "application/ODX\r\n"},
-	{"opf", "application/oebps-package+xml\r\n"},
-	{"ogx", "application/ogg\r\n"},
-	{"oxps", "application/oxps\r\n"},
-	{"relo", "application/p2p-overlay+xml\r\n"},
-	{"pdf", "application/pdf\r\n"},
-	{"pdx", "application/PDX\r\n"},
-	{"pem", "application/pem-certificate-chain\r\n"},
-	{"pgp", "application/pgp-encrypted\r\n"},
-	{"sig", "application/pgp-signature\r\n"},
-	{"p10", "application/pkcs10\r\n"},
-	{"p12", "application/pkcs12\r\n"},
-	{"pfx", "application/pkcs12\r\n"},
-	{"p7m", "application/pkcs7-mime\r\n"},
-	{"p7c", "application/pkcs7-mime\r\n"},
-	{"p7s", "application/pkcs7-signature\r\n"},
-	{"p8", "application/pkcs8\r\n"},
-	{"p8e", "application/pkcs8-encrypted\r\n"},
-	{"cer", "application/pkix-cert\r\n"},
-	{"crl", "application/pkix-crl\r\n"},
-	{"pkipath", "application/pkix-pkipath\r\n"},
-	{"pki", "application/pkixcmp\r\n"},
-	{"pls", "application/pls+xml\r\n"},
-	{"ps", "application/postscript\r\n"},
-	{"eps", "application/postscript\r\n"},
-	{"ai", "application/postscript\r\n"},
-	{"provx", "application/provenance+xml\r\n"},
-	{"cw", "application/prs.cww\r\n"},
-	{"cww", "application/prs.cww\r\n"},
-	{"hpub", "application/prs.hpub+zip\r\n"},
-	{"rnd", "application/prs.nprend\r\n"},
-	{"rct", "application/prs.nprend\r\n"},
-	{"rdf-crypt", "application/prs.rdf-xml-crypt\r\n"},
-	{"xsf", "application/prs.xsf+xml\r\n"},
-	{"pskcxml", "application/pskc+xml\r\n"},
-	{"rdf", "application/rdf+xml\r\n"},
-	{"rapd", "application/route-apd+xml\r\n"},
-	{"sls", "application/route-s-tsid+xml\r\n"},
-	{"rusd", "application/route-usd+xml\r\n"},
-	{"rif", "application/reginfo+xml\r\n"},
-	{"rnc", "application/relax-ng-compact-syntax\r\n"},
-	{"rld", "application/resource-lists-diff+xml\r\n"},
-	{"rl", "application/resource-lists+xml\r\n"},
-	{"rfcxml", "application/rfc+xml\r\n"},
-	{"rs", "application/rls-services+xml\r\n"},
-	{"gbr", "application/rpki-ghostbusters\r\n"},
-	{"mft", "application/rpki-manifest\r\n"},
-	{"roa", "application/rpki-roa\r\n"},
-	{"rtf", "application/rtf\r\n"},
-	{"sarif-external-properties", "application/sarif-external-properties+json\r\n"},
-	{"sarif-external-properties.json", "application/sarif-external-properties+json\r\n"},
-	{"sarif", "application/sarif+json\r\n"},
-	{"sarif.json", "application/sarif+json\r\n"},
-	{"scim", "application/scim+json\r\n"},
-	{"scq", "application/scvp-cv-request\r\n"},
-	{"scs", "application/scvp-cv-response\r\n"},
-	{"spq", "application/scvp-vp-request\r\n"},
-	{"spp", "application/scvp-vp-response\r\n"},
-	{"sdp", "application/sdp\r\n"},
-	{"senml-etchc", "application/senml-etch+cbor\r\n"},
-	{"senml-etchj", "application/senml-etch+json\r\n"},
-	{"senmlc", "application/senml+cbor\r\n"},
-	{"senml", "application/senml+json\r\n"},
-	{"senmlx", "application/senml+xml\r\n"},
-	{"senmle", "application/senml-exi\r\n"},
-	{"sensmlc", "application/sensml+cbor\r\n"},
-	{"sensml", "application/sensml+json\r\n"},
-	{"sensmlx", "application/sensml+xml\r\n"},
-	{"sensmle", "application/sensml-exi\r\n"},
-	{"soc", "application/sgml-open-catalog\r\n"},
-	{"shf", "application/shf+xml\r\n"},
-	{"siv", "application/sieve\r\n"},
-	{"sieve", "application/sieve\r\n"},
-	{"cl", "application/simple-filter+xml\r\n"},
-	{"smil", "application/smil+xml\r\n"},
-	{"smi", "application/smil+xml\r\n"},
-	{"sml", "application/smil+xml\r\n"},
-	{"rq", "application/sparql-query\r\n"},
-	{"srx", "application/sparql-results+xml\r\n"},
-	{"sql", "application/sql\r\n"},
-	{"gram", "application/srgs\r\n"},
-	{"grxml", "application/srgs+xml\r\n"},
-	{"sru", "application/sru+xml\r\n"},
-	{"ssml", "application/ssml+xml\r\n"},
-	{"stix", "application/stix+json\r\n"},
-	{"swidtag", "application/swid+xml\r\n"},
-	{"tau", "application/tamp-apex-update\r\n"},
-	{"auc", "application/tamp-apex-update-confirm\r\n"},
-	{"tcu", "application/tamp-community-update\r\n"},
-	{"cuc", "application/tamp-community-update-confirm\r\n"},
-	{"jsontd", "application/td+json\r\n"},
-	{"ter", "application/tamp-error\r\n"},
-	{"tsa", "application/tamp-sequence-adjust\r\n"},
-	{"sac", "application/tamp-sequence-adjust-confirm\r\n"},
-	{"tur", "application/tamp-update\r\n"},
-	{"tuc", "application/tamp-update-confirm\r\n"},
-	{"tei", "application/tei+xml\r\n"},
-	{"teiCorpus", "application/tei+xml\r\n"},
-	{"odd", "application/tei+xml\r\n"},
-	{"tfi", "application/thraud+xml\r\n"},
-	{"tsq", "application/timestamp-query\r\n"},
-	{"tsr", "application/timestamp-reply\r\n"},
-	{"tsd", "application/timestamped-data\r\n"},
-	{"trig", "application/trig\r\n"},
-	{"ttml", "application/ttml+xml\r\n"},
-	{"gsheet", "application/urc-grpsheet+xml\r\n"},
-	{"rsheet", "application/urc-ressheet+xml\r\n"},
-	{"td", "application/urc-targetdesc+xml\r\n"},
-	{"uis", "application/urc-uisocketdesc+xml\r\n"},
-	{"1km", "application/vnd.1000minds.decision-model+xml\r\n"},
-	{"plb", "application/vnd.3gpp.pic-bw-large\r\n"},
-	{"psb", "application/vnd.3gpp.pic-bw-small\r\n"},
-	{"pvb", "application/vnd.3gpp.pic-bw-var\r\n"},
-	{"sms", "application/vnd.3gpp2.sms\r\n"},
-	{"tcap", "application/vnd.3gpp2.tcap\r\n"},
-	{"imgcal", "application/vnd.3lightssoftware.imagescal\r\n"},
-	{"pwn", "application/vnd.3M.Post-it-Notes\r\n"},
-	{"aso", "application/vnd.accpac.simply.aso\r\n"},
-	{"imp", "application/vnd.accpac.simply.imp\r\n"},
-	{"acu", "application/vnd.acucobol\r\n"},
-	{"atc", "application/vnd.acucorp\r\n"},
-	{"acutc", "application/vnd.acucorp\r\n"},
-	{"swf", "application/vnd.adobe.flash.movie\r\n"},
-	{"fcdt", "application/vnd.adobe.formscentral.fcdt\r\n"},
-	{"fxp", "application/vnd.adobe.fxp\r\n"},
-	{"fxpl", "application/vnd.adobe.fxp\r\n"},
-	{"xdp", "application/vnd.adobe.xdp+xml\r\n"},
-	{"xfdf", "application/vnd.adobe.xfdf\r\n"},
-	{"list3820", "application/vnd.afpc.modca\r\n"},
-	{"listafp", "application/vnd.afpc.modca\r\n"},
-	{"afp", "application/vnd.afpc.modca\r\n"},
-	{"pseg3820", "application/vnd.afpc.modca\r\n"},
-	{"ovl", "application/vnd.afpc.modca-overlay\r\n"},
-	{"psg", "application/vnd.afpc.modca-pagesegment\r\n"},
-	{"ahead", "application/vnd.ahead.space\r\n"},
-	{"azf", "application/vnd.airzip.filesecure.azf\r\n"},
-	{"azs", "application/vnd.airzip.filesecure.azs\r\n"},
-	{"azw3", "application/vnd.amazon.mobi8-ebook\r\n"},
-	{"acc", "application/vnd.americandynamics.acc\r\n"},
-	{"ami", "application/vnd.amiga.ami\r\n"},
-	{"ota", "application/vnd.android.ota\r\n"},
-	{"apkg", "application/vnd.anki\r\n"},
-	{"cii", "application/vnd.anser-web-certificate-issue-initiation\r\n"},
-	{"fti", "application/vnd.anser-web-funds-transfer-initiation\r\n"},
-	{"dist", "application/vnd.apple.installer+xml\r\n"},
-	{"distz", "application/vnd.apple.installer+xml\r\n"},
-	{"pkg", "application/vnd.apple.installer+xml\r\n"},
-	{"mpkg", "application/vnd.apple.installer+xml\r\n"},
-	{"keynote", "application/vnd.apple.keynote\r\n"},
-	{"m3u8", "application/vnd.apple.mpegurl\r\n"},
-	{"numbers", "application/vnd.apple.numbers\r\n"},
-	{"pages", "application/vnd.apple.pages\r\n"},
-	{"swi", "application/vnd.aristanetworks.swi\r\n"},
-	{"artisan", "application/vnd.artisan+json\r\n"},
-	{"iota", "application/vnd.astraea-software.iota\r\n"},
-	{"aep", "application/vnd.audiograph\r\n"},
-	{"package", "application/vnd.autopackage\r\n"},
-	{"bmml", "application/vnd.balsamiq.bmml+xml\r\n"},
-	{"ac2", "application/vnd.banana-accounting\r\n"},
-	{"bmpr", "application/vnd.balsamiq.bmpr\r\n"},
-	{"mpm", "application/vnd.blueice.multipass\r\n"},
-	{"ep", "application/vnd.bluetooth.ep.oob\r\n"},
-	{"le", "application/vnd.bluetooth.le.oob\r\n"},
-	{"bmi", "application/vnd.bmi\r\n"},
-	{"rep", "application/vnd.businessobjects\r\n"},
-	{"tlclient", "application/vnd.cendio.thinlinc.clientconf\r\n"},
-	{"cdxml", "application/vnd.chemdraw+xml\r\n"},
-	{"pgn", "application/vnd.chess-pgn\r\n"},
-	{"mmd", "application/vnd.chipnuts.karaoke-mmd\r\n"},
-	{"cdy", "application/vnd.cinderella\r\n"},
-	{"csl", "application/vnd.citationstyles.style+xml\r\n"},
-	{"cla", "application/vnd.claymore\r\n"},
-	{"rp9", "application/vnd.cloanto.rp9\r\n"},
-	{"c4g", "application/vnd.clonk.c4group\r\n"},
-	{"c4d", "application/vnd.clonk.c4group\r\n"},
-	{"c4f", "application/vnd.clonk.c4group\r\n"},
-	{"c4p", "application/vnd.clonk.c4group\r\n"},
-	{"c4u", "application/vnd.clonk.c4group\r\n"},
-	{"c11amc", "application/vnd.cluetrust.cartomobile-config\r\n"},
-	{"c11amz", "application/vnd.cluetrust.cartomobile-config-pkg\r\n"},
-	{"coffee", "application/vnd.coffeescript\r\n"},
-	{"xodt", "application/vnd.collabio.xodocuments.document\r\n"},
-	{"xott", "application/vnd.collabio.xodocuments.document-template\r\n"},
-	{"xodp", "application/vnd.collabio.xodocuments.presentation\r\n"},
-	{"xotp", "application/vnd.collabio.xodocuments.presentation-template\r\n"},
-	{"xods", "application/vnd.collabio.xodocuments.spreadsheet\r\n"},
-	{"xots", "application/vnd.collabio.xodocuments.spreadsheet-template\r\n"},
-	{"cbr", "application/vnd.comicbook-rar\r\n"},
-	{"cbz", "application/vnd.comicbook+zip\r\n"},
-	{"ica", "application/vnd.commerce-battelle\r\n"},
-	{"icf", "application/vnd.commerce-battelle\r\n"},
-	{"icd", "application/vnd.commerce-battelle\r\n"},
-	{"ic0", "application/vnd.commerce-battelle\r\n"},
-	{"ic1", "application/vnd.commerce-battelle\r\n"},
-	{"ic2", "application/vnd.commerce-battelle\r\n"},
-	{"ic3", "application/vnd.commerce-battelle\r\n"},
-	{"ic4", "application/vnd.commerce-battelle\r\n"},
-	{"ic5", "application/vnd.commerce-battelle\r\n"},
-	{"ic6", "application/vnd.commerce-battelle\r\n"},
-	{"ic7", "application/vnd.commerce-battelle\r\n"},
-	{"ic8", "application/vnd.commerce-battelle\r\n"},
-	{"csp", "application/vnd.commonspace\r\n"},
-	{"cst", "application/vnd.commonspace\r\n"},
-	{"cdbcmsg", "application/vnd.contact.cmsg\r\n"},
-	{"ign", "application/vnd.coreos.ignition+json\r\n"},
-	{"ignition", "application/vnd.coreos.ignition+json\r\n"},
-	{"cmc", "application/vnd.cosmocaller\r\n"},
-	{"clkx", "application/vnd.crick.clicker\r\n"},
-	{"clkk", "application/vnd.crick.clicker.keyboard\r\n"},
-	{"clkp", "application/vnd.crick.clicker.palette\r\n"},
-	{"clkt", "application/vnd.crick.clicker.template\r\n"},
-	{"clkw", "application/vnd.crick.clicker.wordbank\r\n"},
-	{"wbs", "application/vnd.criticaltools.wbs+xml\r\n"},
-	{"ssvc", "application/vnd.crypto-shade-file\r\n"},
-	{"c9r", "application/vnd.cryptomator.encrypted\r\n"},
-	{"c9s", "application/vnd.cryptomator.encrypted\r\n"},
-	{"cryptomator", "application/vnd.cryptomator.vault\r\n"},
-	{"pml", "application/vnd.ctc-posml\r\n"},
-	{"ppd", "application/vnd.cups-ppd\r\n"},
-	{"curl", "application/vnd.curl\r\n"},
-	{"dart", "application/vnd.dart\r\n"},
-	{"rdz", "application/vnd.data-vision.rdz\r\n"},
-	{"dbf", "application/vnd.dbf\r\n"},
-	{"deb", "application/vnd.debian.binary-package\r\n"},
-	{"udeb", "application/vnd.debian.binary-package\r\n"},
-	{"uvf", "application/vnd.dece.data\r\n"},
-	{"uvvf", "application/vnd.dece.data\r\n"},
-	{"uvd", "application/vnd.dece.data\r\n"},
-	{"uvvd", "application/vnd.dece.data\r\n"},
-	{"uvt", "application/vnd.dece.ttml+xml\r\n"},
-	{"uvvt", "application/vnd.dece.ttml+xml\r\n"},
-	{"uvx", "application/vnd.dece.unspecified\r\n"},
-	{"uvvx", "application/vnd.dece.unspecified\r\n"},
-	{"uvz", "application/vnd.dece.zip\r\n"},
-	{"uvvz", "application/vnd.dece.zip\r\n"},
-	{"fe_launch", "application/vnd.denovo.fcselayout-link\r\n"},
-	{"dsm", "application/vnd.desmume.movie\r\n"},
-	{"dna", "application/vnd.dna\r\n"},
-	{"docjson", "application/vnd.document+json\r\n"},
-	{"scld", "application/vnd.doremir.scorecloud-binary-document\r\n"},
-	{"dpg", "application/vnd.dpgraph\r\n"},
-	{"mwc", "application/vnd.dpgraph\r\n"},
-	{"dpgraph", "application/vnd.dpgraph\r\n"},
-	{"dfac", "application/vnd.dreamfactory\r\n"},
-	{"fla", "application/vnd.dtg.local.flash\r\n"},
-	{"ait", "application/vnd.dvb.ait\r\n"},
-	{"svc", "application/vnd.dvb.service\r\n"},
-	{"geo", "application/vnd.dynageo\r\n"},
-	{"dzr", "application/vnd.dzr\r\n"},
-	{"mag", "application/vnd.ecowin.chart\r\n"},
-	{"nml", "application/vnd.enliven\r\n"},
-	{"esf", "application/vnd.epson.esf\r\n"},
-	{"msf", "application/vnd.epson.msf\r\n"},
-	{"qam", "application/vnd.epson.quickanime\r\n"},
-	{"slt", "application/vnd.epson.salt\r\n"},
-	{"ssf", "application/vnd.epson.ssf\r\n"},
-	{"qcall", "application/vnd.ericsson.quickcall\r\n"},
-	{"qca", "application/vnd.ericsson.quickcall\r\n"},
-	{"espass", "application/vnd.espass-espass+zip\r\n"},
-	{"es3", "application/vnd.eszigno3+xml\r\n"},
-	{"et3", "application/vnd.eszigno3+xml\r\n"},
-	{"asice", "application/vnd.etsi.asic-e+zip\r\n"},
-	{"sce", "application/vnd.etsi.asic-e+zip\r\n"},
-	{"asics", "application/vnd.etsi.asic-s+zip\r\n"},
-	{"tst", "application/vnd.etsi.timestamp-token\r\n"},
-	{"mpw", "application/vnd.exstream-empower+zip\r\n"},
-	{"pub", "application/vnd.exstream-package\r\n"},
-	{"ecigprofile", "application/vnd.evolv.ecig.profile\r\n"},
-	{"ecig", "application/vnd.evolv.ecig.settings\r\n"},
-	{"ecigtheme", "application/vnd.evolv.ecig.theme\r\n"},
-	{"ez2", "application/vnd.ezpix-album\r\n"},
-	{"ez3", "application/vnd.ezpix-package\r\n"},
-	{"dim", "application/vnd.fastcopy-disk-image\r\n"},
-	{"fdf", "application/vnd.fdf\r\n"},
-	{"msd", "application/vnd.fdsn.mseed\r\n"},
-	{"mseed", "application/vnd.fdsn.mseed\r\n"},
-	{"seed", "application/vnd.fdsn.seed\r\n"},
-	{"dataless", "application/vnd.fdsn.seed\r\n"},
-	{"flb", "application/vnd.ficlab.flb+zip\r\n"},
-	{"zfc", "application/vnd.filmit.zfc\r\n"},
-	{"gph", "application/vnd.FloGraphIt\r\n"},
-	{"ftc", "application/vnd.fluxtime.clip\r\n"},
-	{"sfd", "application/vnd.font-fontforge-sfd\r\n"},
-	{"fm", "application/vnd.framemaker\r\n"},
-	{"fnc", "application/vnd.frogans.fnc\r\n"},
-	{"ltf", "application/vnd.frogans.ltf\r\n"},
-	{"fsc", "application/vnd.fsc.weblaunch\r\n"},
-	{"oas", "application/vnd.fujitsu.oasys\r\n"},
-	{"oa2", "application/vnd.fujitsu.oasys2\r\n"},
-	{"oa3", "application/vnd.fujitsu.oasys3\r\n"},
-	{"fg5", "application/vnd.fujitsu.oasysgp\r\n"},
-	{"bh2", "application/vnd.fujitsu.oasysprs\r\n"},
-	{"ddd", "application/vnd.fujixerox.ddd\r\n"},
-	{"xdw", "application/vnd.fujixerox.docuworks\r\n"},
-	{"xbd", "application/vnd.fujixerox.docuworks.binder\r\n"},
-	{"xct", "application/vnd.fujixerox.docuworks.container\r\n"},
-	{"fzs", "application/vnd.fuzzysheet\r\n"},
-	{"txd", "application/vnd.genomatix.tuxedo\r\n"},
-	{"g3", "application/vnd.geocube+xml\r\n"},
-	{"g³", "application/vnd.geocube+xml\r\n"},
-	{"ggb", "application/vnd.geogebra.file\r\n"},
-	{"ggs", "application/vnd.geogebra.slides\r\n"},
-	{"ggt", "application/vnd.geogebra.tool\r\n"},
-	{"gex", "application/vnd.geometry-explorer\r\n"},
-	{"gre", "application/vnd.geometry-explorer\r\n"},
-	{"gxt", "application/vnd.geonext\r\n"},
-	{"g2w", "application/vnd.geoplan\r\n"},
-	{"g3w", "application/vnd.geospace\r\n"},
-	{"gmx", "application/vnd.gmx\r\n"},
-	{"kml", "application/vnd.google-earth.kml+xml\r\n"},
-	{"kmz", "application/vnd.google-earth.kmz\r\n"},
-	{"gqf", "application/vnd.grafeq\r\n"},
-	{"gqs", "application/vnd.grafeq\r\n"},
-	{"gac", "application/vnd.groove-account\r\n"},
-	{"ghf", "application/vnd.groove-help\r\n"},
-	{"gim", "application/vnd.groove-identity-message\r\n"},
-	{"grv", "application/vnd.groove-injector\r\n"},
-	{"gtm", "application/vnd.groove-tool-message\r\n"},
-	{"tpl", "application/vnd.groove-tool-template\r\n"},
-	{"vcg", "application/vnd.groove-vcard\r\n"},
-	{"hal", "application/vnd.hal+xml\r\n"},
-	{"zmm", "application/vnd.HandHeld-Entertainment+xml\r\n"},
-	{"hbci", "application/vnd.hbci\r\n"},
-	{"hbc", "application/vnd.hbci\r\n"},
-	{"kom", "application/vnd.hbci\r\n"},
-	{"upa", "application/vnd.hbci\r\n"},
-	{"pkd", "application/vnd.hbci\r\n"},
-	{"bpd", "application/vnd.hbci\r\n"},
-	{"hdt", "application/vnd.hdt\r\n"},
-	{"les", "application/vnd.hhe.lesson-player\r\n"},
-	{"hpgl", "application/vnd.hp-HPGL\r\n"},
-	{"hpi", "application/vnd.hp-hpid\r\n"},
-	{"hpid", "application/vnd.hp-hpid\r\n"},
-	{"hps", "application/vnd.hp-hps\r\n"},
-	{"jlt", "application/vnd.hp-jlyt\r\n"},
-	{"pcl", "application/vnd.hp-PCL\r\n"},
-	{"sfd-hdstx", "application/vnd.hydrostatix.sof-data\r\n"},
-	{"x3d", "application/vnd.hzn-3d-crossword\r\n"},
-	{"emm", "application/vnd.ibm.electronic-media\r\n"},
-	{"mpy", "application/vnd.ibm.MiniPay\r\n"},
-	{"irm", "application/vnd.ibm.rights-management\r\n"},
-	{"sc", "application/vnd.ibm.secure-container\r\n"},
-	{"icc", "application/vnd.iccprofile\r\n"},
-	{"icm", "application/vnd.iccprofile\r\n"},
-	{"1905.1", "application/vnd.ieee.1905\r\n"},
-	{"igl", "application/vnd.igloader\r\n"},
-	{"imf", "application/vnd.imagemeter.folder+zip\r\n"},
-	{"imi", "application/vnd.imagemeter.image+zip\r\n"},
-	{"ivp", "application/vnd.immervision-ivp\r\n"},
-	{"ivu", "application/vnd.immervision-ivu\r\n"},
-	{"imscc", "application/vnd.ims.imsccv1p1\r\n"},
-	{"igm", "application/vnd.insors.igm\r\n"},
-	{"xpw", "application/vnd.intercon.formnet\r\n"},
-	{"xpx", "application/vnd.intercon.formnet\r\n"},
-	{"i2g", "application/vnd.intergeo\r\n"},
-	{"qbo", "application/vnd.intu.qbo\r\n"},
-	{"qfx", "application/vnd.intu.qfx\r\n"},
-	{"rcprofile", "application/vnd.ipunplugged.rcprofile\r\n"},
-	{"irp", "application/vnd.irepository.package+xml\r\n"},
-	{"xpr", "application/vnd.is-xpr\r\n"},
-	{"fcs", "application/vnd.isac.fcs\r\n"},
-	{"jam", "application/vnd.jam\r\n"},
-	{"rms", "application/vnd.jcp.javame.midlet-rms\r\n"},
-	{"jisp", "application/vnd.jisp\r\n"},
-	{"joda", "application/vnd.joost.joda-archive\r\n"},
-	{"ktz", "application/vnd.kahootz\r\n"},
-	{"ktr", "application/vnd.kahootz\r\n"},
-	{"karbon", "application/vnd.kde.karbon\r\n"},
-	{"chrt", "application/vnd.kde.kchart\r\n"},
-	{"kfo", "application/vnd.kde.kformula\r\n"},
-	{"flw", "application/vnd.kde.kivio\r\n"},
-	{"kon", "application/vnd.kde.kontour\r\n"},
-	{"kpr", "application/vnd.kde.kpresenter\r\n"},
-	{"kpt", "application/vnd.kde.kpresenter\r\n"},
-	{"ksp", "application/vnd.kde.kspread\r\n"},
-	{"kwd", "application/vnd.kde.kword\r\n"},
-	{"kwt", "application/vnd.kde.kword\r\n"},
-	{"htke", "application/vnd.kenameaapp\r\n"},
-	{"kia", "application/vnd.kidspiration\r\n"},
-	{"kne", "application/vnd.Kinar\r\n"},
-	{"knp", "application/vnd.Kinar\r\n"},
-	{"sdf", "application/vnd.Kinar\r\n"},
-	{"skp", "application/vnd.koan\r\n"},
-	{"skd", "application/vnd.koan\r\n"},
-	{"skm", "application/vnd.koan\r\n"},
-	{"skt", "application/vnd.koan\r\n"},
-	{"sse", "application/vnd.kodak-descriptor\r\n"},
-	{"las", "application/vnd.las\r\n"},
-	{"lasjson", "application/vnd.las.las+json\r\n"},
-	{"lasxml", "application/vnd.las.las+xml\r\n"},
-	{"lbd", "application/vnd.llamagraphics.life-balance.desktop\r\n"},
-	{"lbe", "application/vnd.llamagraphics.life-balance.exchange+xml\r\n"},
-	{"lcs", "application/vnd.logipipe.circuit+zip\r\n"},
-	{"lca", "application/vnd.logipipe.circuit+zip\r\n"},
-	{"loom", "application/vnd.loom\r\n"},
-	{"123", "application/vnd.lotus-1-2-3\r\n"},
-	{"wk4", "application/vnd.lotus-1-2-3\r\n"},
-	{"wk3", "application/vnd.lotus-1-2-3\r\n"},
-	{"wk1", "application/vnd.lotus-1-2-3\r\n"},
-	{"apr", "application/vnd.lotus-approach\r\n"},
-	{"vew", "application/vnd.lotus-approach\r\n"},
-	{"prz", "application/vnd.lotus-freelance\r\n"},
-	{"pre", "application/vnd.lotus-freelance\r\n"},
-	{"nsf", "application/vnd.lotus-notes\r\n"},
-	{"ntf", "application/vnd.lotus-notes\r\n"},
-	{"ndl", "application/vnd.lotus-notes\r\n"},
-	{"ns4", "application/vnd.lotus-notes\r\n"},
-	{"ns3", "application/vnd.lotus-notes\r\n"},
-	{"ns2", "application/vnd.lotus-notes\r\n"},
-	{"nsh", "application/vnd.lotus-notes\r\n"},
-	{"nsg", "application/vnd.lotus-notes\r\n"},
-	{"or3", "application/vnd.lotus-organizer\r\n"},
-	{"or2", "application/vnd.lotus-organizer\r\n"},
-	{"org", "application/vnd.lotus-organizer\r\n"},
-	{"scm", "application/vnd.lotus-screencam\r\n"},
-	{"lwp", "application/vnd.lotus-wordpro\r\n"},
-	{"sam", "application/vnd.lotus-wordpro\r\n"},
-	{"portpkg", "application/vnd.macports.portpkg\r\n"},
-	{"mvt", "application/vnd.mapbox-vector-tile\r\n"},
-	{"mdc", "application/vnd.marlin.drm.mdcf\r\n"},
-	{"mmdb", "application/vnd.maxmind.maxmind-db\r\n"},
-	{"mcd", "application/vnd.mcd\r\n"},
-	{"mc1", "application/vnd.medcalcdata\r\n"},
-	{"cdkey", "application/vnd.mediastation.cdkey\r\n"},
-	{"mwf", "application/vnd.MFER\r\n"},
-	{"mfm", "application/vnd.mfmp\r\n"},
-	{"flo", "application/vnd.micrografx.flo\r\n"},
-	{"igx", "application/vnd.micrografx.igx\r\n"},
-	{"mif", "application/vnd.mif\r\n"},
-	{"daf", "application/vnd.Mobius.DAF\r\n"},
-	{"dis", "application/vnd.Mobius.DIS\r\n"},
-	{"mbk", "application/vnd.Mobius.MBK\r\n"},
-	{"mqy", "application/vnd.Mobius.MQY\r\n"},
-	{"msl", "application/vnd.Mobius.MSL\r\n"},
-	{"plc", "application/vnd.Mobius.PLC\r\n"},
-	{"txf", "application/vnd.Mobius.TXF\r\n"},
-	{"mpn", "application/vnd.mophun.application\r\n"},
-	{"mpc", "application/vnd.mophun.certificate\r\n"},
-	{"xul", "application/vnd.mozilla.xul+xml\r\n"},
-	{"3mf", "application/vnd.ms-3mfdocument\r\n"},
-	{"cil", "application/vnd.ms-artgalry\r\n"},
-	{"asf", "application/vnd.ms-asf\r\n"},
-	{"cab", "application/vnd.ms-cab-compressed\r\n"},
-	{"xls", "application/vnd.ms-excel\r\n"},
-	{"xlm", "application/vnd.ms-excel\r\n"},
-	{"xla", "application/vnd.ms-excel\r\n"},
-	{"xlc", "application/vnd.ms-excel\r\n"},
-	{"xlt", "application/vnd.ms-excel\r\n"},
-	{"xlw", "application/vnd.ms-excel\r\n"},
-	{"xltm", "application/vnd.ms-excel.template.macroEnabled.12\r\n"},
-	{"xlam", "application/vnd.ms-excel.addin.macroEnabled.12\r\n"},
-	{"xlsb", "application/vnd.ms-excel.sheet.binary.macroEnabled.12\r\n"},
-	{"xlsm", "application/vnd.ms-excel.sheet.macroEnabled.12\r\n"},
-	{"eot", "application/vnd.ms-fontobject\r\n"},
-	{"chm", "application/vnd.ms-htmlhelp\r\n"},
-	{"ims", "application/vnd.ms-ims\r\n"},
-	{"lrm", "application/vnd.ms-lrm\r\n"},
-	{"thmx", "application/vnd.ms-officetheme\r\n"},
-	{"ppt", "application/vnd.ms-powerpoint\r\n"},
-	{"pps", "application/vnd.ms-powerpoint\r\n"},
-	{"pot", "application/vnd.ms-powerpoint\r\n"},
-	{"ppam", "application/vnd.ms-powerpoint.addin.macroEnabled.12\r\n"},
-	{"pptm", "application/vnd.ms-powerpoint.presentation.macroEnabled.12\r\n"},
-	{"sldm", "application/vnd.ms-powerpoint.slide.macroEnabled.12\r\n"},
-	{"ppsm", "application/vnd.ms-powerpoint.slideshow.macroEnabled.12\r\n"},
-	{"potm", "application/vnd.ms-powerpoint.template.macroEnabled.12\r\n"},
-	{"mpp", "application/vnd.ms-project\r\n"},
-	{"mpt", "application/vnd.ms-project\r\n"},
-	{"tnef", "application/vnd.ms-tnef\r\n"},
-	{"tnf", "application/vnd.ms-tnef\r\n"},
-	{"docm", "application/vnd.ms-word.document.macroEnabled.12\r\n"},
-	{"dotm", "application/vnd.ms-word.template.macroEnabled.12\r\n"},
-	{"wcm", "application/vnd.ms-works\r\n"},
-	{"wdb", "application/vnd.ms-works\r\n"},
-	{"wks", "application/vnd.ms-works\r\n"},
-	{"wps", "application/vnd.ms-works\r\n"},
-	{"wpl", "application/vnd.ms-wpl\r\n"},
-	{"xps", "application/vnd.ms-xpsdocument\r\n"},
-	{"msa", "application/vnd.msa-disk-image\r\n"},
-	{"mseq", "application/vnd.mseq\r\n"},
-	{"crtr", "application/vnd.multiad.creator\r\n"},
-	{"cif", "application/vnd.multiad.creator.cif\r\n"},
-	{"mus", "application/vnd.musician\r\n"},
-	{"msty", "application/vnd.muvee.style\r\n"},
-	{"taglet", "application/vnd.mynfc\r\n"},
-	{"nebul", "application/vnd.nebumind.line\r\n"},
-	{"line", "application/vnd.nebumind.line\r\n"},
-	{"entity", "application/vnd.nervana\r\n"},
-	{"request", "application/vnd.nervana\r\n"},
-	{"bkm", "application/vnd.nervana\r\n"},
-	{"kcm", "application/vnd.nervana\r\n"},
-	{"nimn", "application/vnd.nimn\r\n"},
-	{"nitf", "application/vnd.nitf\r\n"},
-	{"nlu", "application/vnd.neurolanguage.nlu\r\n"},
-	{"nds", "application/vnd.nintendo.nitro.rom\r\n"},
-	{"sfc", "application/vnd.nintendo.snes.rom\r\n"},
-	{"smc", "application/vnd.nintendo.snes.rom\r\n"},
-	{"nnd", "application/vnd.noblenet-directory\r\n"},
-	{"nns", "application/vnd.noblenet-sealer\r\n"},
-	{"nnw", "application/vnd.noblenet-web\r\n"},
-	{"ac", "application/vnd.nokia.n-gage.ac+xml\r\n"},
-	{"ngdat", "application/vnd.nokia.n-gage.data\r\n"},
-	{"n-gage", "application/vnd.nokia.n-gage.symbian.install\r\n"},
-	{"rpst", "application/vnd.nokia.radio-preset\r\n"},
-	{"rpss", "application/vnd.nokia.radio-presets\r\n"},
-	{"edm", "application/vnd.novadigm.EDM\r\n"},
-	{"edx", "application/vnd.novadigm.EDX\r\n"},
-	{"ext", "application/vnd.novadigm.EXT\r\n"},
-	{"odc", "application/vnd.oasis.opendocument.chart\r\n"},
-	{"otc", "application/vnd.oasis.opendocument.chart-template\r\n"},
-	{"odb", "application/vnd.oasis.opendocument.database\r\n"},
-	{"odf", "application/vnd.oasis.opendocument.formula\r\n"},
-	{"odg", "application/vnd.oasis.opendocument.graphics\r\n"},
-	{"otg", "application/vnd.oasis.opendocument.graphics-template\r\n"},
-	{"odi", "application/vnd.oasis.opendocument.image\r\n"},
-	{"oti", "application/vnd.oasis.opendocument.image-template\r\n"},
-	{"odp", "application/vnd.oasis.opendocument.presentation\r\n"},
-	{"otp", "application/vnd.oasis.opendocument.presentation-template\r\n"},
-	{"ods", "application/vnd.oasis.opendocument.spreadsheet\r\n"},
-	{"ots", "application/vnd.oasis.opendocument.spreadsheet-template\r\n"},
-	{"odt", "application/vnd.oasis.opendocument.text\r\n"},
-	{"odm", "application/vnd.oasis.opendocument.text-master\r\n"},
-	{"ott", "application/vnd.oasis.opendocument.text-template\r\n"},
-	{"oth", "application/vnd.oasis.opendocument.text-web\r\n"},
-	{"xo", "application/vnd.olpc-sugar\r\n"},
-	{"dd2", "application/vnd.oma.dd2+xml\r\n"},
-	{"tam", "application/vnd.onepager\r\n"},
-	{"tamp", "application/vnd.onepagertamp\r\n"},
-	{"tamx", "application/vnd.onepagertamx\r\n"},
-	{"tat", "application/vnd.onepagertat\r\n"},
-	{"tatp", "application/vnd.onepagertatp\r\n"},
-	{"tatx", "application/vnd.onepagertatx\r\n"},
-	{"obgx", "application/vnd.openblox.game+xml\r\n"},
-	{"obg", "application/vnd.openblox.game-binary\r\n"},
-	{"oeb", "application/vnd.openeye.oeb\r\n"},
-	{"oxt", "application/vnd.openofficeorg.extension\r\n"},
-	{"osm", "application/vnd.openstreetmap.data+xml\r\n"},
-	{"pptx", "application/vnd.openxmlformats-officedocument.presentationml.presentation\r\n"},
-	{"sldx", "application/vnd.openxmlformats-officedocument.presentationml.slide\r\n"},
-	{"ppsx", "application/vnd.openxmlformats-officedocument.presentationml.slideshow\r\n"},
-	{"potx", "application/vnd.openxmlformats-officedocument.presentationml.template\r\n"},
-	{"xlsx", "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet\r\n"},
-	{"xltx", "application/vnd.openxmlformats-officedocument.spreadsheetml.template\r\n"},
-	{"docx", "application/vnd.openxmlformats-officedocument.wordprocessingml.document\r\n"},
-	{"dotx", "application/vnd.openxmlformats-officedocument.wordprocessingml.template\r\n"},
-	{"ndc", "application/vnd.osa.netdeploy\r\n"},
-	{"mgp", "application/vnd.osgeo.mapguide.package\r\n"},
-	{"dp", "application/vnd.osgi.dp\r\n"},
-	{"esa", "application/vnd.osgi.subsystem\r\n"},
-	{"oxlicg", "application/vnd.oxli.countgraph\r\n"},
-	{"prc", "application/vnd.palm\r\n"},
-	{"pdb", "application/vnd.palm\r\n"},
-	{"pqa", "application/vnd.palm\r\n"},
-	{"oprc", "application/vnd.palm\r\n"},
-	{"plp", "application/vnd.panoply\r\n"},
-	{"dive", "application/vnd.patentdive\r\n"},
-	{"paw", "application/vnd.pawaafile\r\n"},
-	{"str", "application/vnd.pg.format\r\n"},
-	{"ei6", "application/vnd.pg.osasli\r\n"},
-	{"pil", "application/vnd.piaccess.application-licence\r\n"},
-	{"efif", "application/vnd.picsel\r\n"},
-	{"wg", "application/vnd.pmi.widget\r\n"},
-	{"plf", "application/vnd.pocketlearn\r\n"},
-	{"pbd", "application/vnd.powerbuilder6\r\n"},
-	{"preminet", "application/vnd.preminet\r\n"},
-	{"box", "application/vnd.previewsystems.box\r\n"},
-	{"vbox", "application/vnd.previewsystems.box\r\n"},
-	{"mgz", "application/vnd.proteus.magazine\r\n"},
-	{"psfs", "application/vnd.psfs\r\n"},
-	{"qps", "application/vnd.publishare-delta-tree\r\n"},
-	{"ptid", "application/vnd.pvi.ptid1\r\n"},
-	{"bar", "application/vnd.qualcomm.brew-app-res\r\n"},
-	{"qxd", "application/vnd.Quark.QuarkXPress\r\n"},
-	{"qxt", "application/vnd.Quark.QuarkXPress\r\n"},
-	{"qwd", "application/vnd.Quark.QuarkXPress\r\n"},
-	{"qwt", "application/vnd.Quark.QuarkXPress\r\n"},
-	{"qxl", "application/vnd.Quark.QuarkXPress\r\n"},
-	{"qxb", "application/vnd.Quark.QuarkXPress\r\n"},
-	{"quox", "application/vnd.quobject-quoxdocument\r\n"},
-	{"quiz", "application/vnd.quobject-quoxdocument\r\n"},
-	{"tree", "application/vnd.rainstor.data\r\n"},
-	{"rar", "application/vnd.rar\r\n"},
-	{"bed", "application/vnd.realvnc.bed\r\n"},
-	{"mxl", "application/vnd.recordare.musicxml\r\n"},
-	{"cryptonote", "application/vnd.rig.cryptonote\r\n"},
-	{"link66", "application/vnd.route66.link66+xml\r\n"},
-	{"st", "application/vnd.sailingtracker.track\r\n"},
-	{"SAR", "application/vnd.sar\r\n"},
-	{"scd", "application/vnd.scribus\r\n"},
-	{"sla", "application/vnd.scribus\r\n"},
-	{"slaz", "application/vnd.scribus\r\n"},
-	{"s3df", "application/vnd.sealed.3df\r\n"},
-	{"scsf", "application/vnd.sealed.csf\r\n"},
-	{"sdoc", "application/vnd.sealed.doc\r\n"},
-	{"sdo", "application/vnd.sealed.doc\r\n"},
-	{"s1w", "application/vnd.sealed.doc\r\n"},
-	{"seml", "application/vnd.sealed.eml\r\n"},
-	{"sem", "application/vnd.sealed.eml\r\n"},
-	{"smht", "application/vnd.sealed.mht\r\n"},
-	{"smh", "application/vnd.sealed.mht\r\n"},
-	{"sppt", "application/vnd.sealed.ppt\r\n"},
-	{"s1p", "application/vnd.sealed.ppt\r\n"},
-	{"stif", "application/vnd.sealed.tiff\r\n"},
-	{"sxls", "application/vnd.sealed.xls\r\n"},
-	{"sxl", "application/vnd.sealed.xls\r\n"},
-	{"s1e", "application/vnd.sealed.xls\r\n"},
-	{"stml", "application/vnd.sealedmedia.softseal.html\r\n"},
-	{"s1h", "application/vnd.sealedmedia.softseal.html\r\n"},
-	{"spdf", "application/vnd.sealedmedia.softseal.pdf\r\n"},
-	{"spd", "application/vnd.sealedmedia.softseal.pdf\r\n"},
-	{"s1a", "application/vnd.sealedmedia.softseal.pdf\r\n"},
-	{"see", "application/vnd.seemail\r\n"},
-	{"sema", "application/vnd.sema\r\n"},
-	{"semd", "application/vnd.semd\r\n"},
-	{"semf", "application/vnd.semf\r\n"},
-	{"ssv", "application/vnd.shade-save-file\r\n"},
-	{"ifm", "application/vnd.shana.informed.formdata\r\n"},
-	{"itp", "application/vnd.shana.informed.formtemplate\r\n"},
-	{"iif", "application/vnd.shana.informed.interchange\r\n"},
-	{"ipk", "application/vnd.shana.informed.package\r\n"},
-	{"shp", "application/vnd.shp\r\n"},
-	{"shx", "application/vnd.shx\r\n"},
-	{"sr", "application/vnd.sigrok.session\r\n"},
-	{"twd", "application/vnd.SimTech-MindMapper\r\n"},
-	{"twds", "application/vnd.SimTech-MindMapper\r\n"},
-	{"mmf", "application/vnd.smaf\r\n"},
-	{"notebook", "application/vnd.smart.notebook\r\n"},
-	{"teacher", "application/vnd.smart.teacher\r\n"},
-	{"ptrom", "application/vnd.snesdev-page-table\r\n"},
-	{"pt", "application/vnd.snesdev-page-table\r\n"},
-	{"fo", "application/vnd.software602.filler.form+xml\r\n"},
-	{"zfo", "application/vnd.software602.filler.form-xml-zip\r\n"},
-	{"sdkm", "application/vnd.solent.sdkm+xml\r\n"},
-	{"sdkd", "application/vnd.solent.sdkm+xml\r\n"},
-	{"dxp", "application/vnd.spotfire.dxp\r\n"},
-	{"sfs", "application/vnd.spotfire.sfs\r\n"},
-	{"sqlite", "application/vnd.sqlite3\r\n"},
-	{"sqlite3", "application/vnd.sqlite3\r\n"},
-	{"smzip", "application/vnd.stepmania.package\r\n"},
-	{"sm", "application/vnd.stepmania.stepchart\r\n"},
-	{"wadl", "application/vnd.sun.wadl+xml\r\n"},
-	{"sus", "application/vnd.sus-calendar\r\n"},
-	{"susp", "application/vnd.sus-calendar\r\n"},
-	{"scl", "application/vnd.sycle+xml\r\n"},
-	{"xsm", "application/vnd.syncml+xml\r\n"},
-	{"bdm", "application/vnd.syncml.dm+wbxml\r\n"},
-	{"xdm", "application/vnd.syncml.dm+xml\r\n"},
-	{"ddf", "application/vnd.syncml.dmddf+xml\r\n"},
-	{"tao", "application/vnd.tao.intent-module-archive\r\n"},
-	{"pcap", "application/vnd.tcpdump.pcap\r\n"},
-	{"cap", "application/vnd.tcpdump.pcap\r\n"},
-	{"dmp", "application/vnd.tcpdump.pcap\r\n"},
-	{"qvd", "application/vnd.theqvd\r\n"},
-	{"ppttc", "application/vnd.think-cell.ppttc+json\r\n"},
-	{"vfr", "application/vnd.tml\r\n"},
-	{"viaframe", "application/vnd.tml\r\n"},
-	{"tmo", "application/vnd.tmobile-livetv\r\n"},
-	{"tpt", "application/vnd.trid.tpt\r\n"},
-	{"mxs", "application/vnd.triscape.mxs\r\n"},
-	{"tra", "application/vnd.trueapp\r\n"},
-	{"ufdl", "application/vnd.ufdl\r\n"},
-	{"ufd", "application/vnd.ufdl\r\n"},
-	{"frm", "application/vnd.ufdl\r\n"},
-	{"utz", "application/vnd.uiq.theme\r\n"},
-	{"umj", "application/vnd.umajin\r\n"},
-	{"unityweb", "application/vnd.unity\r\n"},
-	{"uoml", "application/vnd.uoml+xml\r\n"},
-	{"uo", "application/vnd.uoml+xml\r\n"},
-	{"urim", "application/vnd.uri-map\r\n"},
-	{"urimap", "application/vnd.uri-map\r\n"},
-	{"vmt", "application/vnd.valve.source.material\r\n"},
-	{"vcx", "application/vnd.vcx\r\n"},
-	{"mxi", "application/vnd.vd-study\r\n"},
-	{"study-inter", "application/vnd.vd-study\r\n"},
-	{"model-inter", "application/vnd.vd-study\r\n"},
-	{"vwx", "application/vnd.vectorworks\r\n"},
-	{"istc", "application/vnd.veryant.thin\r\n"},
-	{"isws", "application/vnd.veryant.thin\r\n"},
-	{"VES", "application/vnd.ves.encrypted\r\n"},
-	{"vsc", "application/vnd.vidsoft.vidconference\r\n"},
-	{"vsd", "application/vnd.visio\r\n"},
-	{"vst", "application/vnd.visio\r\n"},
-	{"vsw", "application/vnd.visio\r\n"},
-	{"vss", "application/vnd.visio\r\n"},
-	{"vis", "application/vnd.visionary\r\n"},
-	{"vsf", "application/vnd.vsf\r\n"},
-	{"sic", "application/vnd.wap.sic\r\n"},
-	{"slc", "application/vnd.wap.slc\r\n"},
-	{"wbxml", "application/vnd.wap.wbxml\r\n"},
-	{"wmlc", "application/vnd.wap.wmlc\r\n"},
-	{"wmlsc", "application/vnd.wap.wmlscriptc\r\n"},
-	{"wtb", "application/vnd.webturbo\r\n"},
-	{"p2p", "application/vnd.wfa.p2p\r\n"},
-	{"wsc", "application/vnd.wfa.wsc\r\n"},
-	{"wmc", "application/vnd.wmc\r\n"},
-	{"m", "application/vnd.wolfram.mathematica.package\r\n"},
-	{"nbp", "application/vnd.wolfram.player\r\n"},
-	{"wpd", "application/vnd.wordperfect\r\n"},
-	{"wqd", "application/vnd.wqd\r\n"},
-	{"stf", "application/vnd.wt.stf\r\n"},
-	{"wv", "application/vnd.wv.csp+wbxml\r\n"},
-	{"xar", "application/vnd.xara\r\n"},
-	{"xfdl", "application/vnd.xfdl\r\n"},
-	{"xfd", "application/vnd.xfdl\r\n"},
-	{"cpkg", "application/vnd.xmpie.cpkg\r\n"},
-	{"dpkg", "application/vnd.xmpie.dpkg\r\n"},
-	{"ppkg", "application/vnd.xmpie.ppkg\r\n"},
-	{"xlim", "application/vnd.xmpie.xlim\r\n"},
-	{"hvd", "application/vnd.yamaha.hv-dic\r\n"},
-	{"hvs", "application/vnd.yamaha.hv-script\r\n"},
-	{"hvp", "application/vnd.yamaha.hv-voice\r\n"},
-	{"osf", "application/vnd.yamaha.openscoreformat\r\n"},
-	{"saf", "application/vnd.yamaha.smaf-audio\r\n"},
-	{"spf", "application/vnd.yamaha.smaf-phrase\r\n"},
-	{"yme", "application/vnd.yaoweme\r\n"},
-	{"cmp", "application/vnd.yellowriver-custom-menu\r\n"},
-	{"zir", "application/vnd.zul\r\n"},
-	{"zirz", "application/vnd.zul\r\n"},
-	{"zaz", "application/vnd.zzazz.deck+xml\r\n"},
-	{"vxml", "application/voicexml+xml\r\n"},
-	{"vcj", "application/voucher-cms+json\r\n"},
-	{"wasm", "application/wasm\r\n"},
-	{"wif", "application/watcherinfo+xml\r\n"},
-	{"wgt", "application/widget\r\n"},
-	{"wsdl", "application/wsdl+xml\r\n"},
-	{"wspolicy", "application/wspolicy+xml\r\n"},
-	{"xav", "application/xcap-att+xml\r\n"},
-	{"xca", "application/xcap-caps+xml\r\n"},
-	{"xdf", "application/xcap-diff+xml\r\n"},
-	{"xel", "application/xcap-el+xml\r\n"},
-	{"xer", "application/xcap-error+xml\r\n"},
-	{"xns", "application/xcap-ns+xml\r\n"},
-	{"xhtml", "application/xhtml+xml\r\n"},
-	{"xhtm", "application/xhtml+xml\r\n"},
-	{"xht", "application/xhtml+xml\r\n"},
-	{"xlf", "application/xliff+xml\r\n"},
-	{"dtd", "application/xml-dtd\r\n"},
-	{"xop", "application/xop+xml\r\n"},
-	{"xsl", "application/xslt+xml\r\n"},
-	{"xslt", "application/xslt+xml\r\n"},
-	{"mxml", "application/xv+xml\r\n"},
-	{"xhvml", "application/xv+xml\r\n"},
-	{"xvml", "application/xv+xml\r\n"},
-	{"xvm", "application/xv+xml\r\n"},
-	{"yang", "application/yang\r\n"},
-	{"yin", "application/yin+xml\r\n"},
-	{"zip", "application/zip\r\n"},
-	{"zst", "application/zstd\r\n"},
-	{"726", "audio/32kadpcm\r\n"},
-	{"adts", "audio/aac\r\n"},
-	{"aac", "audio/aac\r\n"},
-	{"ass", "audio/aac\r\n"},
-	{"ac3", "audio/ac3\r\n"},
-	{"amr", "audio/AMR\r\n"},
-	{"awb", "audio/AMR-WB\r\n"},
-	{"acn", "audio/asc\r\n"},
-	{"aal", "audio/ATRAC-ADVANCED-LOSSLESS\r\n"},
-	{"atx", "audio/ATRAC-X\r\n"},
-	{"at3", "audio/ATRAC3\r\n"},
-	{"aa3", "audio/ATRAC3\r\n"},
-	{"omg", "audio/ATRAC3\r\n"},
-	{"au", "audio/basic\r\n"},
-	{"snd", "audio/basic\r\n"},
-	{"dls", "audio/dls\r\n"},
-	{"evc", "audio/EVRC\r\n"},
-	{"evb", "audio/EVRCB\r\n"},
-	{"enw", "audio/EVRCNW\r\n"},
-	{"evw", "audio/EVRCWB\r\n"},
-	{"lbc", "audio/iLBC\r\n"},
-	{"l16", "audio/L16\r\n"},
-	{"mhas", "audio/mhas\r\n"},
-	{"mxmf", "audio/mobile-xmf\r\n"},
-	{"m4a", "audio/mp4\r\n"},
-	{"mp3", "audio/mpeg\r\n"},
-	{"mpga", "audio/mpeg\r\n"},
-	{"mp1", "audio/mpeg\r\n"},
-	{"mp2", "audio/mpeg\r\n"},
-	{"oga", "audio/ogg\r\n"},
-	{"ogg", "audio/ogg\r\n"},
-	{"opus", "audio/ogg\r\n"},
-	{"spx", "audio/ogg\r\n"},
-	{"sid", "audio/prs.sid\r\n"},
-	{"psid", "audio/prs.sid\r\n"},
-	{"qcp", "audio/QCELP\r\n"},
-	{"smv", "audio/SMV\r\n"},
-	{"sofa", "audio/sofa\r\n"},
-	{"loas", "audio/usac\r\n"},
-	{"xhe", "audio/usac\r\n"},
-	{"koz", "audio/vnd.audiokoz\r\n"},
-	{"uva", "audio/vnd.dece.audio\r\n"},
-	{"uvva", "audio/vnd.dece.audio\r\n"},
-	{"eol", "audio/vnd.digital-winds\r\n"},
-	{"mlp", "audio/vnd.dolby.mlp\r\n"},
-	{"dts", "audio/vnd.dts\r\n"},
-	{"dtshd", "audio/vnd.dts.hd\r\n"},
-	{"plj", "audio/vnd.everad.plj\r\n"},
-	{"lvp", "audio/vnd.lucent.voice\r\n"},
-	{"pya", "audio/vnd.ms-playready.media.pya\r\n"},
-	{"vbk", "audio/vnd.nortel.vbk\r\n"},
-	{"ecelp4800", "audio/vnd.nuera.ecelp4800\r\n"},
-	{"ecelp7470", "audio/vnd.nuera.ecelp7470\r\n"},
-	{"ecelp9600", "audio/vnd.nuera.ecelp9600\r\n"},
-	{"multitrack", "audio/vnd.presonus.multitrack\r\n"},
-	{"rip", "audio/vnd.rip\r\n"},
-	{"smp3", "audio/vnd.sealedmedia.softseal.mpeg\r\n"},
-	{"smp", "audio/vnd.sealedmedia.softseal.mpeg\r\n"},
-	{"s1m", "audio/vnd.sealedmedia.softseal.mpeg\r\n"},
-	{"ttc", "font/collection\r\n"},
-	{"otf", "font/otf\r\n"},
-	{"ttf", "font/ttf\r\n"},
-	{"woff", "font/woff\r\n"},
-	{"woff2", "font/woff2\r\n"},
-	{"exr", "image/aces\r\n"},
-	{"avci", "image/avci\r\n"},
-	{"avcs", "image/avcs\r\n"},
-	{"avif", "image/avif\r\n"},
-	{"hif", "image/avif\r\n"},
-	{"bmp", "image/bmp\r\n"},
-	{"dib", "image/bmp\r\n"},
-	{"cgm", "image/cgm\r\n"},
-	{"drle", "image/dicom-rle\r\n"},
-	{"emf", "image/emf\r\n"},
-	{"fits", "image/fits\r\n"},
-	{"fit", "image/fits\r\n"},
-	{"fts", "image/fits\r\n"},
-	{"heic", "image/heic\r\n"},
-	{"heics", "image/heic-sequence\r\n"},
-	{"heif", "image/heif\r\n"},
-	{"heifs", "image/heif-sequence\r\n"},
-	{"hej2", "image/hej2k\r\n"},
-	{"hsj2", "image/hsj2\r\n"},
-	{"gif", "image/gif\r\n"},
-	{"ief", "image/ief\r\n"},
-	{"jls", "image/jls\r\n"},
-	{"jp2", "image/jp2\r\n"},
-	{"jpg2", "image/jp2\r\n"},
-	{"jph", "image/jph\r\n"},
-	{"jhc", "image/jphc\r\n"},
-	{"jpg", "image/jpeg\r\n"},
-	{"jpeg", "image/jpeg\r\n"},
-	{"jpe", "image/jpeg\r\n"},
-	{"jfif", "image/jpeg\r\n"},
-	{"jpm", "image/jpm\r\n"},
-	{"jpgm", "image/jpm\r\n"},
-	{"jpx", "image/jpx\r\n"},
-	{"jpf", "image/jpx\r\n"},
-	{"jxl", "image/jxl\r\n"},
-	{"jxr", "image/jxr\r\n"},
-	{"jxra", "image/jxrA\r\n"},
-	{"jxrs", "image/jxrS\r\n"},
-	{"jxs", "image/jxs\r\n"},
-	{"jxsc", "image/jxsc\r\n"},
-	{"jxsi", "image/jxsi\r\n"},
-	{"jxss", "image/jxss\r\n"},
-	{"ktx", "image/ktx\r\n"},
-	{"ktx2", "image/ktx2\r\n"},
-	{"png", "image/png\r\n"},
-	{"btif", "image/prs.btif\r\n"},
-	{"btf", "image/prs.btif\r\n"},
-	{"pti", "image/prs.pti\r\n"},
-	{"svg", "image/svg+xml\r\n"},
-	{"svgz", "image/svg+xml\r\n"},
-	{"t38", "image/t38\r\n"},
-	{"tiff", "image/tiff\r\n"},
-	{"tif", "image/tiff\r\n"},
-	{"tfx", "image/tiff-fx\r\n"},
-	{"psd", "image/vnd.adobe.photoshop\r\n"},
-	{"azv", "image/vnd.airzip.accelerator.azv\r\n"},
-	{"uvi", "image/vnd.dece.graphic\r\n"},
-	{"uvvi", "image/vnd.dece.graphic\r\n"},
-	{"uvg", "image/vnd.dece.graphic\r\n"},
-	{"uvvg", "image/vnd.dece.graphic\r\n"},
-	{"djvu", "image/vnd.djvu\r\n"},
-	{"djv", "image/vnd.djvu\r\n"},
-	{"dwg", "image/vnd.dwg\r\n"},
-	{"dxf", "image/vnd.dxf\r\n"},
-	{"fbs", "image/vnd.fastbidsheet\r\n"},
-	{"fpx", "image/vnd.fpx\r\n"},
-	{"fst", "image/vnd.fst\r\n"},
-	{"mmr", "image/vnd.fujixerox.edmics-mmr\r\n"},
-	{"rlc", "image/vnd.fujixerox.edmics-rlc\r\n"},
-	{"pgb", "image/vnd.globalgraphics.pgb\r\n"},
-	{"ico", "image/vnd.microsoft.icon\r\n"},
-	{"apng", "image/vnd.mozilla.apng\r\n"},
-	{"mdi", "image/vnd.ms-modi\r\n"},
-	{"b16", "image/vnd.pco.b16\r\n"},
-	{"hdr", "image/vnd.radiance\r\n"},
-	{"rgbe", "image/vnd.radiance\r\n"},
-	{"xyze", "image/vnd.radiance\r\n"},
-	{"spng", "image/vnd.sealed.png\r\n"},
-	{"spn", "image/vnd.sealed.png\r\n"},
-	{"s1n", "image/vnd.sealed.png\r\n"},
-	{"sgif", "image/vnd.sealedmedia.softseal.gif\r\n"},
-	{"sgi", "image/vnd.sealedmedia.softseal.gif\r\n"},
-	{"s1g", "image/vnd.sealedmedia.softseal.gif\r\n"},
-	{"sjpg", "image/vnd.sealedmedia.softseal.jpg\r\n"},
-	{"sjp", "image/vnd.sealedmedia.softseal.jpg\r\n"},
-	{"s1j", "image/vnd.sealedmedia.softseal.jpg\r\n"},
-	{"tap", "image/vnd.tencent.tap\r\n"},
-	{"vtf", "image/vnd.valve.source.texture\r\n"},
-	{"wbmp", "image/vnd.wap.wbmp\r\n"},
-	{"xif", "image/vnd.xiff\r\n"},
-	{"pcx", "image/vnd.zbrush.pcx\r\n"},
-	{"wmf", "image/wmf\r\n"},
-	{"u8msg", "message/global\r\n"},
-	{"u8dsn", "message/global-delivery-status\r\n"},
-	{"u8mdn", "message/global-disposition-notification\r\n"},
-	{"u8hdr", "message/global-headers\r\n"},
-	{"eml", "message/rfc822\r\n"},
-	{"mail", "message/rfc822\r\n"},
-	{"art", "message/rfc822\r\n"},
-	{"glb", "model/gltf-binary\r\n"},
-	{"gltf", "model/gltf+json\r\n"},
-	{"igs", "model/iges\r\n"},
-	{"iges", "model/iges\r\n"},
-	{"msh", "model/mesh\r\n"},
-	{"mesh", "model/mesh\r\n"},
-	{"silo", "model/mesh\r\n"},
-	{"mtl", "model/mtl\r\n"},
-	{"obj", "model/obj\r\n"},
-	{"stl", "model/stl\r\n"},
-	{"dae", "model/vnd.collada+xml\r\n"},
-	{"dwf", "model/vnd.dwf\r\n"},
-	{"gdl", "model/vnd.gdl\r\n"},
-	{"gsm", "model/vnd.gdl\r\n"},
-	{"win", "model/vnd.gdl\r\n"},
-	{"dor", "model/vnd.gdl\r\n"},
-	{"lmp", "model/vnd.gdl\r\n"},
-	{"rsm", "model/vnd.gdl\r\n"},
-	{"msm", "model/vnd.gdl\r\n"},
-	{"ism", "model/vnd.gdl\r\n"},
-	{"gtw", "model/vnd.gtw\r\n"},
-	{"moml", "model/vnd.moml+xml\r\n"},
-	{"mts", "model/vnd.mts\r\n"},
-	{"ogex", "model/vnd.opengex\r\n"},
-	{"x_b", "model/vnd.parasolid.transmit.binary\r\n"},
-	{"xmt_bin", "model/vnd.parasolid.transmit.binary\r\n"},
-	{"x_t", "model/vnd.parasolid.transmit.text\r\n"},
-	{"xmt_txt", "model/vnd.parasolid.transmit.text\r\n"},
-	{"pyo", "model/vnd.pytha.pyox\r\n"},
-	{"pyox", "model/vnd.pytha.pyox\r\n"},
-	{"vds", "model/vnd.sap.vds\r\n"},
-	{"usdz", "model/vnd.usdz+zip\r\n"},
-	{"bsp", "model/vnd.valve.source.compiled-map\r\n"},
-	{"vtu", "model/vnd.vtu\r\n"},
-	{"wrl", "model/vrml\r\n"},
-	{"vrml", "model/vrml\r\n"},
-	{"x3db", "model/x3d+xml\r\n"},
-	{"x3dv", "model/x3d-vrml\r\n"},
-	{"x3dvz", "model/x3d-vrml\r\n"},
-	{"bmed", "multipart/vnd.bint.med-plus\r\n"},
-	{"vpm", "multipart/voice-message\r\n"},
-	{"appcache", "text/cache-manifest\r\n"},
-	{"manifest", "text/cache-manifest\r\n"},
-	{"ics", "text/calendar\r\n"},
-	{"ifb", "text/calendar\r\n"},
-	{"CQL", "text/cql\r\n"},
-	{"css", "text/css\r\n"},
-	{"csv", "text/csv\r\n"},
-	{"csvs", "text/csv-schema\r\n"},
-	{"soa", "text/dns\r\n"},
-	{"zone", "text/dns\r\n"},
-	{"gff3", "text/gff3\r\n"},
-	{"html", "text/html\r\n"},
-	{"htm", "text/html\r\n"},
-	{"cnd", "text/jcr-cnd\r\n"},
-	{"markdown", "text/markdown\r\n"},
-	{"md", "text/markdown\r\n"},
-	{"miz", "text/mizar\r\n"},
-	{"n3", "text/n3\r\n"},
-	{"txt", "text/plain\r\n"},
-	{"asc", "text/plain\r\n"},
-	{"text", "text/plain\r\n"},
-	{"pm", "text/plain\r\n"},
-	{"el", "text/plain\r\n"},
-	{"c", "text/plain\r\n"},
-	{"h", "text/plain\r\n"},
-	{"cc", "text/plain\r\n"},
-	{"hh", "text/plain\r\n"},
-	{"cxx", "text/plain\r\n"},
-	{"hxx", "text/plain\r\n"},
-	{"f90", "text/plain\r\n"},
-	{"conf", "text/plain\r\n"},
-	{"log", "text/plain\r\n"},
-	{"provn", "text/provenance-notation\r\n"},
-	{"rst", "text/prs.fallenstein.rst\r\n"},
-	{"tag", "text/prs.lines.tag\r\n"},
-	{"dsc", "text/prs.lines.tag\r\n"},
-	{"rtx", "text/richtext\r\n"},
-	{"sgml", "text/SGML\r\n"},
-	{"sgm", "text/SGML\r\n"},
-	{"shaclc", "text/shaclc\r\n"},
-	{"shc", "text/shaclc\r\n"},
-	{"spdx", "text/spdx\r\n"},
-	{"tsv", "text/tab-separated-values\r\n"},
-	{"t", "text/troff\r\n"},
-	{"tr", "text/troff\r\n"},
-	{"roff", "text/troff\r\n"},
-	{"ttl", "text/turtle\r\n"},
-	{"uris", "text/uri-list\r\n"},
-	{"uri", "text/uri-list\r\n"},
-	{"vcf", "text/vcard\r\n"},
-	{"vcard", "text/vcard\r\n"},
-	{"a", "text/vnd.a\r\n"},
-	{"abc", "text/vnd.abc\r\n"},
-	{"ascii", "text/vnd.ascii-art\r\n"},
-	{"copyright", "text/vnd.debian.copyright\r\n"},
-	{"dms", "text/vnd.DMClientScript\r\n"},
-	{"sub", "text/vnd.dvb.subtitle\r\n"},
-	{"jtd", "text/vnd.esmertec.theme-descriptor\r\n"},
-	{"flt", "text/vnd.ficlab.flt\r\n"},
-	{"fly", "text/vnd.fly\r\n"},
-	{"flx", "text/vnd.fmi.flexstor\r\n"},
-	{"gv", "text/vnd.graphviz\r\n"},
-	{"dot", "text/vnd.graphviz\r\n"},
-	{"hans", "text/vnd.hans\r\n"},
-	{"hgl", "text/vnd.hgl\r\n"},
-	{"3dml", "text/vnd.in3d.3dml\r\n"},
-	{"3dm", "text/vnd.in3d.3dml\r\n"},
-	{"spot", "text/vnd.in3d.spot\r\n"},
-	{"spo", "text/vnd.in3d.spot\r\n"},
-	{"mpf", "text/vnd.ms-mediapackage\r\n"},
-	{"ccc", "text/vnd.net2phone.commcenter.command\r\n"},
-	{"mc2", "text/vnd.senx.warpscript\r\n"},
-	{"uric", "text/vnd.si.uricatalogue\r\n"},
-	{"jad", "text/vnd.sun.j2me.app-descriptor\r\n"},
-	{"sos", "text/vnd.sosi\r\n"},
-	{"ts", "text/vnd.trolltech.linguist\r\n"},
-	{"si", "text/vnd.wap.si\r\n"},
-	{"sl", "text/vnd.wap.sl\r\n"},
-	{"wml", "text/vnd.wap.wml\r\n"},
-	{"wmls", "text/vnd.wap.wmlscript\r\n"},
-	{"vtt", "text/vtt\r\n"},
-	{"xml", "text/xml\r\n"},
-	{"xsd", "text/xml\r\n"},
-	{"rng", "text/xml\r\n"},
-	{"ent", "text/xml-external-parsed-entity\r\n"},
-	{"3gp", "video/3gpp\r\n"},
-	{"3gpp", "video/3gpp\r\n"},
-	{"3g2", "video/3gpp2\r\n"},
-	{"3gpp2", "video/3gpp2\r\n"},
-	{"m4s", "video/iso.segment\r\n"},
-	{"mj2", "video/mj2\r\n"},
-	{"mjp2", "video/mj2\r\n"},
-	{"mp4", "video/mp4\r\n"},
-	{"mpg4", "video/mp4\r\n"},
-	{"m4v", "video/mp4\r\n"},
-	{"mpeg", "video/mpeg\r\n"},
-	{"mpg", "video/mpeg\r\n"},
-	{"mpe", "video/mpeg\r\n"},
-	{"m1v", "video/mpeg\r\n"},
-	{"m2v", "video/mpeg\r\n"},
-	{"ogv", "video/ogg\r\n"},
-	{"mov", "video/quicktime\r\n"},
-	{"qt", "video/quicktime\r\n"},
-	{"uvh", "video/vnd.dece.hd\r\n"},
-	{"uvvh", "video/vnd.dece.hd\r\n"},
-	{"uvm", "video/vnd.dece.mobile\r\n"},
-	{"uvvm", "video/vnd.dece.mobile\r\n"},
-	{"uvu", "video/vnd.dece.mp4\r\n"},
-	{"uvvu", "video/vnd.dece.mp4\r\n"},
-	{"uvp", "video/vnd.dece.pd\r\n"},
-	{"uvvp", "video/vnd.dece.pd\r\n"},
-	{"uvs", "video/vnd.dece.sd\r\n"},
-	{"uvvs", "video/vnd.dece.sd\r\n"},
-	{"uvv", "video/vnd.dece.video\r\n"},
-	{"uvvv", "video/vnd.dece.video\r\n"},
-	{"dvb", "video/vnd.dvb.file\r\n"},
-	{"fvt", "video/vnd.fvt\r\n"},
-	{"mxu", "video/vnd.mpegurl\r\n"},
-	{"m4u", "video/vnd.mpegurl\r\n"},
-	{"pyv", "video/vnd.ms-playready.media.pyv\r\n"},
-	{"nim", "video/vnd.nokia.interleaved-multimedia\r\n"},
-	{"bik", "video/vnd.radgamettools.bink\r\n"},
-	{"bk2", "video/vnd.radgamettools.bink\r\n"},
-	{"smk", "video/vnd.radgamettools.smacker\r\n"},
-	{"smpg", "video/vnd.sealed.mpeg1\r\n"},
-	{"s11", "video/vnd.sealed.mpeg1\r\n"},
-	{"s14", "video/vnd.sealed.mpeg4\r\n"},
-	{"sswf", "video/vnd.sealed.swf\r\n"},
-	{"ssw", "video/vnd.sealed.swf\r\n"},
-	{"smov", "video/vnd.sealedmedia.softseal.mov\r\n"},
-	{"smo", "video/vnd.sealedmedia.softseal.mov\r\n"},
-	{"s1q", "video/vnd.sealedmedia.softseal.mov\r\n"},
-	{"yt", "video/vnd.youtube.yt\r\n"},
-	{"viv", "video/vnd.vivo\r\n"},
-	{"cpt", "application/mac-compactpro\r\n"},
-	{"metalink", "application/metalink+xml\r\n"},
-	{"owx", "application/owl+xml\r\n"},
-	{"rss", "application/rss+xml\r\n"},
-	{"apk", "application/vnd.android.package-archive\r\n"},
-	{"dd", "application/vnd.oma.dd+xml\r\n"},
-	{"dcf", "application/vnd.oma.drm.content\r\n"},
-	{"o4a", "application/vnd.oma.drm.dcf\r\n"},
-	{"o4v", "application/vnd.oma.drm.dcf\r\n"},
-	{"dm", "application/vnd.oma.drm.message\r\n"},
-	{"drc", "application/vnd.oma.drm.rights+wbxml\r\n"},
-	{"dr", "application/vnd.oma.drm.rights+xml\r\n"},
-	{"sxc", "application/vnd.sun.xml.calc\r\n"},
-	{"stc", "application/vnd.sun.xml.calc.template\r\n"},
-	{"sxd", "application/vnd.sun.xml.draw\r\n"},
-	{"std", "application/vnd.sun.xml.draw.template\r\n"},
-	{"sxi", "application/vnd.sun.xml.impress\r\n"},
-	{"sti", "application/vnd.sun.xml.impress.template\r\n"},
-	{"sxm", "application/vnd.sun.xml.math\r\n"},
-	{"sxw", "application/vnd.sun.xml.writer\r\n"},
-	{"sxg", "application/vnd.sun.xml.writer.global\r\n"},
-	{"stw", "application/vnd.sun.xml.writer.template\r\n"},
-	{"sis", "application/vnd.symbian.install\r\n"},
-	{"mms", "application/vnd.wap.mms-message\r\n"},
-	{"anx", "application/x-annodex\r\n"},
-	{"bcpio", "application/x-bcpio\r\n"},
-	{"torrent", "application/x-bittorrent\r\n"},
-	{"bz2", "application/x-bzip2\r\n"},
-	{"vcd", "application/x-cdlink\r\n"},
-	{"crx", "application/x-chrome-extension\r\n"},
-	{"cpio", "application/x-cpio\r\n"},
-	{"csh", "application/x-csh\r\n"},
-	{"dcr", "application/x-director\r\n"},
-	{"dir", "application/x-director\r\n"},
-	{"dxr", "application/x-director\r\n"},
-	{"dvi", "application/x-dvi\r\n"},
-	{"spl", "application/x-futuresplash\r\n"},
-	{"gtar", "application/x-gtar\r\n"},
-	{"hdf", "application/x-hdf\r\n"},
-	{"jar", "application/x-java-archive\r\n"},
-	{"jnlp", "application/x-java-jnlp-file\r\n"},
-	{"pack", "application/x-java-pack200\r\n"},
-	{"kil", "application/x-killustrator\r\n"},
-	{"latex", "application/x-latex\r\n"},
-	{"nc", "application/x-netcdf\r\n"},
-	{"cdf", "application/x-netcdf\r\n"},
-	{"pl", "application/x-perl\r\n"},
-	{"rpm", "application/x-rpm\r\n"},
-	{"sh", "application/x-sh\r\n"},
-	{"shar", "application/x-shar\r\n"},
-	{"sit", "application/x-stuffit\r\n"},
-	{"sv4cpio", "application/x-sv4cpio\r\n"},
-	{"sv4crc", "application/x-sv4crc\r\n"},
-	{"tar", "application/x-tar\r\n"},
-	{"tcl", "application/x-tcl\r\n"},
-	{"tex", "application/x-tex\r\n"},
-	{"texinfo", "application/x-texinfo\r\n"},
-	{"texi", "application/x-texinfo\r\n"},
-	{"man", "application/x-troff-man\r\n"},
-	{"1", "application/x-troff-man\r\n"},
-	{"2", "application/x-troff-man\r\n"},
-	{"3", "application/x-troff-man\r\n"},
-	{"4", "application/x-troff-man\r\n"},
-	{"5", "application/x-troff-man\r\n"},
-	{"6", "application/x-troff-man\r\n"},
-	{"7", "application/x-troff-man\r\n"},
-	{"8", "application/x-troff-man\r\n"},
-	{"me", "application/x-troff-me\r\n"},
-	{"ms", "application/x-troff-ms\r\n"},
-	{"ustar", "application/x-ustar\r\n"},
-	{"src", "application/x-wais-source\r\n"},
-	{"xpi", "application/x-xpinstall\r\n"},
-	{"xspf", "application/x-xspf+xml\r\n"},
-	{"xz", "application/x-xz\r\n"},
-	{"mid", "audio/midi\r\n"},
-	{"midi", "audio/midi\r\n"},
-	{"kar", "audio/midi\r\n"},
-	{"aif", "audio/x-aiff\r\n"},
-	{"aiff", "audio/x-aiff\r\n"},
-	{"aifc", "audio/x-aiff\r\n"},
-	{"axa", "audio/x-annodex\r\n"},
-	{"flac", "audio/x-flac\r\n"},
-	{"mka", "audio/x-matroska\r\n"},
-	{"mod", "audio/x-mod\r\n"},
-	{"ult", "audio/x-mod\r\n"},
-	{"uni", "audio/x-mod\r\n"},
-	{"m15", "audio/x-mod\r\n"},
-	{"mtm", "audio/x-mod\r\n"},
-	{"669", "audio/x-mod\r\n"},
-	{"med", "audio/x-mod\r\n"},
-	{"m3u", "audio/x-mpegurl\r\n"},
-	{"wax", "audio/x-ms-wax\r\n"},
-	{"wma", "audio/x-ms-wma\r\n"},
-	{"ram", "audio/x-pn-realaudio\r\n"},
-	{"rm", "audio/x-pn-realaudio\r\n"},
-	{"ra", "audio/x-realaudio\r\n"},
-	{"s3m", "audio/x-s3m\r\n"},
-	{"stm", "audio/x-stm\r\n"},
-	{"wav", "audio/x-wav\r\n"},
-	{"xyz", "chemical/x-xyz\r\n"},
-	{"webp", "image/webp\r\n"},
-	{"ras", "image/x-cmu-raster\r\n"},
-	{"pnm", "image/x-portable-anymap\r\n"},
-	{"pbm", "image/x-portable-bitmap\r\n"},
-	{"pgm", "image/x-portable-graymap\r\n"},
-	{"ppm", "image/x-portable-pixmap\r\n"},
-	{"rgb", "image/x-rgb\r\n"},
-	{"tga", "image/x-targa\r\n"},
-	{"xbm", "image/x-xbitmap\r\n"},
-	{"xpm", "image/x-xpixmap\r\n"},
-	{"xwd", "image/x-xwindowdump\r\n"},
-	{"sandboxed", "text/html-sandboxed\r\n"},
-	{"pod", "text/x-pod\r\n"},
-	{"etx", "text/x-setext\r\n"},
-	{"webm", "video/webm\r\n"},
-	{"axv", "video/x-annodex\r\n"},
-	{"flv", "video/x-flv\r\n"},
-	{"fxm", "video/x-javafx\r\n"},
-	{"mkv", "video/x-matroska\r\n"},
-	{"mk3d", "video/x-matroska-3d\r\n"},
-	{"asx", "video/x-ms-asf\r\n"},
-	{"wm", "video/x-ms-wm\r\n"},
-	{"wmv", "video/x-ms-wmv\r\n"},
-	{"wmx", "video/x-ms-wmx\r\n"},
-	{"wvx", "video/x-ms-wvx\r\n"},
-	{"avi", "video/x-msvideo\r\n"},
-	{"movie", "video/x-sgi-movie\r\n"},
-	{"ice", "x-conference/x-cooltalk\r\n"},
-	{"sisx", "x-epoc/x-sisx-app\r\n"},
+static MimeType const mimeTypes[MIME_SLOT_COUNT] = {
+	{"s3m", "Content-Type: audio/x-s3m\r\n", 3, 27},
+	{"request", "Content-Type: application/vnd.nervana\r\n", 7, 39},
+	{"tif", "Content-Type: image/tiff\r\n", 3, 26},
+	{"mpy", "Content-Type: application/vnd.ibm.MiniPay\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"senml", "Content-Type: application/senml+json\r\n", 5, 38},
+	{"", "", 0, 0},
+	{"ttf", "Content-Type: font/ttf\r\n", 3, 24},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"icm", "Content-Type: application/vnd.iccprofile\r\n", 3, 42},
+	{"jhc", "Content-Type: image/jphc\r\n", 3, 26},
+	{"dsc", "Content-Type: text/prs.lines.tag\r\n", 3, 34},
+	{"ims", "Content-Type: application/vnd.ms-ims\r\n", 3, 38},
+	{"cst", "Content-Type: application/vnd.commonspace\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"slc", "Content-Type: application/vnd.wap.slc\r\n", 3, 39},
+	{"csp", "Content-Type: application/vnd.commonspace\r\n", 3, 43},
+	{"st", "Content-Type: application/vnd.sailingtracker.track\r\n", 2, 52},
+	{"mcd", "Content-Type: application/vnd.mcd\r\n", 3, 35},
+	{"xmls", "Content-Type: application/dskpp+xml\r\n", 4, 37},
+	{"hal", "Content-Type: application/vnd.hal+xml\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"fcs", "Content-Type: application/vnd.isac.fcs\r\n", 3, 40},
+	{"stl", "Content-Type: model/stl\r\n", 3, 25},
+	{"rnd", "Content-Type: application/prs.nprend\r\n", 3, 38},
+	{"see", "Content-Type: application/vnd.seemail\r\n", 3, 39},
+	{"chrt", "Content-Type: application/vnd.kde.kchart\r\n", 4, 42},
+	{"dms", "Content-Type: text/vnd.DMClientScript\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"irm", "Content-Type: application/vnd.ibm.rights-management\r\n", 3, 53},
+	{"avif", "Content-Type: image/avif\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"sml", "Content-Type: application/smil+xml\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"wmlsc", "Content-Type: application/vnd.wap.wmlscriptc\r\n", 5, 46},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"lostxml", "Content-Type: application/lost+xml\r\n", 7, 36},
+	{"xfd", "Content-Type: application/vnd.xfdl\r\n", 3, 36},
+	{"pki", "Content-Type: application/pkixcmp\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"s1e", "Content-Type: application/vnd.sealed.xls\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"wav", "Content-Type: audio/x-wav\r\n", 3, 27},
+	{"tsd", "Content-Type: application/timestamped-data\r\n", 3, 44},
+	{"nc", "Content-Type: application/x-netcdf\r\n", 2, 36},
+	{"xlsm", "Content-Type: application/vnd.ms-excel.sheet.macroEnabled.12\r\n", 4, 62},
+	{"xdf", "Content-Type: application/xcap-diff+xml\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"abc", "Content-Type: text/vnd.abc\r\n", 3, 28},
+	{"", "", 0, 0},
+	{"msl", "Content-Type: application/vnd.Mobius.MSL\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ink", "Content-Type: application/inkml+xml\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"hxx", "Content-Type: text/plain\r\n", 3, 26},
+	{"ssw", "Content-Type: video/vnd.sealed.swf\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"slt", "Content-Type: application/vnd.epson.salt\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"vcj", "Content-Type: application/voucher-cms+json\r\n", 3, 44},
+	{"odi", "Content-Type: application/vnd.oasis.opendocument.image\r\n", 3, 56},
+	{"x3d", "Content-Type: application/vnd.hzn-3d-crossword\r\n", 3, 48},
+	{"", "", 0, 0},
+	{"mft", "Content-Type: application/rpki-manifest\r\n", 3, 41},
+	{"fbs", "Content-Type: image/vnd.fastbidsheet\r\n", 3, 38},
+	{"wmf", "Content-Type: image/wmf\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"kcm", "Content-Type: application/vnd.nervana\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"gtw", "Content-Type: model/vnd.gtw\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"x_t", "Content-Type: model/vnd.parasolid.transmit.text\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"cap", "Content-Type: application/vnd.tcpdump.pcap\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"saf", "Content-Type: application/vnd.yamaha.smaf-audio\r\n", 3, 49},
+	{"hvp", "Content-Type: application/vnd.yamaha.hv-voice\r\n", 3, 47},
+	{"keynote", "Content-Type: application/vnd.apple.keynote\r\n", 7, 45},
+	{"", "", 0, 0},
+	{"ipk", "Content-Type: application/vnd.shana.informed.package\r\n", 3, 54},
+	{"xpx", "Content-Type: application/vnd.intercon.formnet\r\n", 3, 48},
+	{"ssf", "Content-Type: application/vnd.epson.ssf\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"uvvd", "Content-Type: application/vnd.dece.data\r\n", 4, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"scim", "Content-Type: application/scim+json\r\n", 4, 37},
+	{"xpm", "Content-Type: image/x-xpixmap\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"efi", "Content-Type: application/efi\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"azv", "Content-Type: image/vnd.airzip.accelerator.azv\r\n", 3, 48},
+	{"ico", "Content-Type: image/vnd.microsoft.icon\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"sxw", "Content-Type: application/vnd.sun.xml.writer\r\n", 3, 46},
+	{"sem", "Content-Type: application/vnd.sealed.eml\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"jxsc", "Content-Type: image/jxsc\r\n", 4, 26},
+	{"mpc", "Content-Type: application/vnd.mophun.certificate\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"cdmic", "Content-Type: application/cdmi-container\r\n", 5, 42},
+	{"", "", 0, 0},
+	{"seml", "Content-Type: application/vnd.sealed.eml\r\n", 4, 42},
+	{"s1q", "Content-Type: video/vnd.sealedmedia.softseal.mov\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"l16", "Content-Type: audio/L16\r\n", 3, 25},
+	{"jsonld", "Content-Type: application/ld+json\r\n", 6, 35},
+	{"3gp", "Content-Type: video/3gpp\r\n", 3, 26},
+	{"cw", "Content-Type: application/prs.cww\r\n", 2, 35},
+	{"pgm", "Content-Type: image/x-portable-graymap\r\n", 3, 40},
+	{"ifm", "Content-Type: application/vnd.shana.informed.formdata\r\n", 3, 55},
+	{"xlam", "Content-Type: application/vnd.ms-excel.addin.macroEnabled.12\r\n", 4, 62},
+	{"cdfx", "Content-Type: application/CDFX+XML\r\n", 4, 36},
+	{"ktx2", "Content-Type: image/ktx2\r\n", 4, 26},
+	{"s1a", "Content-Type: application/vnd.sealedmedia.softseal.pdf\r\n", 3, 56},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"opf", "Content-Type: application/oebps-package+xml\r\n", 3, 45},
+	{"skd", "Content-Type: application/vnd.koan\r\n", 3, 36},
+	{"cii", "Content-Type: application/vnd.anser-web-certificate-issue-initiation\r\n", 3, 70},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ndl", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"3gpp2", "Content-Type: video/3gpp2\r\n", 5, 27},
+	{"", "", 0, 0},
+	{"aifc", "Content-Type: audio/x-aiff\r\n", 4, 28},
+	{"", "", 0, 0},
+	{"ez3", "Content-Type: application/vnd.ezpix-package\r\n", 3, 45},
+	{"vcg", "Content-Type: application/vnd.groove-vcard\r\n", 3, 44},
+	{"xns", "Content-Type: application/xcap-ns+xml\r\n", 3, 39},
+	{"cmp", "Content-Type: application/vnd.yellowriver-custom-menu\r\n", 3, 55},
+	{"", "", 0, 0},
+	{"bmed", "Content-Type: multipart/vnd.bint.med-plus\r\n", 4, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sensml", "Content-Type: application/sensml+json\r\n", 6, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"esa", "Content-Type: application/vnd.osgi.subsystem\r\n", 3, 46},
+	{"oth", "Content-Type: application/vnd.oasis.opendocument.text-web\r\n", 3, 59},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ic6", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"hej2", "Content-Type: image/hej2k\r\n", 4, 27},
+	{"imi", "Content-Type: application/vnd.imagemeter.image+zip\r\n", 3, 52},
+	{"odf", "Content-Type: application/vnd.oasis.opendocument.formula\r\n", 3, 58},
+	{"fxp", "Content-Type: application/vnd.adobe.fxp\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"wqd", "Content-Type: application/vnd.wqd\r\n", 3, 35},
+	{"sql", "Content-Type: application/sql\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"yt", "Content-Type: video/vnd.youtube.yt\r\n", 2, 36},
+	{"", "", 0, 0},
+	{"smil", "Content-Type: application/smil+xml\r\n", 4, 36},
+	{"jls", "Content-Type: image/jls\r\n", 3, 25},
+	{"cbor", "Content-Type: application/cbor\r\n", 4, 32},
+	{"stif", "Content-Type: application/vnd.sealed.tiff\r\n", 4, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"igm", "Content-Type: application/vnd.insors.igm\r\n", 3, 42},
+	{"auc", "Content-Type: application/tamp-apex-update-confirm\r\n", 3, 52},
+	{"pgb", "Content-Type: image/vnd.globalgraphics.pgb\r\n", 3, 44},
+	{"mml", "Content-Type: application/mathml+xml\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"uis", "Content-Type: application/urc-uisocketdesc+xml\r\n", 3, 48},
+	{"hpub", "Content-Type: application/prs.hpub+zip\r\n", 4, 40},
+	{"", "", 0, 0},
+	{"thmx", "Content-Type: application/vnd.ms-officetheme\r\n", 4, 46},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mqy", "Content-Type: application/vnd.Mobius.MQY\r\n", 3, 42},
+	{"jpm", "Content-Type: image/jpm\r\n", 3, 25},
+	{"tcu", "Content-Type: application/tamp-community-update\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mxs", "Content-Type: application/vnd.triscape.mxs\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"std", "Content-Type: application/vnd.sun.xml.draw.template\r\n", 3, 53},
+	{"lbe", "Content-Type: application/vnd.llamagraphics.life-balance.exchange+xml\r\n", 3, 71},
+	{"", "", 0, 0},
+	{"dii", "Content-Type: application/DII\r\n", 3, 31},
+	{"pt", "Content-Type: application/vnd.snesdev-page-table\r\n", 2, 50},
+	{"xmt_txt", "Content-Type: model/vnd.parasolid.transmit.text\r\n", 7, 49},
+	{"grv", "Content-Type: application/vnd.groove-injector\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"kfo", "Content-Type: application/vnd.kde.kformula\r\n", 3, 44},
+	{"quiz", "Content-Type: application/vnd.quobject-quoxdocument\r\n", 4, 53},
+	{"", "", 0, 0},
+	{"atomsvc", "Content-Type: application/atomsvc+xml\r\n", 7, 39},
+	{"pages", "Content-Type: application/vnd.apple.pages\r\n", 5, 43},
+	{"html", "Content-Type: text/html\r\n", 4, 25},
+	{"dwf", "Content-Type: model/vnd.dwf\r\n", 3, 29},
+	{"tat", "Content-Type: application/vnd.onepagertat\r\n", 3, 43},
+	{"lbc", "Content-Type: audio/iLBC\r\n", 3, 26},
+	{"m3u", "Content-Type: audio/x-mpegurl\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"g3", "Content-Type: application/vnd.geocube+xml\r\n", 2, 43},
+	{"mp1", "Content-Type: audio/mpeg\r\n", 3, 26},
+	{"ppd", "Content-Type: application/vnd.cups-ppd\r\n", 3, 40},
+	{"xfdl", "Content-Type: application/vnd.xfdl\r\n", 4, 36},
+	{"m3u8", "Content-Type: application/vnd.apple.mpegurl\r\n", 4, 45},
+	{"xodt", "Content-Type: application/vnd.collabio.xodocuments.document\r\n", 4, 61},
+	{"ttl", "Content-Type: text/turtle\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"quox", "Content-Type: application/vnd.quobject-quoxdocument\r\n", 4, 53},
+	{"axa", "Content-Type: audio/x-annodex\r\n", 3, 31},
+	{"vcd", "Content-Type: application/x-cdlink\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"ifb", "Content-Type: text/calendar\r\n", 3, 29},
+	{"sfd-hdstx", "Content-Type: application/vnd.hydrostatix.sof-data\r\n", 9, 52},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"dtshd", "Content-Type: audio/vnd.dts.hd\r\n", 5, 32},
+	{"flb", "Content-Type: application/vnd.ficlab.flb+zip\r\n", 3, 46},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"crx", "Content-Type: application/x-chrome-extension\r\n", 3, 46},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ic1", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"4", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"", "", 0, 0},
+	{"sh", "Content-Type: application/x-sh\r\n", 2, 32},
+	{"", "", 0, 0},
+	{"txd", "Content-Type: application/vnd.genomatix.tuxedo\r\n", 3, 48},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"bsp", "Content-Type: model/vnd.valve.source.compiled-map\r\n", 3, 51},
+	{"", "", 0, 0},
+	{"uvvv", "Content-Type: video/vnd.dece.video\r\n", 4, 36},
+	{"mpg", "Content-Type: video/mpeg\r\n", 3, 26},
+	{"ghf", "Content-Type: application/vnd.groove-help\r\n", 3, 43},
+	{"gltf", "Content-Type: model/gltf+json\r\n", 4, 31},
+	{"gxt", "Content-Type: application/vnd.geonext\r\n", 3, 39},
+	{"igs", "Content-Type: model/iges\r\n", 3, 26},
+	{"ez2", "Content-Type: application/vnd.ezpix-album\r\n", 3, 43},
+	{"sub", "Content-Type: text/vnd.dvb.subtitle\r\n", 3, 37},
+	{"study-inter", "Content-Type: application/vnd.vd-study\r\n", 11, 40},
+	{"ns4", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"uni", "Content-Type: audio/x-mod\r\n", 3, 27},
+	{"cgm", "Content-Type: image/cgm\r\n", 3, 25},
+	{"rusd", "Content-Type: application/route-usd+xml\r\n", 4, 41},
+	{"vtu", "Content-Type: model/vnd.vtu\r\n", 3, 29},
+	{"m4u", "Content-Type: video/vnd.mpegurl\r\n", 3, 33},
+	{"s1j", "Content-Type: image/vnd.sealedmedia.softseal.jpg\r\n", 3, 50},
+	{"med", "Content-Type: audio/x-mod\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"sar", "Content-Type: application/vnd.sar\r\n", 3, 35},
+	{"moml", "Content-Type: model/vnd.moml+xml\r\n", 4, 34},
+	{"qvd", "Content-Type: application/vnd.theqvd\r\n", 3, 38},
+	{"tar", "Content-Type: application/x-tar\r\n", 3, 33},
+	{"rms", "Content-Type: application/vnd.jcp.javame.midlet-rms\r\n", 3, 53},
+	{"hgl", "Content-Type: text/vnd.hgl\r\n", 3, 28},
+	{"imscc", "Content-Type: application/vnd.ims.imsccv1p1\r\n", 5, 45},
+	{"deb", "Content-Type: application/vnd.debian.binary-package\r\n", 3, 53},
+	{"dxp", "Content-Type: application/vnd.spotfire.dxp\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"imgcal", "Content-Type: application/vnd.3lightssoftware.imagescal\r\n", 6, 57},
+	{"", "", 0, 0},
+	{"sl", "Content-Type: text/vnd.wap.sl\r\n", 2, 31},
+	{"held", "Content-Type: application/atsc-held+xml\r\n", 4, 41},
+	{"vcard", "Content-Type: text/vcard\r\n", 5, 26},
+	{"sv4crc", "Content-Type: application/x-sv4crc\r\n", 6, 36},
+	{"qca", "Content-Type: application/vnd.ericsson.quickcall\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"twds", "Content-Type: application/vnd.SimTech-MindMapper\r\n", 4, 50},
+	{"shp", "Content-Type: application/vnd.shp\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"potm", "Content-Type: application/vnd.ms-powerpoint.template.macroEnabled.12\r\n", 4, 70},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ppttc", "Content-Type: application/vnd.think-cell.ppttc+json\r\n", 5, 53},
+	{"jpx", "Content-Type: image/jpx\r\n", 3, 25},
+	{"odp", "Content-Type: application/vnd.oasis.opendocument.presentation\r\n", 3, 63},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ccmp", "Content-Type: application/ccmp+xml\r\n", 4, 36},
+	{"ppsx", "Content-Type: application/vnd.openxmlformats-officedocument.presentationml.slideshow\r\n", 4, 86},
+	{"mus", "Content-Type: application/vnd.musician\r\n", 3, 40},
+	{"msa", "Content-Type: application/vnd.msa-disk-image\r\n", 3, 46},
+	{"", "", 0, 0},
+	{"mp2", "Content-Type: audio/mpeg\r\n", 3, 26},
+	{"csl", "Content-Type: application/vnd.citationstyles.style+xml\r\n", 3, 56},
+	{"fit", "Content-Type: image/fits\r\n", 3, 26},
+	{"pil", "Content-Type: application/vnd.piaccess.application-licence\r\n", 3, 60},
+	{"", "", 0, 0},
+	{"xodp", "Content-Type: application/vnd.collabio.xodocuments.presentation\r\n", 4, 65},
+	{"", "", 0, 0},
+	{"rsat", "Content-Type: application/atsc-rsat+xml\r\n", 4, 41},
+	{"si", "Content-Type: text/vnd.wap.si\r\n", 2, 31},
+	{"s1h", "Content-Type: application/vnd.sealedmedia.softseal.html\r\n", 3, 57},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"svc", "Content-Type: application/vnd.dvb.service\r\n", 3, 43},
+	{"plj", "Content-Type: audio/vnd.everad.plj\r\n", 3, 36},
+	{"fo", "Content-Type: application/vnd.software602.filler.form+xml\r\n", 2, 59},
+	{"uvt", "Content-Type: application/vnd.dece.ttml+xml\r\n", 3, 45},
+	{"c9r", "Content-Type: application/vnd.cryptomator.encrypted\r\n", 3, 53},
+	{"xz", "Content-Type: application/x-xz\r\n", 2, 32},
+	{"", "", 0, 0},
+	{"x3dvz", "Content-Type: model/x3d-vrml\r\n", 5, 30},
+	{"", "", 0, 0},
+	{"sqlite", "Content-Type: application/vnd.sqlite3\r\n", 6, 39},
+	{"m15", "Content-Type: audio/x-mod\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"xhvml", "Content-Type: application/xv+xml\r\n", 5, 34},
+	{"sjp", "Content-Type: image/vnd.sealedmedia.softseal.jpg\r\n", 3, 50},
+	{"nitf", "Content-Type: application/vnd.nitf\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"mtl", "Content-Type: model/mtl\r\n", 3, 25},
+	{"h5", "Content-Type: application/mipc\r\n", 2, 32},
+	{"susp", "Content-Type: application/vnd.sus-calendar\r\n", 4, 44},
+	{"", "", 0, 0},
+	{"tnf", "Content-Type: application/vnd.ms-tnef\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"plb", "Content-Type: application/vnd.3gpp.pic-bw-large\r\n", 3, 49},
+	{"clkp", "Content-Type: application/vnd.crick.clicker.palette\r\n", 4, 53},
+	{"kar", "Content-Type: audio/midi\r\n", 3, 26},
+	{"ep", "Content-Type: application/vnd.bluetooth.ep.oob\r\n", 2, 48},
+	{"xlc", "Content-Type: application/vnd.ms-excel\r\n", 3, 40},
+	{"sus", "Content-Type: application/vnd.sus-calendar\r\n", 3, 44},
+	{"sm", "Content-Type: application/vnd.stepmania.stepchart\r\n", 2, 51},
+	{"", "", 0, 0},
+	{"iota", "Content-Type: application/vnd.astraea-software.iota\r\n", 4, 53},
+	{"csrattrs", "Content-Type: application/csrattrs\r\n", 8, 36},
+	{"xct", "Content-Type: application/vnd.fujixerox.docuworks.container\r\n", 3, 61},
+	{"qxd", "Content-Type: application/vnd.Quark.QuarkXPress\r\n", 3, 49},
+	{"vrml", "Content-Type: model/vrml\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sandboxed", "Content-Type: text/html-sandboxed\r\n", 9, 35},
+	{"tatx", "Content-Type: application/vnd.onepagertatx\r\n", 4, 44},
+	{"mts", "Content-Type: model/vnd.mts\r\n", 3, 29},
+	{"cla", "Content-Type: application/vnd.claymore\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"htm", "Content-Type: text/html\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mag", "Content-Type: application/vnd.ecowin.chart\r\n", 3, 44},
+	{"ota", "Content-Type: application/vnd.android.ota\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"hdt", "Content-Type: application/vnd.hdt\r\n", 3, 35},
+	{"iso", "Content-Type: application/octet-stream\r\n", 3, 40},
+	{"flac", "Content-Type: audio/x-flac\r\n", 4, 28},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"xbm", "Content-Type: image/x-xbitmap\r\n", 3, 31},
+	{"uvz", "Content-Type: application/vnd.dece.zip\r\n", 3, 40},
+	{"oas", "Content-Type: application/vnd.fujitsu.oasys\r\n", 3, 45},
+	{"js", "Content-Type: application/javascript\r\n", 2, 38},
+	{"isws", "Content-Type: application/vnd.veryant.thin\r\n", 4, 44},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ez", "Content-Type: application/andrew-inset\r\n", 2, 40},
+	{"", "", 0, 0},
+	{"wadl", "Content-Type: application/vnd.sun.wadl+xml\r\n", 4, 44},
+	{"pcap", "Content-Type: application/vnd.tcpdump.pcap\r\n", 4, 44},
+	{"", "", 0, 0},
+	{"sac", "Content-Type: application/tamp-sequence-adjust-confirm\r\n", 3, 56},
+	{"nsh", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"ascii", "Content-Type: text/vnd.ascii-art\r\n", 5, 34},
+	{"c4f", "Content-Type: application/vnd.clonk.c4group\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mid", "Content-Type: audio/midi\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mxmf", "Content-Type: audio/mobile-xmf\r\n", 4, 32},
+	{"its", "Content-Type: application/its+xml\r\n", 3, 35},
+	{"usdz", "Content-Type: model/vnd.usdz+zip\r\n", 4, 34},
+	{"smht", "Content-Type: application/vnd.sealed.mht\r\n", 4, 42},
+	{"dp", "Content-Type: application/vnd.osgi.dp\r\n", 2, 39},
+	{"pcx", "Content-Type: image/vnd.zbrush.pcx\r\n", 3, 36},
+	{"tam", "Content-Type: application/vnd.onepager\r\n", 3, 40},
+	{"xps", "Content-Type: application/vnd.ms-xpsdocument\r\n", 3, 46},
+	{"mrc", "Content-Type: application/marc\r\n", 3, 32},
+	{"wk3", "Content-Type: application/vnd.lotus-1-2-3\r\n", 3, 43},
+	{"xpw", "Content-Type: application/vnd.intercon.formnet\r\n", 3, 48},
+	{"123", "Content-Type: application/vnd.lotus-1-2-3\r\n", 3, 43},
+	{"shf", "Content-Type: application/shf+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"sig", "Content-Type: application/pgp-signature\r\n", 3, 41},
+	{"smc", "Content-Type: application/vnd.nintendo.snes.rom\r\n", 3, 49},
+	{"dxf", "Content-Type: image/vnd.dxf\r\n", 3, 29},
+	{"vxml", "Content-Type: application/voicexml+xml\r\n", 4, 40},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"flt", "Content-Type: text/vnd.ficlab.flt\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"smi", "Content-Type: application/smil+xml\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"p8e", "Content-Type: application/pkcs8-encrypted\r\n", 3, 43},
+	{"dir", "Content-Type: application/x-director\r\n", 3, 38},
+	{"es", "Content-Type: application/ecmascript\r\n", 2, 38},
+	{"cdkey", "Content-Type: application/vnd.mediastation.cdkey\r\n", 5, 50},
+	{"smk", "Content-Type: video/vnd.radgamettools.smacker\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"669", "Content-Type: audio/x-mod\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mets", "Content-Type: application/mets+xml\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"snd", "Content-Type: audio/basic\r\n", 3, 27},
+	{"atc", "Content-Type: application/vnd.acucorp\r\n", 3, 39},
+	{"bdm", "Content-Type: application/vnd.syncml.dm+wbxml\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"ufd", "Content-Type: application/vnd.ufdl\r\n", 3, 36},
+	{"shc", "Content-Type: text/shaclc\r\n", 3, 27},
+	{"svgz", "Content-Type: image/svg+xml\r\n", 4, 29},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"link66", "Content-Type: application/vnd.route66.link66+xml\r\n", 6, 50},
+	{"md", "Content-Type: text/markdown\r\n", 2, 29},
+	{"cnd", "Content-Type: text/jcr-cnd\r\n", 3, 28},
+	{"fla", "Content-Type: application/vnd.dtg.local.flash\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"smo", "Content-Type: video/vnd.sealedmedia.softseal.mov\r\n", 3, 50},
+	{"svg", "Content-Type: image/svg+xml\r\n", 3, 29},
+	{"pack", "Content-Type: application/x-java-pack200\r\n", 4, 42},
+	{"wbs", "Content-Type: application/vnd.criticaltools.wbs+xml\r\n", 3, 53},
+	{"", "", 0, 0},
+	{"edx", "Content-Type: application/vnd.novadigm.EDX\r\n", 3, 44},
+	{"swidtag", "Content-Type: application/swid+xml\r\n", 7, 36},
+	{"sr", "Content-Type: application/vnd.sigrok.session\r\n", 2, 46},
+	{"asics", "Content-Type: application/vnd.etsi.asic-s+zip\r\n", 5, 47},
+	{"ecelp9600", "Content-Type: audio/vnd.nuera.ecelp9600\r\n", 9, 41},
+	{"ccxml", "Content-Type: application/ccxml+xml\r\n", 5, 37},
+	{"bmi", "Content-Type: application/vnd.bmi\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"s1w", "Content-Type: application/vnd.sealed.doc\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"appcache", "Content-Type: text/cache-manifest\r\n", 8, 35},
+	{"xwd", "Content-Type: image/x-xwindowdump\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"xvml", "Content-Type: application/xv+xml\r\n", 4, 34},
+	{"", "", 0, 0},
+	{"rpm", "Content-Type: application/x-rpm\r\n", 3, 33},
+	{"pm", "Content-Type: text/plain\r\n", 2, 26},
+	{"", "", 0, 0},
+	{"vtt", "Content-Type: text/vtt\r\n", 3, 24},
+	{"csv", "Content-Type: text/csv\r\n", 3, 24},
+	{"", "", 0, 0},
+	{"fits", "Content-Type: image/fits\r\n", 4, 26},
+	{"pseg3820", "Content-Type: application/vnd.afpc.modca\r\n", 8, 42},
+	{"", "", 0, 0},
+	{"ac3", "Content-Type: audio/ac3\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"mpt", "Content-Type: application/vnd.ms-project\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mwf", "Content-Type: application/vnd.MFER\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"xav", "Content-Type: application/xcap-att+xml\r\n", 3, 40},
+	{"ief", "Content-Type: image/ief\r\n", 3, 25},
+	{"apk", "Content-Type: application/vnd.android.package-archive\r\n", 3, 55},
+	{"bik", "Content-Type: video/vnd.radgamettools.bink\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"uvx", "Content-Type: application/vnd.dece.unspecified\r\n", 3, 48},
+	{"6", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"xslt", "Content-Type: application/xslt+xml\r\n", 4, 36},
+	{"doc", "Content-Type: application/msword\r\n", 3, 34},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"spdf", "Content-Type: application/vnd.sealedmedia.softseal.pdf\r\n", 4, 56},
+	{"uvf", "Content-Type: application/vnd.dece.data\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"bkm", "Content-Type: application/vnd.nervana\r\n", 3, 39},
+	{"ts", "Content-Type: text/vnd.trolltech.linguist\r\n", 2, 43},
+	{"ult", "Content-Type: audio/x-mod\r\n", 3, 27},
+	{"t38", "Content-Type: image/t38\r\n", 3, 25},
+	{"s14", "Content-Type: video/vnd.sealed.mpeg4\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"tpt", "Content-Type: application/vnd.trid.tpt\r\n", 3, 40},
+	{"mmf", "Content-Type: application/vnd.smaf\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"hpgl", "Content-Type: application/vnd.hp-HPGL\r\n", 4, 39},
+	{"yme", "Content-Type: application/vnd.yaoweme\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"xca", "Content-Type: application/xcap-caps+xml\r\n", 3, 41},
+	{"xpr", "Content-Type: application/vnd.is-xpr\r\n", 3, 38},
+	{"nml", "Content-Type: application/vnd.enliven\r\n", 3, 39},
+	{"uvvu", "Content-Type: video/vnd.dece.mp4\r\n", 4, 34},
+	{"cpt", "Content-Type: application/mac-compactpro\r\n", 3, 42},
+	{"ic3", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"uvm", "Content-Type: video/vnd.dece.mobile\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"pwn", "Content-Type: application/vnd.3M.Post-it-Notes\r\n", 3, 48},
+	{"etx", "Content-Type: text/x-setext\r\n", 3, 29},
+	{"distz", "Content-Type: application/vnd.apple.installer+xml\r\n", 5, 51},
+	{"vds", "Content-Type: model/vnd.sap.vds\r\n", 3, 33},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"tsq", "Content-Type: application/timestamp-query\r\n", 3, 43},
+	{"dib", "Content-Type: image/bmp\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"xer", "Content-Type: application/xcap-error+xml\r\n", 3, 42},
+	{"tfi", "Content-Type: application/thraud+xml\r\n", 3, 38},
+	{"numbers", "Content-Type: application/vnd.apple.numbers\r\n", 7, 45},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"rar", "Content-Type: application/vnd.rar\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"sdp", "Content-Type: application/sdp\r\n", 3, 31},
+	{"sgm", "Content-Type: text/SGML\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"kpt", "Content-Type: application/vnd.kde.kpresenter\r\n", 3, 46},
+	{"sxm", "Content-Type: application/vnd.sun.xml.math\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"exi", "Content-Type: application/exi\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"fdf", "Content-Type: application/vnd.fdf\r\n", 3, 35},
+	{"mpg4", "Content-Type: video/mp4\r\n", 4, 25},
+	{"pub", "Content-Type: application/vnd.exstream-package\r\n", 3, 48},
+	{"uvvp", "Content-Type: video/vnd.dece.pd\r\n", 4, 33},
+	{"listafp", "Content-Type: application/vnd.afpc.modca\r\n", 7, 42},
+	{"sxls", "Content-Type: application/vnd.sealed.xls\r\n", 4, 42},
+	{"gex", "Content-Type: application/vnd.geometry-explorer\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"ppam", "Content-Type: application/vnd.ms-powerpoint.addin.macroEnabled.12\r\n", 4, 67},
+	{"ahead", "Content-Type: application/vnd.ahead.space\r\n", 5, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"3dml", "Content-Type: text/vnd.in3d.3dml\r\n", 4, 34},
+	{"stix", "Content-Type: application/stix+json\r\n", 4, 37},
+	{"", "", 0, 0},
+	{"igl", "Content-Type: application/vnd.igloader\r\n", 3, 40},
+	{"zip", "Content-Type: application/zip\r\n", 3, 31},
+	{"torrent", "Content-Type: application/x-bittorrent\r\n", 7, 40},
+	{"", "", 0, 0},
+	{"opus", "Content-Type: audio/ogg\r\n", 4, 25},
+	{"mf4", "Content-Type: application/MF4\r\n", 3, 31},
+	{"tamp", "Content-Type: application/vnd.onepagertamp\r\n", 4, 44},
+	{"cea", "Content-Type: application/CEA\r\n", 3, 31},
+	{"hpi", "Content-Type: application/vnd.hp-hpid\r\n", 3, 39},
+	{"odx", "Content-Type: application/ODX\r\n", 3, 31},
+	{"mgz", "Content-Type: application/vnd.proteus.magazine\r\n", 3, 48},
+	{"relo", "Content-Type: application/p2p-overlay+xml\r\n", 4, 43},
+	{"ogv", "Content-Type: video/ogg\r\n", 3, 25},
+	{"teicorpus", "Content-Type: application/tei+xml\r\n", 9, 35},
+	{"psg", "Content-Type: application/vnd.afpc.modca-pagesegment\r\n", 3, 54},
+	{"dssc", "Content-Type: application/dssc+der\r\n", 4, 36},
+	{"wk1", "Content-Type: application/vnd.lotus-1-2-3\r\n", 3, 43},
+	{"musd", "Content-Type: application/mmt-usd+xml\r\n", 4, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sam", "Content-Type: application/vnd.lotus-wordpro\r\n", 3, 45},
+	{"ic0", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"oprc", "Content-Type: application/vnd.palm\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"xdd", "Content-Type: application/bacnet-xdd+zip\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"pya", "Content-Type: audio/vnd.ms-playready.media.pya\r\n", 3, 48},
+	{"t", "Content-Type: text/troff\r\n", 1, 26},
+	{"or3", "Content-Type: application/vnd.lotus-organizer\r\n", 3, 47},
+	{"xdm", "Content-Type: application/vnd.syncml.dm+xml\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"stml", "Content-Type: application/vnd.sealedmedia.softseal.html\r\n", 4, 57},
+	{"gsheet", "Content-Type: application/urc-grpsheet+xml\r\n", 6, 44},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"urimap", "Content-Type: application/vnd.uri-map\r\n", 6, 39},
+	{"5", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"tsa", "Content-Type: application/tamp-sequence-adjust\r\n", 3, 48},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"movie", "Content-Type: video/x-sgi-movie\r\n", 5, 33},
+	{"cellml", "Content-Type: application/cellml+xml\r\n", 6, 38},
+	{"", "", 0, 0},
+	{"g3w", "Content-Type: application/vnd.geospace\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"xotp", "Content-Type: application/vnd.collabio.xodocuments.presentation-template\r\n", 4, 74},
+	{"mvt", "Content-Type: application/vnd.mapbox-vector-tile\r\n", 3, 50},
+	{"sxi", "Content-Type: application/vnd.sun.xml.impress\r\n", 3, 47},
+	{"uvva", "Content-Type: audio/vnd.dece.audio\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"atx", "Content-Type: audio/ATRAC-X\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"spx", "Content-Type: audio/ogg\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"aa3", "Content-Type: audio/ATRAC3\r\n", 3, 28},
+	{"vst", "Content-Type: application/vnd.visio\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"ac", "Content-Type: application/vnd.nokia.n-gage.ac+xml\r\n", 2, 51},
+	{"", "", 0, 0},
+	{"xpi", "Content-Type: application/x-xpinstall\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"le", "Content-Type: application/vnd.bluetooth.le.oob\r\n", 2, 48},
+	{"jtd", "Content-Type: text/vnd.esmertec.theme-descriptor\r\n", 3, 50},
+	{"ltf", "Content-Type: application/vnd.frogans.ltf\r\n", 3, 43},
+	{"potx", "Content-Type: application/vnd.openxmlformats-officedocument.presentationml.template\r\n", 4, 85},
+	{"", "", 0, 0},
+	{"sieve", "Content-Type: application/sieve\r\n", 5, 33},
+	{"", "", 0, 0},
+	{"fpx", "Content-Type: image/vnd.fpx\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"dotm", "Content-Type: application/vnd.ms-word.template.macroEnabled.12\r\n", 4, 64},
+	{"rp9", "Content-Type: application/vnd.cloanto.rp9\r\n", 3, 43},
+	{"lasxml", "Content-Type: application/vnd.las.las+xml\r\n", 6, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"spd", "Content-Type: application/vnd.sealedmedia.softseal.pdf\r\n", 3, 56},
+	{"dr", "Content-Type: application/vnd.oma.drm.rights+xml\r\n", 2, 50},
+	{"", "", 0, 0},
+	{"et3", "Content-Type: application/vnd.eszigno3+xml\r\n", 3, 44},
+	{"bk2", "Content-Type: video/vnd.radgamettools.bink\r\n", 3, 44},
+	{"loom", "Content-Type: application/vnd.loom\r\n", 4, 36},
+	{"uvvs", "Content-Type: video/vnd.dece.sd\r\n", 4, 33},
+	{"obg", "Content-Type: application/vnd.openblox.game-binary\r\n", 3, 52},
+	{"", "", 0, 0},
+	{"cdxml", "Content-Type: application/vnd.chemdraw+xml\r\n", 5, 44},
+	{"", "", 0, 0},
+	{"c11amz", "Content-Type: application/vnd.cluetrust.cartomobile-config-pkg\r\n", 6, 64},
+	{"rpst", "Content-Type: application/vnd.nokia.radio-preset\r\n", 4, 50},
+	{"spl", "Content-Type: application/x-futuresplash\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"8", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"pyox", "Content-Type: model/vnd.pytha.pyox\r\n", 4, 36},
+	{"cryptonote", "Content-Type: application/vnd.rig.cryptonote\r\n", 10, 46},
+	{"", "", 0, 0},
+	{"mif", "Content-Type: application/vnd.mif\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"rdf", "Content-Type: application/rdf+xml\r\n", 3, 35},
+	{"cdmid", "Content-Type: application/cdmi-domain\r\n", 5, 39},
+	{"sfd", "Content-Type: application/vnd.font-fontforge-sfd\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"uvvg", "Content-Type: image/vnd.dece.graphic\r\n", 4, 38},
+	{"", "", 0, 0},
+	{"ic2", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"rif", "Content-Type: application/reginfo+xml\r\n", 3, 39},
+	{"scm", "Content-Type: application/vnd.lotus-screencam\r\n", 3, 47},
+	{"psd", "Content-Type: image/vnd.adobe.photoshop\r\n", 3, 41},
+	{"1", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"nb", "Content-Type: application/mathematica\r\n", 2, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"woff2", "Content-Type: font/woff2\r\n", 5, 26},
+	{"sfs", "Content-Type: application/vnd.spotfire.sfs\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"knp", "Content-Type: application/vnd.Kinar\r\n", 3, 37},
+	{"kwt", "Content-Type: application/vnd.kde.kword\r\n", 3, 41},
+	{"inkml", "Content-Type: application/inkml+xml\r\n", 5, 37},
+	{"f90", "Content-Type: text/plain\r\n", 3, 26},
+	{"scl", "Content-Type: application/vnd.sycle+xml\r\n", 3, 41},
+	{"img", "Content-Type: application/octet-stream\r\n", 3, 40},
+	{"spq", "Content-Type: application/scvp-vp-request\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"sxc", "Content-Type: application/vnd.sun.xml.calc\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"xsd", "Content-Type: text/xml\r\n", 3, 24},
+	{"gre", "Content-Type: application/vnd.geometry-explorer\r\n", 3, 49},
+	{"senml-etchc", "Content-Type: application/senml-etch+cbor\r\n", 11, 43},
+	{"upa", "Content-Type: application/vnd.hbci\r\n", 3, 36},
+	{"xht", "Content-Type: application/xhtml+xml\r\n", 3, 37},
+	{"senmlx", "Content-Type: application/senml+xml\r\n", 6, 37},
+	{"lzh", "Content-Type: application/octet-stream\r\n", 3, 40},
+	{"smv", "Content-Type: audio/SMV\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"jfif", "Content-Type: image/jpeg\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"tmo", "Content-Type: application/vnd.tmobile-livetv\r\n", 3, 46},
+	{"ogg", "Content-Type: audio/ogg\r\n", 3, 25},
+	{"jpf", "Content-Type: image/jpx\r\n", 3, 25},
+	{"wasm", "Content-Type: application/wasm\r\n", 4, 32},
+	{"lostsyncxml", "Content-Type: application/lostsync+xml\r\n", 11, 40},
+	{"texi", "Content-Type: application/x-texinfo\r\n", 4, 37},
+	{"xsl", "Content-Type: application/xslt+xml\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"shx", "Content-Type: application/vnd.shx\r\n", 3, 35},
+	{"zaz", "Content-Type: application/vnd.zzazz.deck+xml\r\n", 3, 46},
+	{"dor", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"hsj2", "Content-Type: image/hsj2\r\n", 4, 26},
+	{"mpeg", "Content-Type: video/mpeg\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"cdbcmsg", "Content-Type: application/vnd.contact.cmsg\r\n", 7, 44},
+	{"vew", "Content-Type: application/vnd.lotus-approach\r\n", 3, 46},
+	{"aif", "Content-Type: audio/x-aiff\r\n", 3, 28},
+	{"dls", "Content-Type: audio/dls\r\n", 3, 25},
+	{"ac2", "Content-Type: application/vnd.banana-accounting\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"vsc", "Content-Type: application/vnd.vidsoft.vidconference\r\n", 3, 53},
+	{"otf", "Content-Type: font/otf\r\n", 3, 24},
+	{"uvvf", "Content-Type: application/vnd.dece.data\r\n", 4, 41},
+	{"uvu", "Content-Type: video/vnd.dece.mp4\r\n", 3, 34},
+	{"silo", "Content-Type: model/mesh\r\n", 4, 26},
+	{"mpe", "Content-Type: video/mpeg\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"otg", "Content-Type: application/vnd.oasis.opendocument.graphics-template\r\n", 3, 68},
+	{"wg", "Content-Type: application/vnd.pmi.widget\r\n", 2, 42},
+	{"", "", 0, 0},
+	{"avci", "Content-Type: image/avci\r\n", 4, 26},
+	{"crl", "Content-Type: application/pkix-crl\r\n", 3, 36},
+	{"mov", "Content-Type: video/quicktime\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"copyright", "Content-Type: text/vnd.debian.copyright\r\n", 9, 41},
+	{"nim", "Content-Type: video/vnd.nokia.interleaved-multimedia\r\n", 3, 54},
+	{"xfdf", "Content-Type: application/vnd.adobe.xfdf\r\n", 4, 42},
+	{"ott", "Content-Type: application/vnd.oasis.opendocument.text-template\r\n", 3, 64},
+	{"umj", "Content-Type: application/vnd.umajin\r\n", 3, 38},
+	{"ppsm", "Content-Type: application/vnd.ms-powerpoint.slideshow.macroEnabled.12\r\n", 4, 71},
+	{"tau", "Content-Type: application/tamp-apex-update\r\n", 3, 44},
+	{"ent", "Content-Type: text/xml-external-parsed-entity\r\n", 3, 47},
+	{"mads", "Content-Type: application/mads+xml\r\n", 4, 36},
+	{"pyv", "Content-Type: video/vnd.ms-playready.media.pyv\r\n", 3, 48},
+	{"ass", "Content-Type: audio/aac\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"dzr", "Content-Type: application/vnd.dzr\r\n", 3, 35},
+	{"vsf", "Content-Type: application/vnd.vsf\r\n", 3, 35},
+	{"jxl", "Content-Type: image/jxl\r\n", 3, 25},
+	{"midi", "Content-Type: audio/midi\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"xsf", "Content-Type: application/prs.xsf+xml\r\n", 3, 39},
+	{"3", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"", "", 0, 0},
+	{"a", "Content-Type: text/vnd.a\r\n", 1, 26},
+	{"", "", 0, 0},
+	{"pvb", "Content-Type: application/vnd.3gpp.pic-bw-var\r\n", 3, 47},
+	{"jam", "Content-Type: application/vnd.jam\r\n", 3, 35},
+	{"wml", "Content-Type: text/vnd.wap.wml\r\n", 3, 32},
+	{"", "", 0, 0},
+	{"xlf", "Content-Type: application/xliff+xml\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"mpd", "Content-Type: application/dash+xml\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ait", "Content-Type: application/vnd.dvb.ait\r\n", 3, 39},
+	{"sswf", "Content-Type: video/vnd.sealed.swf\r\n", 4, 36},
+	{"ptid", "Content-Type: application/vnd.pvi.ptid1\r\n", 4, 41},
+	{"", "", 0, 0},
+	{"qcall", "Content-Type: application/vnd.ericsson.quickcall\r\n", 5, 50},
+	{"wgt", "Content-Type: application/widget\r\n", 3, 34},
+	{"tnef", "Content-Type: application/vnd.ms-tnef\r\n", 4, 39},
+	{"atomcat", "Content-Type: application/atomcat+xml\r\n", 7, 39},
+	{"tst", "Content-Type: application/vnd.etsi.timestamp-token\r\n", 3, 52},
+	{"axv", "Content-Type: video/x-annodex\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sce", "Content-Type: application/vnd.etsi.asic-e+zip\r\n", 3, 47},
+	{"jad", "Content-Type: text/vnd.sun.j2me.app-descriptor\r\n", 3, 48},
+	{"s1g", "Content-Type: image/vnd.sealedmedia.softseal.gif\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"bpd", "Content-Type: application/vnd.hbci\r\n", 3, 36},
+	{"dit", "Content-Type: application/DIT\r\n", 3, 31},
+	{"tei", "Content-Type: application/tei+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"ics", "Content-Type: text/calendar\r\n", 3, 29},
+	{"rm", "Content-Type: audio/x-pn-realaudio\r\n", 2, 36},
+	{"pskcxml", "Content-Type: application/pskc+xml\r\n", 7, 36},
+	{"amr", "Content-Type: audio/AMR\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"jisp", "Content-Type: application/vnd.jisp\r\n", 4, 36},
+	{"dm", "Content-Type: application/vnd.oma.drm.message\r\n", 2, 47},
+	{"orq", "Content-Type: application/ocsp-request\r\n", 3, 40},
+	{"ppm", "Content-Type: image/x-portable-pixmap\r\n", 3, 39},
+	{"pre", "Content-Type: application/vnd.lotus-freelance\r\n", 3, 47},
+	{"uric", "Content-Type: text/vnd.si.uricatalogue\r\n", 4, 40},
+	{"rpss", "Content-Type: application/vnd.nokia.radio-presets\r\n", 4, 51},
+	{"evb", "Content-Type: audio/EVRCB\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"djv", "Content-Type: image/vnd.djvu\r\n", 3, 30},
+	{"", "", 0, 0},
+	{"sjpg", "Content-Type: image/vnd.sealedmedia.softseal.jpg\r\n", 4, 50},
+	{"stf", "Content-Type: application/vnd.wt.stf\r\n", 3, 38},
+	{"qwd", "Content-Type: application/vnd.Quark.QuarkXPress\r\n", 3, 49},
+	{"nq", "Content-Type: application/n-quads\r\n", 2, 35},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"wbxml", "Content-Type: application/vnd.wap.wbxml\r\n", 5, 41},
+	{"zst", "Content-Type: application/zstd\r\n", 3, 32},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"line", "Content-Type: application/vnd.nebumind.line\r\n", 4, 45},
+	{"xods", "Content-Type: application/vnd.collabio.xodocuments.spreadsheet\r\n", 4, 64},
+	{"", "", 0, 0},
+	{"pyo", "Content-Type: model/vnd.pytha.pyox\r\n", 3, 36},
+	{"zfc", "Content-Type: application/vnd.filmit.zfc\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"fnc", "Content-Type: application/vnd.frogans.fnc\r\n", 3, 43},
+	{"vbk", "Content-Type: audio/vnd.nortel.vbk\r\n", 3, 36},
+	{"mp3", "Content-Type: audio/mpeg\r\n", 3, 26},
+	{"azs", "Content-Type: application/vnd.airzip.filesecure.azs\r\n", 3, 53},
+	{"rgb", "Content-Type: image/x-rgb\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"atomdeleted", "Content-Type: application/atomdeleted+xml\r\n", 11, 43},
+	{"ppt", "Content-Type: application/vnd.ms-powerpoint\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ntf", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"ic4", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"itp", "Content-Type: application/vnd.shana.informed.formtemplate\r\n", 3, 59},
+	{"bin", "Content-Type: application/octet-stream\r\n", 3, 40},
+	{"imp", "Content-Type: application/vnd.accpac.simply.imp\r\n", 3, 49},
+	{"dvc", "Content-Type: application/dvcs\r\n", 3, 32},
+	{"dpkg", "Content-Type: application/vnd.xmpie.dpkg\r\n", 4, 42},
+	{"psb", "Content-Type: application/vnd.3gpp.pic-bw-small\r\n", 3, 49},
+	{"p7c", "Content-Type: application/pkcs7-mime\r\n", 3, 38},
+	{"hif", "Content-Type: image/avif\r\n", 3, 26},
+	{"pqa", "Content-Type: application/vnd.palm\r\n", 3, 36},
+	{"ovl", "Content-Type: application/vnd.afpc.modca-overlay\r\n", 3, 50},
+	{"hqx", "Content-Type: application/mac-binhex40\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"wpd", "Content-Type: application/vnd.wordperfect\r\n", 3, 43},
+	{"kml", "Content-Type: application/vnd.google-earth.kml+xml\r\n", 3, 52},
+	{"hans", "Content-Type: text/vnd.hans\r\n", 4, 29},
+	{"wma", "Content-Type: audio/x-ms-wma\r\n", 3, 30},
+	{"pti", "Content-Type: image/prs.pti\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"atom", "Content-Type: application/atom+xml\r\n", 4, 36},
+	{"koz", "Content-Type: audio/vnd.audiokoz\r\n", 3, 34},
+	{"", "", 0, 0},
+	{"shar", "Content-Type: application/x-shar\r\n", 4, 34},
+	{"conf", "Content-Type: text/plain\r\n", 4, 26},
+	{"xdssc", "Content-Type: application/dssc+xml\r\n", 5, 36},
+	{"nbp", "Content-Type: application/vnd.wolfram.player\r\n", 3, 46},
+	{"list3820", "Content-Type: application/vnd.afpc.modca\r\n", 8, 42},
+	{"mbox", "Content-Type: application/mbox\r\n", 4, 32},
+	{"flo", "Content-Type: application/vnd.micrografx.flo\r\n", 3, 46},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"fzs", "Content-Type: application/vnd.fuzzysheet\r\n", 3, 42},
+	{"hbc", "Content-Type: application/vnd.hbci\r\n", 3, 36},
+	{"drc", "Content-Type: application/vnd.oma.drm.rights+wbxml\r\n", 3, 52},
+	{"jxrs", "Content-Type: image/jxrS\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"ods", "Content-Type: application/vnd.oasis.opendocument.spreadsheet\r\n", 3, 62},
+	{"", "", 0, 0},
+	{"dna", "Content-Type: application/vnd.dna\r\n", 3, 35},
+	{"s11", "Content-Type: video/vnd.sealed.mpeg1\r\n", 3, 38},
+	{"xop", "Content-Type: application/xop+xml\r\n", 3, 35},
+	{"dd2", "Content-Type: application/vnd.oma.dd2+xml\r\n", 3, 43},
+	{"qxb", "Content-Type: application/vnd.Quark.QuarkXPress\r\n", 3, 49},
+	{"3gpp", "Content-Type: video/3gpp\r\n", 4, 26},
+	{"dist", "Content-Type: application/vnd.apple.installer+xml\r\n", 4, 51},
+	{"uvvi", "Content-Type: image/vnd.dece.graphic\r\n", 4, 38},
+	{"jar", "Content-Type: application/x-java-archive\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"xsm", "Content-Type: application/vnd.syncml+xml\r\n", 3, 42},
+	{"daf", "Content-Type: application/vnd.Mobius.DAF\r\n", 3, 42},
+	{"ivu", "Content-Type: application/vnd.immervision-ivu\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"wdb", "Content-Type: application/vnd.ms-works\r\n", 3, 40},
+	{"dmp", "Content-Type: application/vnd.tcpdump.pcap\r\n", 3, 44},
+	{"preminet", "Content-Type: application/vnd.preminet\r\n", 8, 40},
+	{"wks", "Content-Type: application/vnd.ms-works\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"rsheet", "Content-Type: application/urc-ressheet+xml\r\n", 6, 44},
+	{"", "", 0, 0},
+	{"hvd", "Content-Type: application/vnd.yamaha.hv-dic\r\n", 3, 45},
+	{"mxf", "Content-Type: application/mxf\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"cab", "Content-Type: application/vnd.ms-cab-compressed\r\n", 3, 49},
+	{"gtar", "Content-Type: application/x-gtar\r\n", 4, 34},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"a2l", "Content-Type: application/A2L\r\n", 3, 31},
+	{"zir", "Content-Type: application/vnd.zul\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"docjson", "Content-Type: application/vnd.document+json\r\n", 7, 45},
+	{"gph", "Content-Type: application/vnd.FloGraphIt\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"lasjson", "Content-Type: application/vnd.las.las+json\r\n", 7, 44},
+	{"mc2", "Content-Type: text/vnd.senx.warpscript\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"rcprofile", "Content-Type: application/vnd.ipunplugged.rcprofile\r\n", 9, 53},
+	{"ecig", "Content-Type: application/vnd.evolv.ecig.settings\r\n", 4, 51},
+	{"swf", "Content-Type: application/vnd.adobe.flash.movie\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"vwx", "Content-Type: application/vnd.vectorworks\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"tfx", "Content-Type: image/tiff-fx\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"c3ex", "Content-Type: application/cccex\r\n", 4, 33},
+	{"", "", 0, 0},
+	{"sisx", "Content-Type: x-epoc/x-sisx-app\r\n", 4, 33},
+	{"webm", "Content-Type: video/webm\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"edm", "Content-Type: application/vnd.novadigm.EDM\r\n", 3, 44},
+	{"rip", "Content-Type: audio/vnd.rip\r\n", 3, 29},
+	{"odg", "Content-Type: application/vnd.oasis.opendocument.graphics\r\n", 3, 59},
+	{"wmc", "Content-Type: application/vnd.wmc\r\n", 3, 35},
+	{"gsm", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"sarif", "Content-Type: application/sarif+json\r\n", 5, 38},
+	{"", "", 0, 0},
+	{"pptm", "Content-Type: application/vnd.ms-powerpoint.presentation.macroEnabled.12\r\n", 4, 74},
+	{"ras", "Content-Type: image/x-cmu-raster\r\n", 3, 34},
+	{"text", "Content-Type: text/plain\r\n", 4, 26},
+	{"geojson", "Content-Type: application/geo+json\r\n", 7, 36},
+	{"", "", 0, 0},
+	{"json-patch", "Content-Type: application/json-patch+json\r\n", 10, 43},
+	{"xlw", "Content-Type: application/vnd.ms-excel\r\n", 3, 40},
+	{"wmv", "Content-Type: video/x-ms-wmv\r\n", 3, 30},
+	{"ms", "Content-Type: application/x-troff-ms\r\n", 2, 38},
+	{"sru", "Content-Type: application/sru+xml\r\n", 3, 35},
+	{"odc", "Content-Type: application/vnd.oasis.opendocument.chart\r\n", 3, 56},
+	{"jpeg", "Content-Type: image/jpeg\r\n", 4, 26},
+	{"cif", "Content-Type: application/vnd.multiad.creator.cif\r\n", 3, 51},
+	{"cdmiq", "Content-Type: application/cdmi-queue\r\n", 5, 38},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"dwd", "Content-Type: application/atsc-dwd+xml\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"rgbe", "Content-Type: image/vnd.radiance\r\n", 4, 34},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"c11amc", "Content-Type: application/vnd.cluetrust.cartomobile-config\r\n", 6, 60},
+	{"xel", "Content-Type: application/xcap-el+xml\r\n", 3, 39},
+	{"roa", "Content-Type: application/rpki-roa\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"s3df", "Content-Type: application/vnd.sealed.3df\r\n", 4, 42},
+	{"", "", 0, 0},
+	{"meta4", "Content-Type: application/metalink4+xml\r\n", 5, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"hdr", "Content-Type: image/vnd.radiance\r\n", 3, 34},
+	{"", "", 0, 0},
+	{"xott", "Content-Type: application/vnd.collabio.xodocuments.document-template\r\n", 4, 70},
+	{"jpg2", "Content-Type: image/jp2\r\n", 4, 25},
+	{"c4g", "Content-Type: application/vnd.clonk.c4group\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"odm", "Content-Type: application/vnd.oasis.opendocument.text-master\r\n", 3, 62},
+	{"", "", 0, 0},
+	{"ddd", "Content-Type: application/vnd.fujixerox.ddd\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"bmp", "Content-Type: image/bmp\r\n", 3, 25},
+	{"oeb", "Content-Type: application/vnd.openeye.oeb\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"wlnk", "Content-Type: application/link-format\r\n", 4, 39},
+	{"xdp", "Content-Type: application/vnd.adobe.xdp+xml\r\n", 3, 45},
+	{"pfx", "Content-Type: application/pkcs12\r\n", 3, 34},
+	{"woff", "Content-Type: font/woff\r\n", 4, 25},
+	{"", "", 0, 0},
+	{"fe_launch", "Content-Type: application/vnd.denovo.fcselayout-link\r\n", 9, 54},
+	{"u8dsn", "Content-Type: message/global-delivery-status\r\n", 5, 46},
+	{"spo", "Content-Type: text/vnd.in3d.spot\r\n", 3, 34},
+	{"", "", 0, 0},
+	{"heif", "Content-Type: image/heif\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"gff3", "Content-Type: text/gff3\r\n", 4, 25},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"vsw", "Content-Type: application/vnd.visio\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"icf", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"msd", "Content-Type: application/vnd.fdsn.mseed\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"vcf", "Content-Type: text/vcard\r\n", 3, 26},
+	{"sms", "Content-Type: application/vnd.3gpp2.sms\r\n", 3, 41},
+	{"uvh", "Content-Type: video/vnd.dece.hd\r\n", 3, 33},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"senmle", "Content-Type: application/senml-exi\r\n", 6, 37},
+	{"gbr", "Content-Type: application/rpki-ghostbusters\r\n", 3, 45},
+	{"cer", "Content-Type: application/pkix-cert\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"vis", "Content-Type: application/vnd.visionary\r\n", 3, 41},
+	{"hh", "Content-Type: text/plain\r\n", 2, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mb", "Content-Type: application/mathematica\r\n", 2, 39},
+	{"pkd", "Content-Type: application/vnd.hbci\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"wm", "Content-Type: video/x-ms-wm\r\n", 2, 29},
+	{"", "", 0, 0},
+	{"spng", "Content-Type: image/vnd.sealed.png\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"gml", "Content-Type: application/gml+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"ustar", "Content-Type: application/x-ustar\r\n", 5, 35},
+	{"qwt", "Content-Type: application/vnd.Quark.QuarkXPress\r\n", 3, 49},
+	{"nimn", "Content-Type: application/vnd.nimn\r\n", 4, 36},
+	{"pdx", "Content-Type: application/PDX\r\n", 3, 31},
+	{"vpm", "Content-Type: multipart/voice-message\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"portpkg", "Content-Type: application/vnd.macports.portpkg\r\n", 7, 48},
+	{"win", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"hpid", "Content-Type: application/vnd.hp-hpid\r\n", 4, 39},
+	{"1clr", "Content-Type: application/clr\r\n", 4, 31},
+	{"odt", "Content-Type: application/vnd.oasis.opendocument.text\r\n", 3, 55},
+	{"c9s", "Content-Type: application/vnd.cryptomator.encrypted\r\n", 3, 53},
+	{"qfx", "Content-Type: application/vnd.intu.qfx\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"sv4cpio", "Content-Type: application/x-sv4cpio\r\n", 7, 37},
+	{"jp2", "Content-Type: image/jp2\r\n", 3, 25},
+	{"vcx", "Content-Type: application/vnd.vcx\r\n", 3, 35},
+	{"clue", "Content-Type: application/clue_info+xml\r\n", 4, 41},
+	{"", "", 0, 0},
+	{"davmount", "Content-Type: application/davmount+xml\r\n", 8, 40},
+	{"json", "Content-Type: application/json\r\n", 4, 32},
+	{"utz", "Content-Type: application/vnd.uiq.theme\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sqlite3", "Content-Type: application/vnd.sqlite3\r\n", 7, 39},
+	{"rtx", "Content-Type: text/richtext\r\n", 3, 29},
+	{"icd", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"ic8", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"mpga", "Content-Type: audio/mpeg\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"mdc", "Content-Type: application/vnd.marlin.drm.mdcf\r\n", 3, 47},
+	{"mms", "Content-Type: application/vnd.wap.mms-message\r\n", 3, 47},
+	{"rld", "Content-Type: application/resource-lists-diff+xml\r\n", 3, 51},
+	{"uvvx", "Content-Type: application/vnd.dece.unspecified\r\n", 4, 48},
+	{"msty", "Content-Type: application/vnd.muvee.style\r\n", 4, 43},
+	{"xltm", "Content-Type: application/vnd.ms-excel.template.macroEnabled.12\r\n", 4, 65},
+	{"so", "Content-Type: application/octet-stream\r\n", 2, 40},
+	{"mwc", "Content-Type: application/vnd.dpgraph\r\n", 3, 39},
+	{"rss", "Content-Type: application/rss+xml\r\n", 3, 35},
+	{"mfm", "Content-Type: application/vnd.mfmp\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"cdmia", "Content-Type: application/cdmi-capability\r\n", 5, 43},
+	{"ic5", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"qbo", "Content-Type: application/vnd.intu.qbo\r\n", 3, 40},
+	{"lcs", "Content-Type: application/vnd.logipipe.circuit+zip\r\n", 3, 52},
+	{"gqf", "Content-Type: application/vnd.grafeq\r\n", 3, 38},
+	{"ots", "Content-Type: application/vnd.oasis.opendocument.spreadsheet-template\r\n", 3, 71},
+	{"m4s", "Content-Type: video/iso.segment\r\n", 3, 33},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"aml", "Content-Type: application/AML\r\n", 3, 31},
+	{"cpio", "Content-Type: application/x-cpio\r\n", 4, 34},
+	{"lha", "Content-Type: application/octet-stream\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"cpl", "Content-Type: application/cpl+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"bmpr", "Content-Type: application/vnd.balsamiq.bmpr\r\n", 4, 45},
+	{"", "", 0, 0},
+	{"wax", "Content-Type: audio/x-ms-wax\r\n", 3, 30},
+	{"owx", "Content-Type: application/owl+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"or2", "Content-Type: application/vnd.lotus-organizer\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"class", "Content-Type: application/octet-stream\r\n", 5, 40},
+	{"dfac", "Content-Type: application/vnd.dreamfactory\r\n", 4, 44},
+	{"ssvc", "Content-Type: application/vnd.crypto-shade-file\r\n", 4, 49},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"wvx", "Content-Type: video/x-ms-wvx\r\n", 3, 30},
+	{"mk3d", "Content-Type: video/x-matroska-3d\r\n", 4, 35},
+	{"mkv", "Content-Type: video/x-matroska\r\n", 3, 32},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"hvs", "Content-Type: application/vnd.yamaha.hv-script\r\n", 3, 48},
+	{"xhe", "Content-Type: audio/usac\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"h", "Content-Type: text/plain\r\n", 1, 26},
+	{"aep", "Content-Type: application/vnd.audiograph\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"srx", "Content-Type: application/sparql-results+xml\r\n", 3, 46},
+	{"cdy", "Content-Type: application/vnd.cinderella\r\n", 3, 42},
+	{"ptrom", "Content-Type: application/vnd.snesdev-page-table\r\n", 5, 50},
+	{"", "", 0, 0},
+	{"jsontd", "Content-Type: application/td+json\r\n", 6, 35},
+	{"clkk", "Content-Type: application/vnd.crick.clicker.keyboard\r\n", 4, 54},
+	{"wbmp", "Content-Type: image/vnd.wap.wbmp\r\n", 4, 34},
+	{"x3db", "Content-Type: model/x3d+xml\r\n", 4, 29},
+	{"tcl", "Content-Type: application/x-tcl\r\n", 3, 33},
+	{"hbci", "Content-Type: application/vnd.hbci\r\n", 4, 36},
+	{"mseed", "Content-Type: application/vnd.fdsn.mseed\r\n", 5, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"3mf", "Content-Type: application/vnd.ms-3mfdocument\r\n", 3, 46},
+	{"odb", "Content-Type: application/vnd.oasis.opendocument.database\r\n", 3, 59},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"bed", "Content-Type: application/vnd.realvnc.bed\r\n", 3, 43},
+	{"vfr", "Content-Type: application/vnd.tml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"otc", "Content-Type: application/vnd.oasis.opendocument.chart-template\r\n", 3, 65},
+	{"ecelp7470", "Content-Type: audio/vnd.nuera.ecelp7470\r\n", 9, 41},
+	{"cmsc", "Content-Type: application/cms\r\n", 4, 31},
+	{"", "", 0, 0},
+	{"heic", "Content-Type: image/heic\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"sc", "Content-Type: application/vnd.ibm.secure-container\r\n", 2, 52},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"aiff", "Content-Type: audio/x-aiff\r\n", 4, 28},
+	{"dive", "Content-Type: application/vnd.patentdive\r\n", 4, 42},
+	{"sldm", "Content-Type: application/vnd.ms-powerpoint.slide.macroEnabled.12\r\n", 4, 67},
+	{"", "", 0, 0},
+	{"7", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"", "", 0, 0},
+	{"xhtml", "Content-Type: application/xhtml+xml\r\n", 5, 37},
+	{"sdkd", "Content-Type: application/vnd.solent.sdkm+xml\r\n", 4, 47},
+	{"", "", 0, 0},
+	{"sppt", "Content-Type: application/vnd.sealed.ppt\r\n", 4, 42},
+	{"txt", "Content-Type: text/plain\r\n", 3, 26},
+	{"prz", "Content-Type: application/vnd.lotus-freelance\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mj2", "Content-Type: video/mj2\r\n", 3, 25},
+	{"xlm", "Content-Type: application/vnd.ms-excel\r\n", 3, 40},
+	{"mxl", "Content-Type: application/vnd.recordare.musicxml\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"sarif-external-properties", "Content-Type: application/sarif-external-properties+json\r\n", 25, 58},
+	{"gv", "Content-Type: text/vnd.graphviz\r\n", 2, 33},
+	{"mpdd", "Content-Type: application/dashdelta\r\n", 4, 37},
+	{"uva", "Content-Type: audio/vnd.dece.audio\r\n", 3, 36},
+	{"zmm", "Content-Type: application/vnd.HandHeld-Entertainment+xml\r\n", 3, 58},
+	{"", "", 0, 0},
+	{"uoml", "Content-Type: application/vnd.uoml+xml\r\n", 4, 40},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"apxml", "Content-Type: application/auth-policy+xml\r\n", 5, 43},
+	{"mka", "Content-Type: audio/x-matroska\r\n", 3, 32},
+	{"", "", 0, 0},
+	{"rs", "Content-Type: application/rls-services+xml\r\n", 2, 44},
+	{"", "", 0, 0},
+	{"jpgm", "Content-Type: image/jpm\r\n", 4, 25},
+	{"", "", 0, 0},
+	{"htke", "Content-Type: application/vnd.kenameaapp\r\n", 4, 42},
+	{"", "", 0, 0},
+	{"gmx", "Content-Type: application/vnd.gmx\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"rtf", "Content-Type: application/rtf\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"smp", "Content-Type: audio/vnd.sealedmedia.softseal.mpeg\r\n", 3, 51},
+	{"jrd", "Content-Type: application/jrd+json\r\n", 3, 36},
+	{"msh", "Content-Type: model/mesh\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"ufdl", "Content-Type: application/vnd.ufdl\r\n", 4, 36},
+	{"jnlp", "Content-Type: application/x-java-jnlp-file\r\n", 4, 44},
+	{"xcs", "Content-Type: application/calendar+xml\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"spp", "Content-Type: application/scvp-vp-response\r\n", 3, 44},
+	{"tao", "Content-Type: application/vnd.tao.intent-module-archive\r\n", 3, 57},
+	{"dataless", "Content-Type: application/vnd.fdsn.seed\r\n", 8, 41},
+	{"joda", "Content-Type: application/vnd.joost.joda-archive\r\n", 4, 50},
+	{"gqs", "Content-Type: application/vnd.grafeq\r\n", 3, 38},
+	{"avi", "Content-Type: video/x-msvideo\r\n", 3, 31},
+	{"jxs", "Content-Type: image/jxs\r\n", 3, 25},
+	{"apng", "Content-Type: image/vnd.mozilla.apng\r\n", 4, 38},
+	{"evc", "Content-Type: audio/EVRC\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"gpkg", "Content-Type: application/geopackage+sqlite3\r\n", 4, 46},
+	{"", "", 0, 0},
+	{"tree", "Content-Type: application/vnd.rainstor.data\r\n", 4, 45},
+	{"", "", 0, 0},
+	{"glbuf", "Content-Type: application/gltf-buffer\r\n", 5, 39},
+	{"g2w", "Content-Type: application/vnd.geoplan\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"sensmle", "Content-Type: application/sensml-exi\r\n", 7, 38},
+	{"tlclient", "Content-Type: application/vnd.cendio.thinlinc.clientconf\r\n", 8, 58},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"rdf-crypt", "Content-Type: application/prs.rdf-xml-crypt\r\n", 9, 45},
+	{"atf", "Content-Type: application/ATF\r\n", 3, 31},
+	{"mods", "Content-Type: application/mods+xml\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"vmt", "Content-Type: application/vnd.valve.source.material\r\n", 3, 53},
+	{"mtm", "Content-Type: audio/x-mod\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"uvvt", "Content-Type: application/vnd.dece.ttml+xml\r\n", 4, 45},
+	{"", "", 0, 0},
+	{"coffee", "Content-Type: application/vnd.coffeescript\r\n", 6, 44},
+	{"3g2", "Content-Type: video/3gpp2\r\n", 3, 27},
+	{"djvu", "Content-Type: image/vnd.djvu\r\n", 4, 30},
+	{"wsdl", "Content-Type: application/wsdl+xml\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"ei6", "Content-Type: application/vnd.pg.osasli\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"fxm", "Content-Type: video/x-javafx\r\n", 3, 30},
+	{"oa2", "Content-Type: application/vnd.fujitsu.oasys2\r\n", 3, 46},
+	{"p12", "Content-Type: application/pkcs12\r\n", 3, 34},
+	{"el", "Content-Type: text/plain\r\n", 2, 26},
+	{"xo", "Content-Type: application/vnd.olpc-sugar\r\n", 2, 42},
+	{"", "", 0, 0},
+	{"ecelp4800", "Content-Type: audio/vnd.nuera.ecelp4800\r\n", 9, 41},
+	{"omg", "Content-Type: audio/ATRAC3\r\n", 3, 28},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"c", "Content-Type: text/plain\r\n", 1, 26},
+	{"", "", 0, 0},
+	{"jxr", "Content-Type: image/jxr\r\n", 3, 25},
+	{"uvp", "Content-Type: video/vnd.dece.pd\r\n", 3, 33},
+	{"ter", "Content-Type: application/tamp-error\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"uvv", "Content-Type: video/vnd.dece.video\r\n", 3, 36},
+	{"asx", "Content-Type: video/x-ms-asf\r\n", 3, 30},
+	{"tiff", "Content-Type: image/tiff\r\n", 4, 26},
+	{"lvp", "Content-Type: audio/vnd.lucent.voice\r\n", 3, 38},
+	{"apr", "Content-Type: application/vnd.lotus-approach\r\n", 3, 46},
+	{"", "", 0, 0},
+	{"swi", "Content-Type: application/vnd.aristanetworks.swi\r\n", 3, 50},
+	{"sla", "Content-Type: application/vnd.scribus\r\n", 3, 39},
+	{"obgx", "Content-Type: application/vnd.openblox.game+xml\r\n", 4, 49},
+	{"mail", "Content-Type: message/rfc822\r\n", 4, 30},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"tsv", "Content-Type: text/tab-separated-values\r\n", 3, 41},
+	{"plf", "Content-Type: application/vnd.pocketlearn\r\n", 3, 43},
+	{"ignition", "Content-Type: application/vnd.coreos.ignition+json\r\n", 8, 52},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"afp", "Content-Type: application/vnd.afpc.modca\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sit", "Content-Type: application/x-stuffit\r\n", 3, 37},
+	{"sgi", "Content-Type: image/vnd.sealedmedia.softseal.gif\r\n", 3, 50},
+	{"sxd", "Content-Type: application/vnd.sun.xml.draw\r\n", 3, 44},
+	{"dart", "Content-Type: application/vnd.dart\r\n", 4, 36},
+	{"aso", "Content-Type: application/vnd.accpac.simply.aso\r\n", 3, 49},
+	{"qcp", "Content-Type: audio/QCELP\r\n", 3, 27},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"docx", "Content-Type: application/vnd.openxmlformats-officedocument.wordprocessingml.document\r\n", 4, 87},
+	{"dis", "Content-Type: application/vnd.Mobius.DIS\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"adts", "Content-Type: audio/aac\r\n", 4, 25},
+	{"", "", 0, 0},
+	{"psid", "Content-Type: audio/prs.sid\r\n", 4, 29},
+	{"fst", "Content-Type: image/vnd.fst\r\n", 3, 29},
+	{"tex", "Content-Type: application/x-tex\r\n", 3, 33},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ogex", "Content-Type: model/vnd.opengex\r\n", 4, 33},
+	{"", "", 0, 0},
+	{"sis", "Content-Type: application/vnd.symbian.install\r\n", 3, 47},
+	{"emma", "Content-Type: application/emma+xml\r\n", 4, 36},
+	{"crtr", "Content-Type: application/vnd.multiad.creator\r\n", 4, 47},
+	{"", "", 0, 0},
+	{"iges", "Content-Type: model/iges\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"xla", "Content-Type: application/vnd.ms-excel\r\n", 3, 40},
+	{"ggb", "Content-Type: application/vnd.geogebra.file\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sema", "Content-Type: application/vnd.sema\r\n", 4, 36},
+	{"726", "Content-Type: audio/32kadpcm\r\n", 3, 30},
+	{"cml", "Content-Type: application/cellml+xml\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"nlu", "Content-Type: application/vnd.neurolanguage.nlu\r\n", 3, 49},
+	{"au", "Content-Type: audio/basic\r\n", 2, 27},
+	{"obj", "Content-Type: model/obj\r\n", 3, 25},
+	{"qxt", "Content-Type: application/vnd.Quark.QuarkXPress\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"texinfo", "Content-Type: application/x-texinfo\r\n", 7, 37},
+	{"scq", "Content-Type: application/scvp-cv-request\r\n", 3, 43},
+	{"sofa", "Content-Type: audio/sofa\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"flw", "Content-Type: application/vnd.kde.kivio\r\n", 3, 41},
+	{"dim", "Content-Type: application/vnd.fastcopy-disk-image\r\n", 3, 51},
+	{"", "", 0, 0},
+	{"otp", "Content-Type: application/vnd.oasis.opendocument.presentation-template\r\n", 3, 72},
+	{"ps", "Content-Type: application/postscript\r\n", 2, 38},
+	{"mpp", "Content-Type: application/vnd.ms-project\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"avcs", "Content-Type: image/avcs\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"me", "Content-Type: application/x-troff-me\r\n", 2, 38},
+	{"", "", 0, 0},
+	{"mxml", "Content-Type: application/xv+xml\r\n", 4, 34},
+	{"dcd", "Content-Type: application/DCD\r\n", 3, 31},
+	{"flx", "Content-Type: text/vnd.fmi.flexstor\r\n", 3, 37},
+	{"sfc", "Content-Type: application/vnd.nintendo.snes.rom\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"at3", "Content-Type: audio/ATRAC3\r\n", 3, 28},
+	{"", "", 0, 0},
+	{"stc", "Content-Type: application/vnd.sun.xml.calc.template\r\n", 3, 53},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"pem", "Content-Type: application/pem-certificate-chain\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"ipfix", "Content-Type: application/ipfix\r\n", 5, 33},
+	{"uvi", "Content-Type: image/vnd.dece.graphic\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"les", "Content-Type: application/vnd.hhe.lesson-player\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"senml-etchj", "Content-Type: application/senml-etch+json\r\n", 11, 43},
+	{"", "", 0, 0},
+	{"provx", "Content-Type: application/provenance+xml\r\n", 5, 42},
+	{"", "", 0, 0},
+	{"efif", "Content-Type: application/vnd.picsel\r\n", 4, 38},
+	{"", "", 0, 0},
+	{"imf", "Content-Type: application/vnd.imagemeter.folder+zip\r\n", 3, 53},
+	{"c4u", "Content-Type: application/vnd.clonk.c4group\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"asice", "Content-Type: application/vnd.etsi.asic-e+zip\r\n", 5, 47},
+	{"twd", "Content-Type: application/vnd.SimTech-MindMapper\r\n", 3, 50},
+	{"xlim", "Content-Type: application/vnd.xmpie.xlim\r\n", 4, 42},
+	{"org", "Content-Type: application/vnd.lotus-organizer\r\n", 3, 47},
+	{"tcap", "Content-Type: application/vnd.3gpp2.tcap\r\n", 4, 42},
+	{"plp", "Content-Type: application/vnd.panoply\r\n", 3, 39},
+	{"nnw", "Content-Type: application/vnd.noblenet-web\r\n", 3, 44},
+	{"dcm", "Content-Type: application/dicom\r\n", 3, 33},
+	{"aal", "Content-Type: audio/ATRAC-ADVANCED-LOSSLESS\r\n", 3, 45},
+	{"wif", "Content-Type: application/watcherinfo+xml\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"kom", "Content-Type: application/vnd.hbci\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"m2v", "Content-Type: video/mpeg\r\n", 3, 26},
+	{"xyze", "Content-Type: image/vnd.radiance\r\n", 4, 34},
+	{"qxl", "Content-Type: application/vnd.Quark.QuarkXPress\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mpkg", "Content-Type: application/vnd.apple.installer+xml\r\n", 4, 51},
+	{"", "", 0, 0},
+	{"yin", "Content-Type: application/yin+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"ssml", "Content-Type: application/ssml+xml\r\n", 4, 36},
+	{"docm", "Content-Type: application/vnd.ms-word.document.macroEnabled.12\r\n", 4, 64},
+	{"viv", "Content-Type: video/vnd.vivo\r\n", 3, 30},
+	{"evw", "Content-Type: audio/EVRCWB\r\n", 3, 28},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"gif", "Content-Type: image/gif\r\n", 3, 25},
+	{"ogx", "Content-Type: application/ogg\r\n", 3, 31},
+	{"m4v", "Content-Type: video/mp4\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"dvi", "Content-Type: application/x-dvi\r\n", 3, 33},
+	{"mpm", "Content-Type: application/vnd.blueice.multipass\r\n", 3, 49},
+	{"log", "Content-Type: text/plain\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"teacher", "Content-Type: application/vnd.smart.teacher\r\n", 7, 45},
+	{"karbon", "Content-Type: application/vnd.kde.karbon\r\n", 6, 42},
+	{"ccc", "Content-Type: text/vnd.net2phone.commcenter.command\r\n", 3, 53},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"jlt", "Content-Type: application/vnd.hp-jlyt\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"css", "Content-Type: text/css\r\n", 3, 24},
+	{"tuc", "Content-Type: application/tamp-update-confirm\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mpw", "Content-Type: application/vnd.exstream-empower+zip\r\n", 3, 52},
+	{"cww", "Content-Type: application/prs.cww\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"vsd", "Content-Type: application/vnd.visio\r\n", 3, 37},
+	{"xhtm", "Content-Type: application/xhtml+xml\r\n", 4, 37},
+	{"", "", 0, 0},
+	{"wk4", "Content-Type: application/vnd.lotus-1-2-3\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"nnd", "Content-Type: application/vnd.noblenet-directory\r\n", 3, 50},
+	{"lwp", "Content-Type: application/vnd.lotus-wordpro\r\n", 3, 45},
+	{"viaframe", "Content-Type: application/vnd.tml\r\n", 8, 35},
+	{"xdw", "Content-Type: application/vnd.fujixerox.docuworks\r\n", 3, 51},
+	{"pnm", "Content-Type: image/x-portable-anymap\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"soa", "Content-Type: text/dns\r\n", 3, 24},
+	{"xlsb", "Content-Type: application/vnd.ms-excel.sheet.binary.macroEnabled.12\r\n", 4, 69},
+	{"", "", 0, 0},
+	{"3dm", "Content-Type: text/vnd.in3d.3dml\r\n", 3, 34},
+	{"rl", "Content-Type: application/resource-lists+xml\r\n", 2, 46},
+	{"dcr", "Content-Type: application/x-director\r\n", 3, 38},
+	{"cryptomator", "Content-Type: application/vnd.cryptomator.vault\r\n", 11, 49},
+	{"", "", 0, 0},
+	{"oga", "Content-Type: audio/ogg\r\n", 3, 25},
+	{"tur", "Content-Type: application/tamp-update\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"xvm", "Content-Type: application/xv+xml\r\n", 3, 34},
+	{"rep", "Content-Type: application/vnd.businessobjects\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"semf", "Content-Type: application/vnd.semf\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"dotx", "Content-Type: application/vnd.openxmlformats-officedocument.wordprocessingml.template\r\n", 4, 87},
+	{"", "", 0, 0},
+	{"yang", "Content-Type: application/yang\r\n", 4, 32},
+	{"gdl", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"s1m", "Content-Type: audio/vnd.sealedmedia.softseal.mpeg\r\n", 3, 51},
+	{"png", "Content-Type: image/png\r\n", 3, 25},
+	{"grxml", "Content-Type: application/srgs+xml\r\n", 5, 36},
+	{"asf", "Content-Type: application/vnd.ms-asf\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"mseq", "Content-Type: application/vnd.mseq\r\n", 4, 36},
+	{"mmdb", "Content-Type: application/vnd.maxmind.maxmind-db\r\n", 4, 50},
+	{"multitrack", "Content-Type: audio/vnd.presonus.multitrack\r\n", 10, 45},
+	{"", "", 0, 0},
+	{"unityweb", "Content-Type: application/vnd.unity\r\n", 8, 37},
+	{"package", "Content-Type: application/vnd.autopackage\r\n", 7, 43},
+	{"acc", "Content-Type: application/vnd.americandynamics.acc\r\n", 3, 52},
+	{"icc", "Content-Type: application/vnd.iccprofile\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"qt", "Content-Type: video/quicktime\r\n", 2, 31},
+	{"uvd", "Content-Type: application/vnd.dece.data\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mlp", "Content-Type: audio/vnd.dolby.mlp\r\n", 3, 35},
+	{"xmt_bin", "Content-Type: model/vnd.parasolid.transmit.binary\r\n", 7, 51},
+	{"clkw", "Content-Type: application/vnd.crick.clicker.wordbank\r\n", 4, 54},
+	{"sti", "Content-Type: application/vnd.sun.xml.impress.template\r\n", 3, 56},
+	{"man", "Content-Type: application/x-troff-man\r\n", 3, 39},
+	{"rct", "Content-Type: application/prs.nprend\r\n", 3, 38},
+	{"ns3", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"bar", "Content-Type: application/vnd.qualcomm.brew-app-res\r\n", 3, 53},
+	{"", "", 0, 0},
+	{"spf", "Content-Type: application/vnd.yamaha.smaf-phrase\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ivp", "Content-Type: application/vnd.immervision-ivp\r\n", 3, 47},
+	{"scsf", "Content-Type: application/vnd.sealed.csf\r\n", 4, 42},
+	{"fm", "Content-Type: application/vnd.framemaker\r\n", 2, 42},
+	{"heifs", "Content-Type: image/heif-sequence\r\n", 5, 35},
+	{"slaz", "Content-Type: application/vnd.scribus\r\n", 4, 39},
+	{"finf", "Content-Type: application/fastinfoset\r\n", 4, 39},
+	{"plc", "Content-Type: application/vnd.Mobius.PLC\r\n", 3, 42},
+	{"x3dv", "Content-Type: model/x3d-vrml\r\n", 4, 30},
+	{"", "", 0, 0},
+	{"scd", "Content-Type: application/vnd.scribus\r\n", 3, 39},
+	{"mxu", "Content-Type: video/vnd.mpegurl\r\n", 3, 33},
+	{"", "", 0, 0},
+	{"lxf", "Content-Type: application/LXF\r\n", 3, 31},
+	{"cuc", "Content-Type: application/tamp-community-update-confirm\r\n", 3, 57},
+	{"anx", "Content-Type: application/x-annodex\r\n", 3, 37},
+	{"xml", "Content-Type: text/xml\r\n", 3, 24},
+	{"", "", 0, 0},
+	{"taglet", "Content-Type: application/vnd.mynfc\r\n", 6, 37},
+	{"notebook", "Content-Type: application/vnd.smart.notebook\r\n", 8, 46},
+	{"qps", "Content-Type: application/vnd.publishare-delta-tree\r\n", 3, 53},
+	{"esf", "Content-Type: application/vnd.epson.esf\r\n", 3, 41},
+	{"jxsi", "Content-Type: image/jxsi\r\n", 4, 26},
+	{"pkipath", "Content-Type: application/pkix-pkipath\r\n", 7, 40},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sls", "Content-Type: application/route-s-tsid+xml\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mpf", "Content-Type: text/vnd.ms-mediapackage\r\n", 3, 40},
+	{"smzip", "Content-Type: application/vnd.stepmania.package\r\n", 5, 49},
+	{"metalink", "Content-Type: application/metalink+xml\r\n", 8, 40},
+	{"", "", 0, 0},
+	{"ttc", "Content-Type: font/collection\r\n", 3, 31},
+	{"mp21", "Content-Type: application/mp21\r\n", 4, 32},
+	{"ktr", "Content-Type: application/vnd.kahootz\r\n", 3, 39},
+	{"espass", "Content-Type: application/vnd.espass-espass+zip\r\n", 6, 49},
+	{"", "", 0, 0},
+	{"trig", "Content-Type: application/trig\r\n", 4, 32},
+	{"xbd", "Content-Type: application/vnd.fujixerox.docuworks.binder\r\n", 3, 58},
+	{"", "", 0, 0},
+	{"pls", "Content-Type: application/pls+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"acn", "Content-Type: audio/asc\r\n", 3, 25},
+	{"kon", "Content-Type: application/vnd.kde.kontour\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"kne", "Content-Type: application/vnd.Kinar\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"c4p", "Content-Type: application/vnd.clonk.c4group\r\n", 3, 45},
+	{"istc", "Content-Type: application/vnd.veryant.thin\r\n", 4, 44},
+	{"", "", 0, 0},
+	{"pcl", "Content-Type: application/vnd.hp-PCL\r\n", 3, 38},
+	{"box", "Content-Type: application/vnd.previewsystems.box\r\n", 3, 50},
+	{"", "", 0, 0},
+	{"pbd", "Content-Type: application/vnd.powerbuilder6\r\n", 3, 45},
+	{"rng", "Content-Type: text/xml\r\n", 3, 24},
+	{"", "", 0, 0},
+	{"sdkm", "Content-Type: application/vnd.solent.sdkm+xml\r\n", 4, 47},
+	{"", "", 0, 0},
+	{"oxps", "Content-Type: application/oxps\r\n", 4, 32},
+	{"fly", "Content-Type: text/vnd.fly\r\n", 3, 28},
+	{"smov", "Content-Type: video/vnd.sealedmedia.softseal.mov\r\n", 4, 50},
+	{"pgp", "Content-Type: application/pgp-encrypted\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"jpe", "Content-Type: image/jpeg\r\n", 3, 26},
+	{"scs", "Content-Type: application/scvp-cv-response\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ma", "Content-Type: application/mathematica\r\n", 2, 39},
+	{"gram", "Content-Type: application/srgs\r\n", 4, 32},
+	{"", "", 0, 0},
+	{"ggs", "Content-Type: application/vnd.geogebra.slides\r\n", 3, 47},
+	{"urim", "Content-Type: application/vnd.uri-map\r\n", 4, 39},
+	{"", "", 0, 0},
+	{"smp3", "Content-Type: audio/vnd.sealedmedia.softseal.mpeg\r\n", 4, 51},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"btf", "Content-Type: image/prs.btif\r\n", 3, 30},
+	{"wmls", "Content-Type: text/vnd.wap.wmlscript\r\n", 4, 38},
+	{"", "", 0, 0},
+	{"mc1", "Content-Type: application/vnd.medcalcdata\r\n", 3, 43},
+	{"nds", "Content-Type: application/vnd.nintendo.nitro.rom\r\n", 3, 50},
+	{"irp", "Content-Type: application/vnd.irepository.package+xml\r\n", 3, 55},
+	{"u8mdn", "Content-Type: message/global-disposition-notification\r\n", 5, 55},
+	{"xlt", "Content-Type: application/vnd.ms-excel\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"ice", "Content-Type: x-conference/x-cooltalk\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"epub", "Content-Type: application/epub+zip\r\n", 4, 36},
+	{"wpl", "Content-Type: application/vnd.ms-wpl\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"nsg", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"oda", "Content-Type: application/ODA\r\n", 3, 31},
+	{"ndc", "Content-Type: application/vnd.osa.netdeploy\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"cdf", "Content-Type: application/x-netcdf\r\n", 3, 36},
+	{"apkg", "Content-Type: application/vnd.anki\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"sgml", "Content-Type: text/SGML\r\n", 4, 25},
+	{"p8", "Content-Type: application/pkcs8\r\n", 2, 33},
+	{"osf", "Content-Type: application/vnd.yamaha.openscoreformat\r\n", 3, 54},
+	{"rdz", "Content-Type: application/vnd.data-vision.rdz\r\n", 3, 47},
+	{"oxlicg", "Content-Type: application/vnd.oxli.countgraph\r\n", 6, 47},
+	{"", "", 0, 0},
+	{"kia", "Content-Type: application/vnd.kidspiration\r\n", 3, 44},
+	{"", "", 0, 0},
+	{"vtf", "Content-Type: image/vnd.valve.source.texture\r\n", 3, 46},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"fsc", "Content-Type: application/vnd.fsc.weblaunch\r\n", 3, 45},
+	{"acu", "Content-Type: application/vnd.acucobol\r\n", 3, 40},
+	{"udeb", "Content-Type: application/vnd.debian.binary-package\r\n", 4, 53},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"fcdt", "Content-Type: application/vnd.adobe.formscentral.fcdt\r\n", 4, 55},
+	{"rst", "Content-Type: text/prs.fallenstein.rst\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"stm", "Content-Type: audio/x-stm\r\n", 3, 27},
+	{"ns2", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"ggt", "Content-Type: application/vnd.geogebra.tool\r\n", 3, 45},
+	{"iif", "Content-Type: application/vnd.shana.informed.interchange\r\n", 3, 58},
+	{"uvvh", "Content-Type: video/vnd.dece.hd\r\n", 4, 33},
+	{"sse", "Content-Type: application/vnd.kodak-descriptor\r\n", 3, 48},
+	{"", "", 0, 0},
+	{"webp", "Content-Type: image/webp\r\n", 4, 26},
+	{"xlsx", "Content-Type: application/vnd.openxmlformats-officedocument.spreadsheetml.sheet\r\n", 4, 81},
+	{"jpg", "Content-Type: image/jpeg\r\n", 3, 26},
+	{"es3", "Content-Type: application/vnd.eszigno3+xml\r\n", 3, 44},
+	{"bh2", "Content-Type: application/vnd.fujitsu.oasysprs\r\n", 3, 48},
+	{"ica", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"", "", 0, 0},
+	{"sensmlc", "Content-Type: application/sensml+cbor\r\n", 7, 39},
+	{"enw", "Content-Type: audio/EVRCNW\r\n", 3, 28},
+	{"spdx", "Content-Type: text/spdx\r\n", 4, 25},
+	{"artisan", "Content-Type: application/vnd.artisan+json\r\n", 7, 44},
+	{"rlc", "Content-Type: image/vnd.fujixerox.edmics-rlc\r\n", 3, 46},
+	{"ors", "Content-Type: application/ocsp-response\r\n", 3, 41},
+	{"tatp", "Content-Type: application/vnd.onepagertatp\r\n", 4, 44},
+	{"pod", "Content-Type: text/x-pod\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"vss", "Content-Type: application/vnd.visio\r\n", 3, 37},
+	{"uvvz", "Content-Type: application/vnd.dece.zip\r\n", 4, 40},
+	{"", "", 0, 0},
+	{"dxr", "Content-Type: application/x-director\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"tra", "Content-Type: application/vnd.trueapp\r\n", 3, 39},
+	{"acutc", "Content-Type: application/vnd.acucorp\r\n", 5, 39},
+	{"tsr", "Content-Type: application/timestamp-reply\r\n", 3, 43},
+	{"csh", "Content-Type: application/x-csh\r\n", 3, 33},
+	{"clkt", "Content-Type: application/vnd.crick.clicker.template\r\n", 4, 54},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"tr", "Content-Type: text/troff\r\n", 2, 26},
+	{"ism", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"p7m", "Content-Type: application/pkcs7-mime\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"mdi", "Content-Type: image/vnd.ms-modi\r\n", 3, 33},
+	{"ic7", "Content-Type: application/vnd.commerce-battelle\r\n", 3, 49},
+	{"xltx", "Content-Type: application/vnd.openxmlformats-officedocument.spreadsheetml.template\r\n", 4, 84},
+	{"i2g", "Content-Type: application/vnd.intergeo\r\n", 3, 40},
+	{"chm", "Content-Type: application/vnd.ms-htmlhelp\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"jxss", "Content-Type: image/jxss\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"pdb", "Content-Type: application/vnd.palm\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"xls", "Content-Type: application/vnd.ms-excel\r\n", 3, 40},
+	{"sid", "Content-Type: audio/prs.sid\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"lmp", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"cil", "Content-Type: application/vnd.ms-artgalry\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"stw", "Content-Type: application/vnd.sun.xml.writer.template\r\n", 3, 55},
+	{"", "", 0, 0},
+	{"wtb", "Content-Type: application/vnd.webturbo\r\n", 3, 40},
+	{"cxx", "Content-Type: text/plain\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"dpgraph", "Content-Type: application/vnd.dpgraph\r\n", 7, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"siv", "Content-Type: application/sieve\r\n", 3, 33},
+	{"cpkg", "Content-Type: application/vnd.xmpie.cpkg\r\n", 4, 42},
+	{"ktz", "Content-Type: application/vnd.kahootz\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"o4a", "Content-Type: application/vnd.oma.drm.dcf\r\n", 3, 43},
+	{"ecigtheme", "Content-Type: application/vnd.evolv.ecig.theme\r\n", 9, 48},
+	{"oti", "Content-Type: application/vnd.oasis.opendocument.image-template\r\n", 3, 65},
+	{"rnc", "Content-Type: application/relax-ng-compact-syntax\r\n", 3, 51},
+	{"latex", "Content-Type: application/x-latex\r\n", 5, 35},
+	{"eol", "Content-Type: audio/vnd.digital-winds\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"cmc", "Content-Type: application/vnd.cosmocaller\r\n", 3, 43},
+	{"sxl", "Content-Type: application/vnd.sealed.xls\r\n", 3, 42},
+	{"eot", "Content-Type: application/vnd.ms-fontobject\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"zfo", "Content-Type: application/vnd.software602.filler.form-xml-zip\r\n", 3, 63},
+	{"fti", "Content-Type: application/vnd.anser-web-funds-transfer-initiation\r\n", 3, 67},
+	{"lca", "Content-Type: application/vnd.logipipe.circuit+zip\r\n", 3, 52},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"skp", "Content-Type: application/vnd.koan\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"sdoc", "Content-Type: application/vnd.sealed.doc\r\n", 4, 42},
+	{"uvvm", "Content-Type: video/vnd.dece.mobile\r\n", 4, 37},
+	{"m21", "Content-Type: application/mp21\r\n", 3, 32},
+	{"smh", "Content-Type: application/vnd.sealed.mht\r\n", 3, 42},
+	{"ra", "Content-Type: audio/x-realaudio\r\n", 2, 33},
+	{"", "", 0, 0},
+	{"rapd", "Content-Type: application/route-apd+xml\r\n", 4, 41},
+	{"gz", "Content-Type: application/gzip\r\n", 2, 32},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"tag", "Content-Type: text/prs.lines.tag\r\n", 3, 34},
+	{"tpl", "Content-Type: application/vnd.groove-tool-template\r\n", 3, 52},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"jxra", "Content-Type: image/jxrA\r\n", 4, 26},
+	{"sgif", "Content-Type: image/vnd.sealedmedia.softseal.gif\r\n", 4, 50},
+	{"ami", "Content-Type: application/vnd.amiga.ami\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"fg5", "Content-Type: application/vnd.fujitsu.oasysgp\r\n", 3, 47},
+	{"", "", 0, 0},
+	{"oxt", "Content-Type: application/vnd.openofficeorg.extension\r\n", 3, 55},
+	{"", "", 0, 0},
+	{"td", "Content-Type: application/urc-targetdesc+xml\r\n", 2, 46},
+	{"dd", "Content-Type: application/vnd.oma.dd+xml\r\n", 2, 42},
+	{"mjp2", "Content-Type: video/mj2\r\n", 4, 25},
+	{"dwg", "Content-Type: image/vnd.dwg\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"ngdat", "Content-Type: application/vnd.nokia.n-gage.data\r\n", 5, 49},
+	{"pot", "Content-Type: application/vnd.ms-powerpoint\r\n", 3, 45},
+	{"rsm", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"wmx", "Content-Type: video/x-ms-wmx\r\n", 3, 30},
+	{"", "", 0, 0},
+	{"dll", "Content-Type: application/octet-stream\r\n", 3, 40},
+	{"sdo", "Content-Type: application/vnd.sealed.doc\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"bcpio", "Content-Type: application/x-bcpio\r\n", 5, 35},
+	{"p10", "Content-Type: application/pkcs10\r\n", 3, 34},
+	{"exe", "Content-Type: application/octet-stream\r\n", 3, 40},
+	{"wsc", "Content-Type: application/vnd.wfa.wsc\r\n", 3, 39},
+	{"art", "Content-Type: message/rfc822\r\n", 3, 30},
+	{"spot", "Content-Type: text/vnd.in3d.spot\r\n", 4, 34},
+	{"1km", "Content-Type: application/vnd.1000minds.decision-model+xml\r\n", 3, 60},
+	{"exr", "Content-Type: image/aces\r\n", 3, 26},
+	{"nns", "Content-Type: application/vnd.noblenet-sealer\r\n", 3, 47},
+	{"drle", "Content-Type: image/dicom-rle\r\n", 4, 31},
+	{"rq", "Content-Type: application/sparql-query\r\n", 2, 40},
+	{"pl", "Content-Type: application/x-perl\r\n", 2, 34},
+	{"", "", 0, 0},
+	{"dvb", "Content-Type: video/vnd.dvb.file\r\n", 3, 34},
+	{"gtm", "Content-Type: application/vnd.groove-tool-message\r\n", 3, 51},
+	{"n-gage", "Content-Type: application/vnd.nokia.n-gage.symbian.install\r\n", 6, 60},
+	{"atxml", "Content-Type: application/ATXML\r\n", 5, 33},
+	{"mbk", "Content-Type: application/vnd.Mobius.MBK\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"ves", "Content-Type: application/vnd.ves.encrypted\r\n", 3, 45},
+	{"entity", "Content-Type: application/vnd.nervana\r\n", 6, 39},
+	{"paw", "Content-Type: application/vnd.pawaafile\r\n", 3, 41},
+	{"miz", "Content-Type: text/mizar\r\n", 3, 26},
+	{"b16", "Content-Type: image/vnd.pco.b16\r\n", 3, 33},
+	{"awb", "Content-Type: audio/AMR-WB\r\n", 3, 28},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"nebul", "Content-Type: application/vnd.nebumind.line\r\n", 5, 45},
+	{"", "", 0, 0},
+	{"flv", "Content-Type: video/x-flv\r\n", 3, 27},
+	{"xyz", "Content-Type: chemical/x-xyz\r\n", 3, 30},
+	{"", "", 0, 0},
+	{"ram", "Content-Type: audio/x-pn-realaudio\r\n", 3, 36},
+	{"markdown", "Content-Type: text/markdown\r\n", 8, 29},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"dbf", "Content-Type: application/vnd.dbf\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"pfr", "Content-Type: application/font-tdpfr\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"uo", "Content-Type: application/vnd.uoml+xml\r\n", 2, 40},
+	{"skm", "Content-Type: application/vnd.koan\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"odd", "Content-Type: application/tei+xml\r\n", 3, 35},
+	{"semd", "Content-Type: application/vnd.semd\r\n", 4, 36},
+	{"xif", "Content-Type: image/vnd.xiff\r\n", 3, 30},
+	{"", "", 0, 0},
+	{"btif", "Content-Type: image/prs.btif\r\n", 4, 30},
+	{"", "", 0, 0},
+	{"jph", "Content-Type: image/jph\r\n", 3, 25},
+	{"pbm", "Content-Type: image/x-portable-bitmap\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mmr", "Content-Type: image/vnd.fujixerox.edmics-mmr\r\n", 3, 46},
+	{"", "", 0, 0},
+	{"dsm", "Content-Type: application/vnd.desmume.movie\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"ecigprofile", "Content-Type: application/vnd.evolv.ecig.profile\r\n", 11, 50},
+	{"atfx", "Content-Type: application/ATFX\r\n", 4, 32},
+	{"uvs", "Content-Type: video/vnd.dece.sd\r\n", 3, 33},
+	{"cc", "Content-Type: text/plain\r\n", 2, 26},
+	{"clkx", "Content-Type: application/vnd.crick.clicker\r\n", 4, 45},
+	{"pdf", "Content-Type: application/pdf\r\n", 3, 31},
+	{"", "", 0, 0},
+	{"hps", "Content-Type: application/vnd.hp-hps\r\n", 3, 38},
+	{"uris", "Content-Type: text/uri-list\r\n", 4, 29},
+	{"cbr", "Content-Type: application/vnd.comicbook-rar\r\n", 3, 45},
+	{"gac", "Content-Type: application/vnd.groove-account\r\n", 3, 46},
+	{"frm", "Content-Type: application/vnd.ufdl\r\n", 3, 36},
+	{"eps", "Content-Type: application/postscript\r\n", 3, 38},
+	{"ksp", "Content-Type: application/vnd.kde.kspread\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"dot", "Content-Type: text/vnd.graphviz\r\n", 3, 33},
+	{"", "", 0, 0},
+	{"ftc", "Content-Type: application/vnd.fluxtime.clip\r\n", 3, 45},
+	{"msm", "Content-Type: model/vnd.gdl\r\n", 3, 29},
+	{"2", "Content-Type: application/x-troff-man\r\n", 1, 39},
+	{"mgp", "Content-Type: application/vnd.osgeo.mapguide.package\r\n", 3, 54},
+	{"", "", 0, 0},
+	{"o4v", "Content-Type: application/vnd.oma.drm.dcf\r\n", 3, 43},
+	{"", "", 0, 0},
+	{"xspf", "Content-Type: application/x-xspf+xml\r\n", 4, 38},
+	{"tamx", "Content-Type: application/vnd.onepagertamx\r\n", 4, 44},
+	{"", "", 0, 0},
+	{"stk", "Content-Type: application/hyperstudio\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"pml", "Content-Type: application/vnd.ctc-posml\r\n", 3, 41},
+	{"vbox", "Content-Type: application/vnd.previewsystems.box\r\n", 4, 50},
+	{"wv", "Content-Type: application/vnd.wv.csp+wbxml\r\n", 2, 44},
+	{"scld", "Content-Type: application/vnd.doremir.scorecloud-binary-document\r\n", 4, 66},
+	{"", "", 0, 0},
+	{"uri", "Content-Type: text/uri-list\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"gim", "Content-Type: application/vnd.groove-identity-message\r\n", 3, 55},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"src", "Content-Type: application/x-wais-source\r\n", 3, 41},
+	{"", "", 0, 0},
+	{"ssv", "Content-Type: application/vnd.shade-save-file\r\n", 3, 47},
+	{"glbin", "Content-Type: application/gltf-buffer\r\n", 5, 39},
+	{"lbd", "Content-Type: application/vnd.llamagraphics.life-balance.desktop\r\n", 3, 66},
+	{"kmz", "Content-Type: application/vnd.google-earth.kmz\r\n", 3, 48},
+	{"c4d", "Content-Type: application/vnd.clonk.c4group\r\n", 3, 45},
+	{"m4a", "Content-Type: audio/mp4\r\n", 3, 25},
+	{"wmlc", "Content-Type: application/vnd.wap.wmlc\r\n", 4, 40},
+	{"", "", 0, 0},
+	{"qam", "Content-Type: application/vnd.epson.quickanime\r\n", 3, 48},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"prc", "Content-Type: application/vnd.palm\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"pptx", "Content-Type: application/vnd.openxmlformats-officedocument.presentationml.presentation\r\n", 4, 89},
+	{"hdf", "Content-Type: application/x-hdf\r\n", 3, 33},
+	{"m1v", "Content-Type: video/mpeg\r\n", 3, 26},
+	{"geo", "Content-Type: application/vnd.dynageo\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"senmlc", "Content-Type: application/senml+cbor\r\n", 6, 38},
+	{"spn", "Content-Type: image/vnd.sealed.png\r\n", 3, 36},
+	{"asc", "Content-Type: text/plain\r\n", 3, 26},
+	{"eml", "Content-Type: message/rfc822\r\n", 3, 30},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"fts", "Content-Type: image/fits\r\n", 3, 26},
+	{"", "", 0, 0},
+	{"sldx", "Content-Type: application/vnd.openxmlformats-officedocument.presentationml.slide\r\n", 4, 82},
+	{"dtd", "Content-Type: application/xml-dtd\r\n", 3, 35},
+	{"cl", "Content-Type: application/simple-filter+xml\r\n", 2, 45},
+	{"", "", 0, 0},
+	{"mxi", "Content-Type: application/vnd.vd-study\r\n", 3, 40},
+	{"cql", "Content-Type: text/cql\r\n", 3, 24},
+	{"mhas", "Content-Type: audio/mhas\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"m", "Content-Type: application/vnd.wolfram.mathematica.package\r\n", 1, 59},
+	{"glb", "Content-Type: model/gltf-binary\r\n", 3, 33},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"cbz", "Content-Type: application/vnd.comicbook+zip\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"skt", "Content-Type: application/vnd.koan\r\n", 3, 36},
+	{"ext", "Content-Type: application/vnd.novadigm.EXT\r\n", 3, 44},
+	{"uvg", "Content-Type: image/vnd.dece.graphic\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"bz2", "Content-Type: application/x-bzip2\r\n", 3, 35},
+	{"u8hdr", "Content-Type: message/global-headers\r\n", 5, 38},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"dpg", "Content-Type: application/vnd.dpgraph\r\n", 3, 39},
+	{"mrcx", "Content-Type: application/marcxml+xml\r\n", 4, 39},
+	{"sxg", "Content-Type: application/vnd.sun.xml.writer.global\r\n", 3, 53},
+	{"txf", "Content-Type: application/vnd.Mobius.TXF\r\n", 3, 42},
+	{"kil", "Content-Type: application/x-killustrator\r\n", 3, 42},
+	{"", "", 0, 0},
+	{"sdf", "Content-Type: application/vnd.Kinar\r\n", 3, 37},
+	{"nt", "Content-Type: application/n-triples\r\n", 2, 37},
+	{"", "", 0, 0},
+	{"shaclc", "Content-Type: text/shaclc\r\n", 6, 27},
+	{"lgr", "Content-Type: application/lgr+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"maei", "Content-Type: application/mmt-aei+xml\r\n", 4, 39},
+	{"rfcxml", "Content-Type: application/rfc+xml\r\n", 6, 35},
+	{"wcm", "Content-Type: application/vnd.ms-works\r\n", 3, 40},
+	{"", "", 0, 0},
+	{"bmml", "Content-Type: application/vnd.balsamiq.bmml+xml\r\n", 4, 49},
+	{"", "", 0, 0},
+	{"emotionml", "Content-Type: application/emotionml+xml\r\n", 9, 41},
+	{"", "", 0, 0},
+	{"soc", "Content-Type: application/sgml-open-catalog\r\n", 3, 45},
+	{"provn", "Content-Type: text/provenance-notation\r\n", 5, 40},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mod", "Content-Type: audio/x-mod\r\n", 3, 27},
+	{"fvt", "Content-Type: video/vnd.fvt\r\n", 3, 29},
+	{"ppkg", "Content-Type: application/vnd.xmpie.ppkg\r\n", 4, 42},
+	{"", "", 0, 0},
+	{"model-inter", "Content-Type: application/vnd.vd-study\r\n", 11, 40},
+	{"u8msg", "Content-Type: message/global\r\n", 5, 30},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"nsf", "Content-Type: application/vnd.lotus-notes\r\n", 3, 43},
+	{"kwd", "Content-Type: application/vnd.kde.kword\r\n", 3, 41},
+	{"loas", "Content-Type: audio/usac\r\n", 4, 26},
+	{"", "", 0, 0},
+	{"fxpl", "Content-Type: application/vnd.adobe.fxp\r\n", 4, 41},
+	{"ttml", "Content-Type: application/ttml+xml\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"pkg", "Content-Type: application/vnd.apple.installer+xml\r\n", 3, 51},
+	{"emf", "Content-Type: image/emf\r\n", 3, 25},
+	{"lrm", "Content-Type: application/vnd.ms-lrm\r\n", 3, 38},
+	{"", "", 0, 0},
+	{"wps", "Content-Type: application/vnd.ms-works\r\n", 3, 40},
+	{"emm", "Content-Type: application/vnd.ibm.electronic-media\r\n", 3, 52},
+	{"psfs", "Content-Type: application/vnd.psfs\r\n", 4, 36},
+	{"sos", "Content-Type: text/vnd.sosi\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"tgz", "Content-Type: application/gzip\r\n", 3, 32},
+	{"mesh", "Content-Type: model/mesh\r\n", 4, 26},
+	{"manifest", "Content-Type: text/cache-manifest\r\n", 8, 35},
+	{"", "", 0, 0},
+	{"azf", "Content-Type: application/vnd.airzip.filesecure.azf\r\n", 3, 53},
+	{"str", "Content-Type: application/vnd.pg.format\r\n", 3, 41},
+	{"seed", "Content-Type: application/vnd.fdsn.seed\r\n", 4, 41},
+	{"aac", "Content-Type: audio/aac\r\n", 3, 25},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"xar", "Content-Type: application/vnd.xara\r\n", 3, 36},
+	{"", "", 0, 0},
+	{"csvs", "Content-Type: text/csv-schema\r\n", 4, 31},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"p7s", "Content-Type: application/pkcs7-signature\r\n", 3, 43},
+	{"mp4", "Content-Type: video/mp4\r\n", 3, 25},
+	{"xul", "Content-Type: application/vnd.mozilla.xul+xml\r\n", 3, 47},
+	{"cdmio", "Content-Type: application/cdmi-object\r\n", 5, 39},
+	{"x_b", "Content-Type: model/vnd.parasolid.transmit.binary\r\n", 3, 51},
+	{"g³", "Content-Type: application/vnd.geocube+xml\r\n", 3, 43},
+	{"pps", "Content-Type: application/vnd.ms-powerpoint\r\n", 3, 45},
+	{"", "", 0, 0},
+	{"heics", "Content-Type: image/heic-sequence\r\n", 5, 35},
+	{"kpr", "Content-Type: application/vnd.kde.kpresenter\r\n", 3, 46},
+	{"ktx", "Content-Type: image/ktx\r\n", 3, 25},
+	{"tap", "Content-Type: image/vnd.tencent.tap\r\n", 3, 37},
+	{"sic", "Content-Type: application/vnd.wap.sic\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"s1n", "Content-Type: image/vnd.sealed.png\r\n", 3, 36},
+	{"ai", "Content-Type: application/postscript\r\n", 2, 38},
+	{"", "", 0, 0},
+	{"wspolicy", "Content-Type: application/wspolicy+xml\r\n", 8, 40},
+	{"wrl", "Content-Type: model/vrml\r\n", 3, 26},
+	{"pgn", "Content-Type: application/vnd.chess-pgn\r\n", 3, 41},
+	{"igx", "Content-Type: application/vnd.micrografx.igx\r\n", 3, 46},
+	{"mmd", "Content-Type: application/vnd.chipnuts.karaoke-mmd\r\n", 3, 52},
+	{"fdt", "Content-Type: application/fdt+xml\r\n", 3, 35},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"mpn", "Content-Type: application/vnd.mophun.application\r\n", 3, 50},
+	{"dcf", "Content-Type: application/vnd.oma.drm.content\r\n", 3, 47},
+	{"dts", "Content-Type: audio/vnd.dts\r\n", 3, 29},
+	{"", "", 0, 0},
+	{"zone", "Content-Type: text/dns\r\n", 4, 24},
+	{"", "", 0, 0},
+	{"", "", 0, 0},
+	{"xots", "Content-Type: application/vnd.collabio.xodocuments.spreadsheet-template\r\n", 4, 73},
+	{"oa3", "Content-Type: application/vnd.fujitsu.oasys3\r\n", 3, 46},
+	{"smpg", "Content-Type: video/vnd.sealed.mpeg1\r\n", 4, 38},
+	{"", "", 0, 0},
+	{"tga", "Content-Type: image/x-targa\r\n", 3, 29},
+	{"roff", "Content-Type: text/troff\r\n", 4, 26},
+	{"ddf", "Content-Type: application/vnd.syncml.dmddf+xml\r\n", 3, 48},
+	{"", "", 0, 0},
+	{"curl", "Content-Type: application/vnd.curl\r\n", 4, 36},
+	{"", "", 0, 0},
+	{"las", "Content-Type: application/vnd.las\r\n", 3, 35},
+	{"zirz", "Content-Type: application/vnd.zul\r\n", 4, 35},
+	{"", "", 0, 0},
+	{"p2p", "Content-Type: application/vnd.wfa.p2p\r\n", 3, 39},
+	{"", "", 0, 0},
+	{"s1p", "Content-Type: application/vnd.sealed.ppt\r\n", 3, 42},
+	{"dae", "Content-Type: model/vnd.collada+xml\r\n", 3, 37},
+	{"", "", 0, 0},
+	{"sensmlx", "Content-Type: application/sensml+xml\r\n", 7, 38},
+	{"n3", "Content-Type: text/n3\r\n", 2, 23},
+	{"", "", 0, 0},
+	{"lpf", "Content-Type: application/lpf+zip\r\n", 3, 35},
+	{"ign", "Content-Type: application/vnd.coreos.ignition+json\r\n", 3, 52},
+	{"msf", "Content-Type: application/vnd.epson.msf\r\n", 3, 41},
+	{"osm", "Content-Type: application/vnd.openstreetmap.data+xml\r\n", 3, 54},
+	{"azw3", "Content-Type: application/vnd.amazon.mobi8-ebook\r\n", 4, 50},
 };
@@ -0,0 +1,220 @@
+#include "open-file-cache.h"
+#include "content-cache.h"
+#include "hash.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Starting size of the hash table, doubled whenever it gets full
+#define OPEN_FILE_CACHE_INITIAL_BUCKETS 256
+
+OpenFileCache *open_file_cache_create(unsigned const maximumOpen, time_t const checkInterval)
+{
+	OpenFileCache *const cache = calloc(1, sizeof(OpenFileCache));
+	if (cache == NULL) {
+		perror("open_file_cache_create(): Failed to allocate cache");
+		return NULL;
+	}
+	cache->buckets = calloc(OPEN_FILE_CACHE_INITIAL_BUCKETS, sizeof(OpenFile *));
+	if (cache->buckets == NULL) {
+		perror("open_file_cache_create(): Failed to allocate buckets");
+		free(cache);
+		return NULL;
+	}
+	cache->bucketCount = OPEN_FILE_CACHE_INITIAL_BUCKETS;
+	cache->maximumOpen = maximumOpen;
+	cache->checkInterval = checkInterval;
+	return cache;
+}
+
+void free_open_file(OpenFile *const file)
+{
+	close(file->fd);
+	free(file->path);
+	free(file);
+}
+
+void unlink_open_file_recency(OpenFileCache *const cache, OpenFile *const file)
+{
+	if (file->newer != NULL)
+		file->newer->older = file->older;
+	else
+		cache->newest = file->older;
+	if (file->older != NULL)
+		file->older->newer = file->newer;
+	else
+		cache->oldest = file->newer;
+	file->newer = file->older = NULL;
+}
+
+void mark_open_file_newest(OpenFileCache *const cache, OpenFile *const file)
+{
+	file->older = cache->newest;
+	file->newer = NULL;
+	if (cache->newest != NULL)
+		cache->newest->newer = file;
+	cache->newest = file;
+	if (cache->oldest == NULL)
+		cache->oldest = file;
+}
+
+// Takes an entry out of the cache. The descriptor stays open until the
+// last response using it lets go.
+void remove_open_file(OpenFileCache *const cache, OpenFile *const file)
+{
+	OpenFile **link = &cache->buckets[hash_path(file->path) & (cache->bucketCount - 1)];
+	while (*link != file)
+		link = &(*link)->nextInBucket;
+	*link = file->nextInBucket;
+
+	unlink_open_file_recency(cache, file);
+	cache->entryCount--;
+	file->stale = true;
+	if (file->references == 0)
+		free_open_file(file);
+}
+
+void open_file_cache_destroy(OpenFileCache *const cache)
+{
+	while (cache->newest != NULL)
+		remove_open_file(cache, cache->newest);
+	free(cache->buckets);
+	free(cache);
+}
+
+void grow_open_file_buckets(OpenFileCache *const cache)
+{
+	size_t const newCount = cache->bucketCount * 2;
+	OpenFile **const buckets = calloc(newCount, sizeof(OpenFile *));
+	// Long chains are slower but still correct, so just carry on
+	if (buckets == NULL)
+		return;
+
+	for (size_t i = 0; i < cache->bucketCount; i++) {
+		OpenFile *file = cache->buckets[i];
+		while (file != NULL) {
+			OpenFile *const next = file->nextInBucket;
+			size_t const bucket = hash_path(file->path) & (newCount - 1);
+			file->nextInBucket = buckets[bucket];
+			buckets[bucket] = file;
+			file = next;
+		}
+	}
+	free(cache->buckets);
+	cache->buckets = buckets;
+	cache->bucketCount = newCount;
+}
+
+// Closes least recently used files nobody is sending until there is room
+// for one more. Returns false if that is not possible.
+bool make_open_file_room(OpenFileCache *const cache)
+{
+	OpenFile *file = cache->oldest;
+	while (cache->entryCount >= cache->maximumOpen && file != NULL) {
+		OpenFile *const newer = file->newer;
+		if (file->references == 0)
+			remove_open_file(cache, file);
+		file = newer;
+	}
+	return cache->entryCount < cache->maximumOpen;
+}
+
+bool same_file(struct stat const *const a, struct stat const *const b)
+{
+	return a->st_dev == b->st_dev && a->st_ino == b->st_ino && a->st_size == b->st_size
+		&& a->st_mtim.tv_sec == b->st_mtim.tv_sec
+		&& a->st_mtim.tv_nsec == b->st_mtim.tv_nsec;
+}
+
+OpenFile *open_file(char const *const path)
+{
+	// Without O_NONBLOCK opening a FIFO would wait for a writer
+	int const fd = open(path, O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+	if (fd == -1)
+		return NULL;
+
+	OpenFile *const file = calloc(1, sizeof(OpenFile));
+	char *const pathCopy = strdup(path);
+	if (file == NULL || pathCopy == NULL) {
+		perror("open_file(): Failed to allocate entry");
+		free(file);
+		free(pathCopy);
+		close(fd);
+		errno = ENOMEM;
+		return NULL;
+	}
+	if (fstat(fd, &file->st) == -1) {
+		int const error = errno;
+		free(file);
+		free(pathCopy);
+		close(fd);
+		errno = error;
+		return NULL;
+	}
+	file->path = pathCopy;
+	file->fd = fd;
+	file->lastChecked = current_second();
+	return file;
+}
+
+OpenFile *open_file_cache_acquire(OpenFileCache *const cache, char const *const path)
+{
+	size_t const hash = hash_path(path);
+	OpenFile *file = cache->buckets[hash & (cache->bucketCount - 1)];
+	while (file != NULL && strcmp(file->path, path) != 0)
+		file = file->nextInBucket;
+
+	if (file != NULL) {
+		time_t const now = current_second();
+		bool current = now - file->lastChecked < cache->checkInterval;
+		if (!current) {
+			struct stat st;
+			current = stat(path, &st) == 0 && same_file(&file->st, &st);
+			if (current)
+				file->lastChecked = now;
+		}
+		if (current) {
+			unlink_open_file_recency(cache, file);
+			mark_open_file_newest(cache, file);
+			file->references++;
+			return file;
+		}
+		// The file was replaced, modified or removed, the open below
+		// finds out which
+		remove_open_file(cache, file);
+	}
+
+	file = open_file(path);
+	if (file == NULL)
+		return NULL;
+	file->references = 1;
+
+	// Directories and the like only get turned away, there is no point
+	// holding on to their descriptors. Sent once and closed again, like it
+	// would be without the cache, when there is no room.
+	if (!S_ISREG(file->st.st_mode) || !make_open_file_room(cache)) {
+		file->stale = true;
+		return file;
+	}
+	if (cache->entryCount >= cache->bucketCount)
+		grow_open_file_buckets(cache);
+	size_t const bucket = hash & (cache->bucketCount - 1);
+	file->nextInBucket = cache->buckets[bucket];
+	cache->buckets[bucket] = file;
+	mark_open_file_newest(cache, file);
+	cache->entryCount++;
+	return file;
+}
+
+void open_file_cache_release(OpenFileCache *const cache, OpenFile *const file)
+{
+	(void) cache;
+	file->references--;
+	if (file->references == 0 && file->stale)
+		free_open_file(file);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+
+// A file kept open along with what it looked like when it was last checked
+typedef struct OpenFile {
+	char *path;
+	int fd;
+	struct stat st;
+	time_t lastChecked;
+
+	// Responses currently sending from fd. It is only closed once this
+	// drops to zero, even if the entry was evicted in the meantime.
+	unsigned references;
+	// Set once the entry has left the cache
+	bool stale;
+
+	struct OpenFile *nextInBucket;
+	struct OpenFile *newer;
+	struct OpenFile *older;
+} OpenFile;
+
+// Descriptors and stat() results of recently requested files by path, so
+// answering for a hot file takes no path lookups at all. Entries are
+// trusted for checkInterval seconds, then compared against a fresh stat()
+// and reopened if the file changed. At most maximumOpen descriptors are
+// kept, least recently used ones are closed first. Belongs to a single
+// worker and is not thread safe.
+typedef struct {
+	OpenFile **buckets;
+	size_t bucketCount;
+	size_t entryCount;
+
+	unsigned maximumOpen;
+	time_t checkInterval;
+
+	OpenFile *newest;
+	OpenFile *oldest;
+} OpenFileCache;
+
+OpenFileCache *open_file_cache_create(unsigned const maximumOpen, time_t const checkInterval);
+void open_file_cache_destroy(OpenFileCache *const cache);
+
+// Returns a referenced entry with the file at path open, or NULL with
+// errno set if it can't be opened. A file that is not cached gets opened
+// and then fstat()ed, which looks the path up once instead of twice. It is
+// also returned when the cache is full of files in use or is not a
+// regular file, just without being kept.
+OpenFile *open_file_cache_acquire(OpenFileCache *const cache, char const *const path);
+
+void open_file_cache_release(OpenFileCache *const cache, OpenFile *const file);
@@ -0,0 +1,164 @@
+#include "request-parser.h"
+#include "byte-scan.h"
+
+#include <string.h>
+#include <strings.h>
+
+void request_parser_reset(RequestParser *const parser)
+{
+	parser->stage = PARSER_REQUEST_LINE;
+	parser->position = 0;
+	parser->lineStart = 0;
+	parser->headerCount = 0;
+	parser->end = 0;
+	parser->error = 0;
+}
+
+TextView make_view(size_t const offset, size_t const length)
+{
+	TextView const view = { .offset = (uint16_t) offset, .length = (uint16_t) length };
+	return view;
+}
+
+ParseStatus parser_fail(RequestParser *const parser, unsigned short const status)
+{
+	parser->stage = PARSER_FAILED;
+	parser->error = status;
+	return REQUEST_INVALID;
+}
+
+// method SP request-target SP HTTP/1.x, without the line ending. Returns 0
+// or the status to fail with.
+unsigned short parse_request_line(RequestParser *const parser, char const *const buffer,
+		size_t const start, size_t const end)
+{
+	size_t i = start + scan_token(buffer + start, end - start);
+	if (i == start || i == end || buffer[i] != ' ')
+		return 400;
+	parser->method = make_view(start, i - start);
+
+	size_t const targetStart = ++i;
+	i += scan_visible(buffer + i, end - i);
+	if (i == targetStart || i == end || buffer[i] != ' ')
+		return 400;
+	parser->target = make_view(targetStart, i - targetStart);
+
+	size_t const versionStart = ++i;
+	size_t const versionLength = end - versionStart;
+	if (versionLength < 8 || strncmp(buffer + versionStart, "HTTP/", 5) != 0)
+		return 400;
+	if (versionLength != 8 || buffer[versionStart + 5] != '1' || buffer[versionStart + 6] != '.'
+			|| buffer[versionStart + 7] < '0' || buffer[versionStart + 7] > '9')
+		return 505;
+	parser->version = make_view(versionStart, versionLength);
+	return 0;
+}
+
+// name ":" OWS value OWS, without the line ending. Returns 0 or the status
+// to fail with.
+unsigned short parse_header_line(RequestParser *const parser, char const *const buffer,
+		size_t const start, size_t end)
+{
+	if (parser->headerCount == MAXIMUM_HEADER_COUNT)
+		return 431;
+
+	// Whitespace before the colon and folded lines are both forbidden,
+	// they are how requests get smuggled past proxies.
+	size_t i = start + scan_token(buffer + start, end - start);
+	if (i == start || i == end || buffer[i] != ':')
+		return 400;
+	HeaderView *const header = &parser->headers[parser->headerCount];
+	header->name = make_view(start, i - start);
+
+	i++;
+	while (i < end && (buffer[i] == ' ' || buffer[i] == '\t'))
+		i++;
+	while (end > i && (buffer[end - 1] == ' ' || buffer[end - 1] == '\t'))
+		end--;
+	if (scan_field_value(buffer + i, end - i) != end - i)
+		return 400;
+	header->value = make_view(i, end - i);
+	parser->headerCount++;
+	return 0;
+}
+
+ParseStatus parse_request(RequestParser *const parser, char const *const buffer,
+		size_t const length)
+{
+	if (parser->stage == PARSER_DONE)
+		return REQUEST_COMPLETE;
+	if (parser->stage == PARSER_FAILED)
+		return REQUEST_INVALID;
+
+	while (parser->position < length) {
+		char const *const newline = memchr(buffer + parser->position, '\n',
+				length - parser->position);
+		if (newline == NULL) {
+			parser->position = length;
+			break;
+		}
+
+		size_t const start = parser->lineStart;
+		size_t end = (size_t) (newline - buffer);
+		parser->position = parser->lineStart = end + 1;
+		// Bare LF line endings are accepted as well as CRLF
+		if (end > start && buffer[end - 1] == '\r')
+			end--;
+
+		if (parser->stage == PARSER_REQUEST_LINE) {
+			// Blank lines before a request are allowed, some clients
+			// send one after a request body
+			if (end == start)
+				continue;
+			if (end - start > MAXIMUM_REQUEST_LINE_SIZE)
+				return parser_fail(parser, 414);
+			unsigned short const error = parse_request_line(parser, buffer, start, end);
+			if (error != 0)
+				return parser_fail(parser, error);
+			parser->stage = PARSER_HEADERS;
+			continue;
+		}
+
+		if (end == start) {
+			parser->stage = PARSER_DONE;
+			parser->end = parser->position;
+			return REQUEST_COMPLETE;
+		}
+		if (end - start > MAXIMUM_HEADER_LINE_SIZE)
+			return parser_fail(parser, 431);
+		unsigned short const error = parse_header_line(parser, buffer, start, end);
+		if (error != 0)
+			return parser_fail(parser, error);
+	}
+
+	// Give up on lines that are already too long rather than waiting for
+	// the rest of them
+	size_t const partial = length - parser->lineStart;
+	if (parser->stage == PARSER_REQUEST_LINE && partial > MAXIMUM_REQUEST_LINE_SIZE)
+		return parser_fail(parser, 414);
+	if (partial > MAXIMUM_HEADER_LINE_SIZE || length >= MAXIMUM_REQUEST_HEAD_SIZE)
+		return parser_fail(parser, 431);
+	return REQUEST_INCOMPLETE;
+}
+
+HeaderView const *find_header(RequestParser const *const parser, char const *const buffer,
+		char const *const name)
+{
+	for (unsigned i = 0; i < parser->headerCount; i++) {
+		if (view_equals_ignoring_case(buffer, parser->headers[i].name, name))
+			return &parser->headers[i];
+	}
+	return NULL;
+}
+
+bool view_equals(char const *const buffer, TextView const view, char const *const text)
+{
+	return strlen(text) == view.length && memcmp(buffer + view.offset, text, view.length) == 0;
+}
+
+bool view_equals_ignoring_case(char const *const buffer, TextView const view,
+		char const *const text)
+{
+	return strlen(text) == view.length
+		&& strncasecmp(buffer + view.offset, text, view.length) == 0;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest request line accepted, anything longer is answered with 414
+#define MAXIMUM_REQUEST_LINE_SIZE 1024
+
+// Limits on the header fields, going over any of them is answered with 431
+#define MAXIMUM_HEADER_LINE_SIZE 1024
+#define MAXIMUM_HEADER_COUNT 32
+// Everything up to and including the blank line ending the headers
+#define MAXIMUM_REQUEST_HEAD_SIZE (1024 * 8)
+
+// A piece of the receive buffer. Offsets rather than pointers, so they stay
+// valid when the buffer is moved and take up less room.
+typedef struct {
+	uint16_t offset;
+	uint16_t length;
+} TextView;
+
+typedef struct {
+	TextView name;
+	// Without the whitespace around it
+	TextView value;
+} HeaderView;
+
+typedef enum {
+	REQUEST_INCOMPLETE,
+	REQUEST_COMPLETE,
+	REQUEST_INVALID,
+} ParseStatus;
+
+typedef enum {
+	PARSER_REQUEST_LINE,
+	PARSER_HEADERS,
+	PARSER_DONE,
+	PARSER_FAILED,
+} ParserStage;
+
+// Parses a request as it arrives, a line at a time. Nothing gets copied,
+// the results point into the buffer the request is being received into.
+// A zeroed parser is ready for a new request.
+typedef struct {
+	ParserStage stage;
+	// How far into the buffer has been looked at and where the line being
+	// received starts
+	size_t position;
+	size_t lineStart;
+
+	TextView method;
+	TextView target;
+	TextView version;
+	HeaderView headers[MAXIMUM_HEADER_COUNT];
+	unsigned headerCount;
+
+	// Length of the whole request once it is complete
+	size_t end;
+	// Status code to answer with once it has failed
+	unsigned short error;
+} RequestParser;
+
+void request_parser_reset(RequestParser *const parser);
+
+// Carries on parsing with the first length bytes of buffer, which must
+// start with what was passed in before. Only new bytes get looked at.
+ParseStatus parse_request(RequestParser *const parser, char const *const buffer,
+		size_t const length);
+
+// Returns the first header called name, compared case-insensitively, or
+// NULL if the request does not have one.
+HeaderView const *find_header(RequestParser const *const parser, char const *const buffer,
+		char const *const name);
+
+// Whether a view holds exactly text, case-sensitively or not
+bool view_equals(char const *const buffer, TextView const view, char const *const text);
+bool view_equals_ignoring_case(char const *const buffer, TextView const view,
+		char const *const text);
@@ -0,0 +1,1149 @@
+// statx()
+#define _GNU_SOURCE
+
+#include "uring.h"
+#include "http-server.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/io_uring.h>
+#include <netinet/in.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Size of the submission queue, the completion queue gets twice as many
+#define URING_ENTRIES 1024
+
+// Receive buffers handed to the kernel, it picks one whenever data arrives
+// so idle connections don't pin any memory. The count must be a power of
+// two.
+#define URING_RECV_BUFFER_COUNT 256
+#define URING_RECV_BUFFER_SIZE 2048
+#define URING_RECV_BUFFER_GROUP 0
+
+// Registered file slots that openat() installs files into, a file holds
+// its slot until the body has been sent. Requests queue up when they are
+// all taken.
+#define URING_FILE_SLOTS 1024
+
+// io_uring has no sendfile(), bodies are spliced through a pipe instead so
+// they still never get copied into user space. This is how much goes
+// through per round trip, the default pipe capacity.
+#define URING_SPLICE_CHUNK (64 * 1024)
+
+// The operation a completion belongs to is kept in the low bits of
+// user_data, connections are allocated with calloc() so they are always
+// aligned well enough for this.
+#define URING_OP_BITS 4
+#define URING_OP_MASK ((1ULL << URING_OP_BITS) - 1)
+
+typedef enum {
+	URING_ACCEPT,
+	URING_RECV,
+	URING_STATX,
+	// Looking for one of the sidecars next to the file
+	URING_SIDECAR_STATX,
+	URING_OPENAT,
+	URING_SEND,
+	URING_SPLICE_IN,
+	URING_SPLICE_OUT,
+	// Streaming with -f read, the file is read into the connection's
+	// chunk buffer and that is sent before the next read
+	URING_STREAM_READ,
+	URING_STREAM_SEND,
+	// Carries the slot number instead of a connection, the slot may only
+	// be reused once the close has actually happened.
+	URING_CLOSE_FILE,
+	URING_CLOSE_SOCKET,
+	// Completions nobody needs to look at
+	URING_IGNORE,
+} UringOp;
+
+typedef struct UringConnection {
+	Connection conn;
+
+	char location[MAXIMUM_REQUEST_LOCATION_SIZE + 1];
+	struct statx stx;
+	// Cache entry held while statx checks it still matches the file
+	CachedContent *unchecked;
+	// While sidecars are looked for: the coding looked for last, the ones
+	// found so far and what the file they are next to looked like
+	ContentEncoding sidecarProbe;
+	unsigned sidecarsFound;
+	struct stat sidecarBase;
+
+	// Registered slot of the open file, -1 when there is none
+	int fileSlot;
+	// Set once the response sending from the slot has been queued. It is
+	// always the last one, so the slot can go once the queue is empty.
+	bool fileQueued;
+	// Pipe the body is spliced through and how much is sitting in it
+	int pipeFDs[2];
+	size_t pipeBytes;
+	bool spliceFailed;
+
+	struct iovec iov[MAXIMUM_GATHERED_SEGMENTS];
+	struct msghdr msg;
+
+	// Absolute deadline of the timeout linked to each receive
+	struct __kernel_timespec recvDeadline;
+
+	// Next connection waiting for a free file slot
+	struct UringConnection *nextWaiting;
+} UringConnection;
+
+typedef struct {
+	int fd;
+
+	unsigned *sqHead;
+	unsigned *sqTail;
+	unsigned sqMask;
+	unsigned *sqArray;
+	struct io_uring_sqe *sqes;
+	unsigned toSubmit;
+
+	unsigned *cqHead;
+	unsigned *cqTail;
+	unsigned cqMask;
+	struct io_uring_cqe *cqes;
+
+	void *rings;
+	size_t ringsSize;
+	size_t sqesSize;
+
+	struct io_uring_buf_ring *bufferRing;
+	size_t bufferRingSize;
+	char *recvBuffers;
+
+	int freeSlots[URING_FILE_SLOTS];
+	int freeSlotCount;
+	UringConnection *waitingHead;
+	UringConnection *waitingTail;
+
+	Worker *worker;
+	int listenFD;
+	bool accepting;
+	unsigned long active;
+} Uring;
+
+int uring_enter(int const fd, unsigned const toSubmit, unsigned const minComplete,
+		unsigned const flags)
+{
+	return (int) syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+int uring_register(int const fd, unsigned const opcode, void const *const arg,
+		unsigned const count)
+{
+	return (int) syscall(__NR_io_uring_register, fd, opcode, arg, count);
+}
+
+// Checks that every opcode the backend relies on is known to the kernel
+bool uring_probe(Uring const *const ring)
+{
+	unsigned char const required[] = {
+		IORING_OP_ACCEPT, IORING_OP_RECV, IORING_OP_SENDMSG, IORING_OP_STATX,
+		IORING_OP_OPENAT, IORING_OP_SPLICE, IORING_OP_CLOSE, IORING_OP_ASYNC_CANCEL,
+		IORING_OP_READ, IORING_OP_SEND, IORING_OP_LINK_TIMEOUT
+	};
+
+	size_t const size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+	struct io_uring_probe *const probe = calloc(1, size);
+	if (probe == NULL)
+		return false;
+
+	bool supported = uring_register(ring->fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+	for (size_t i = 0; supported && i < sizeof(required); i++) {
+		supported = required[i] <= probe->last_op
+			&& (probe->ops[required[i]].flags & IO_URING_OP_SUPPORTED);
+	}
+	free(probe);
+	return supported;
+}
+
+void uring_teardown(Uring *const ring)
+{
+	if (ring->recvBuffers != NULL)
+		free(ring->recvBuffers);
+	if (ring->bufferRing != NULL)
+		munmap(ring->bufferRing, ring->bufferRingSize);
+	if (ring->sqes != NULL)
+		munmap(ring->sqes, ring->sqesSize);
+	if (ring->rings != NULL)
+		munmap(ring->rings, ring->ringsSize);
+	if (ring->fd != -1)
+		close(ring->fd);
+}
+
+void uring_recycle_buffer(Uring *const ring, unsigned short const id)
+{
+	unsigned short const tail = ring->bufferRing->tail;
+	struct io_uring_buf *const buf =
+		&ring->bufferRing->bufs[tail & (URING_RECV_BUFFER_COUNT - 1)];
+	buf->addr = (uint64_t) (uintptr_t) (ring->recvBuffers + (size_t) id * URING_RECV_BUFFER_SIZE);
+	buf->len = URING_RECV_BUFFER_SIZE;
+	buf->bid = id;
+	__atomic_store_n(&ring->bufferRing->tail, (unsigned short) (tail + 1), __ATOMIC_RELEASE);
+}
+
+// Sets up the rings, the provided receive buffers and the sparse file
+// table. Returns false if any of it is unsupported.
+bool uring_setup(Uring *const ring)
+{
+	memset(ring, 0, sizeof(*ring));
+	ring->fd = -1;
+
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	ring->fd = (int) syscall(__NR_io_uring_setup, URING_ENTRIES, &params);
+	if (ring->fd == -1) {
+		perror("uring_setup(): io_uring_setup() errored");
+		return false;
+	}
+	// Everything older than that is missing too much to bother
+	if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_NODROP)) {
+		fprintf(stderr, "uring_setup(): Kernel io_uring is too old\n");
+		uring_teardown(ring);
+		return false;
+	}
+
+	size_t const sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	size_t const cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	ring->ringsSize = sqSize > cqSize ? sqSize : cqSize;
+	ring->rings = mmap(NULL, ring->ringsSize, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+	if (ring->rings == MAP_FAILED) {
+		ring->rings = NULL;
+		perror("uring_setup(): Failed to map rings");
+		uring_teardown(ring);
+		return false;
+	}
+	ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+	if (ring->sqes == MAP_FAILED) {
+		ring->sqes = NULL;
+		perror("uring_setup(): Failed to map submission entries");
+		uring_teardown(ring);
+		return false;
+	}
+
+	char *const base = ring->rings;
+	ring->sqHead = (unsigned *) (base + params.sq_off.head);
+	ring->sqTail = (unsigned *) (base + params.sq_off.tail);
+	ring->sqMask = *(unsigned *) (base + params.sq_off.ring_mask);
+	ring->sqArray = (unsigned *) (base + params.sq_off.array);
+	ring->cqHead = (unsigned *) (base + params.cq_off.head);
+	ring->cqTail = (unsigned *) (base + params.cq_off.tail);
+	ring->cqMask = *(unsigned *) (base + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *) (base + params.cq_off.cqes);
+
+	if (!uring_probe(ring)) {
+		fprintf(stderr, "uring_setup(): Kernel lacks a required io_uring operation\n");
+		uring_teardown(ring);
+		return false;
+	}
+
+	// Ring mapped provided buffers arrived in the same release as
+	// multishot accept, so this doubles as the check for that.
+	ring->bufferRingSize = URING_RECV_BUFFER_COUNT * sizeof(struct io_uring_buf);
+	ring->bufferRing = mmap(NULL, ring->bufferRingSize, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ring->bufferRing == MAP_FAILED) {
+		ring->bufferRing = NULL;
+		perror("uring_setup(): Failed to map buffer ring");
+		uring_teardown(ring);
+		return false;
+	}
+	ring->recvBuffers = calloc(URING_RECV_BUFFER_COUNT, URING_RECV_BUFFER_SIZE);
+	if (ring->recvBuffers == NULL) {
+		perror("uring_setup(): Failed to allocate receive buffers");
+		uring_teardown(ring);
+		return false;
+	}
+	struct io_uring_buf_reg bufferReg;
+	memset(&bufferReg, 0, sizeof(bufferReg));
+	bufferReg.ring_addr = (uint64_t) (uintptr_t) ring->bufferRing;
+	bufferReg.ring_entries = URING_RECV_BUFFER_COUNT;
+	bufferReg.bgid = URING_RECV_BUFFER_GROUP;
+	if (uring_register(ring->fd, IORING_REGISTER_PBUF_RING, &bufferReg, 1) != 0) {
+		perror("uring_setup(): Failed to register buffer ring");
+		uring_teardown(ring);
+		return false;
+	}
+	for (unsigned i = 0; i < URING_RECV_BUFFER_COUNT; i++)
+		uring_recycle_buffer(ring, (unsigned short) i);
+
+	// Start with every slot empty, openat() fills them in
+	for (int i = 0; i < URING_FILE_SLOTS; i++) {
+		ring->freeSlots[i] = -1;
+	}
+	if (uring_register(ring->fd, IORING_REGISTER_FILES, ring->freeSlots, URING_FILE_SLOTS) != 0) {
+		perror("uring_setup(): Failed to register file slots");
+		uring_teardown(ring);
+		return false;
+	}
+	for (int i = 0; i < URING_FILE_SLOTS; i++)
+		ring->freeSlots[i] = URING_FILE_SLOTS - 1 - i;
+	ring->freeSlotCount = URING_FILE_SLOTS;
+
+	return true;
+}
+
+// Grabs the next free submission entry, flushing the queue to the kernel
+// first if it is full. Entries only reach the kernel on the next
+// uring_enter(), so everything queued in one pass is submitted together.
+// Submits what is queued until count more entries fit in the submission
+// queue. Linked entries have to be reserved together, getting the second
+// one could otherwise submit the first with its link left dangling.
+void uring_reserve_sqes(Uring *const ring, unsigned const count)
+{
+	while (*ring->sqTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE)
+			> ring->sqMask + 1 - count) {
+		int const submitted = uring_enter(ring->fd, ring->toSubmit, 0, 0);
+		if (submitted > 0)
+			ring->toSubmit -= (unsigned) submitted;
+		else if (submitted == -1 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			perror("uring_reserve_sqes(): io_uring_enter() errored");
+	}
+}
+
+struct io_uring_sqe *uring_get_sqe(Uring *const ring, UringConnection *const uc, UringOp const op)
+{
+	uring_reserve_sqes(ring, 1);
+	unsigned const tail = *ring->sqTail;
+	unsigned const index = tail & ring->sqMask;
+	struct io_uring_sqe *const sqe = &ring->sqes[index];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->user_data = (uint64_t) (uintptr_t) uc | (uint64_t) op;
+	ring->sqArray[index] = index;
+	__atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+	ring->toSubmit++;
+	return sqe;
+}
+
+void uring_queue_accept(Uring *const ring)
+{
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring, NULL, URING_ACCEPT);
+	sqe->opcode = IORING_OP_ACCEPT;
+	sqe->fd = ring->listenFD;
+	sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+	sqe->accept_flags = SOCK_CLOEXEC;
+}
+
+void uring_queue_recv(Uring *const ring, UringConnection *const uc)
+{
+	bool const timed = uc->conn.idleDeadline != LLONG_MAX;
+	uring_reserve_sqes(ring, timed ? 2 : 1);
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_RECV);
+	sqe->opcode = IORING_OP_RECV;
+	sqe->fd = uc->conn.fd;
+	sqe->flags = IOSQE_BUFFER_SELECT;
+	sqe->buf_group = URING_RECV_BUFFER_GROUP;
+	// Never take more than fits, the rest stays in the socket
+	size_t const room = MAXIMUM_REQUEST_SIZE - uc->conn.requestLength;
+	sqe->len = (unsigned) (room < URING_RECV_BUFFER_SIZE ? room : URING_RECV_BUFFER_SIZE);
+
+	// The receive gets cancelled if the request has not arrived by the
+	// connection's idle deadline
+	if (!timed)
+		return;
+	sqe->flags |= IOSQE_IO_LINK;
+	uc->recvDeadline.tv_sec = uc->conn.idleDeadline / 1000;
+	uc->recvDeadline.tv_nsec = (uc->conn.idleDeadline % 1000) * 1000000;
+	struct io_uring_sqe *const timeout = uring_get_sqe(ring, NULL, URING_IGNORE);
+	timeout->opcode = IORING_OP_LINK_TIMEOUT;
+	timeout->addr = (uint64_t) (uintptr_t) &uc->recvDeadline;
+	timeout->len = 1;
+	timeout->timeout_flags = IORING_TIMEOUT_ABS;
+}
+
+// Sends the headers and in-memory bodies of the queued responses up to
+// the next file in a single sendmsg(). Returns false if the response at
+// the head only has its file left.
+bool uring_queue_send(Uring *const ring, UringConnection *const uc)
+{
+	Connection *const conn = &uc->conn;
+	bool fileNext;
+	size_t const count = gather_responses(conn, uc->iov,
+			sizeof(uc->iov) / sizeof(uc->iov[0]), &fileNext);
+	if (count == 0)
+		return false;
+	memset(&uc->msg, 0, sizeof(uc->msg));
+	uc->msg.msg_iov = uc->iov;
+	uc->msg.msg_iovlen = count;
+
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_SEND);
+	sqe->opcode = IORING_OP_SENDMSG;
+	sqe->fd = conn->fd;
+	sqe->addr = (uint64_t) (uintptr_t) &uc->msg;
+	sqe->len = 1;
+	sqe->msg_flags = MSG_NOSIGNAL | MSG_WAITALL | (fileNext ? MSG_MORE : 0);
+	return true;
+}
+
+void uring_queue_close(Uring *const ring, int const fd, UringOp const op, void *const tag)
+{
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring, tag, op);
+	sqe->opcode = IORING_OP_CLOSE;
+	sqe->fd = fd;
+}
+
+void uring_close_file_slot(Uring *const ring, UringConnection *const uc)
+{
+	if (uc->fileSlot == -1)
+		return;
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring,
+			(void *) (uintptr_t) ((uint64_t) uc->fileSlot << URING_OP_BITS), URING_CLOSE_FILE);
+	sqe->opcode = IORING_OP_CLOSE;
+	sqe->file_index = (unsigned) uc->fileSlot + 1;
+	uc->fileSlot = -1;
+	uc->fileQueued = false;
+}
+
+// Lets go of everything the connection holds. The connection itself is
+// freed once the socket close completes.
+void uring_finish(Uring *const ring, UringConnection *const uc)
+{
+	mark_connection_busy(ring->worker, &uc->conn);
+	uring_close_file_slot(ring, uc);
+	if (uc->pipeFDs[0] != -1) {
+		uring_queue_close(ring, uc->pipeFDs[0], URING_IGNORE, NULL);
+		uring_queue_close(ring, uc->pipeFDs[1], URING_IGNORE, NULL);
+		uc->pipeFDs[0] = uc->pipeFDs[1] = -1;
+	}
+	uring_queue_close(ring, uc->conn.fd, URING_CLOSE_SOCKET, uc);
+}
+
+void uring_queue_statx(Uring *const ring, UringConnection *const uc)
+{
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_STATX);
+	sqe->opcode = IORING_OP_STATX;
+	sqe->fd = AT_FDCWD;
+	sqe->addr = (uint64_t) (uintptr_t) uc->location;
+	sqe->len = STATX_SIZE | STATX_TYPE | STATX_INO | STATX_MTIME;
+	sqe->off = (uint64_t) (uintptr_t) &uc->stx;
+}
+
+// Looks for the next kind of sidecar after uc->sidecarProbe next to the
+// file at uc->location, through the ring so the loop never waits on the
+// path lookup. The suffix stays on the location until the statx completes.
+// Returns false once every kind has been looked for.
+bool uring_queue_sidecar_statx(Uring *const ring, UringConnection *const uc)
+{
+	size_t const length = strlen(uc->location);
+	for (unsigned i = uc->sidecarProbe + 1; i < ENCODING_COUNT; i++) {
+		char const *const suffix = encoding_suffix((ContentEncoding) i);
+		if (suffix[0] == '\0' || length + strlen(suffix) > MAXIMUM_REQUEST_LOCATION_SIZE)
+			continue;
+		strcpy(uc->location + length, suffix);
+		uc->sidecarProbe = (ContentEncoding) i;
+		struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_SIDECAR_STATX);
+		sqe->opcode = IORING_OP_STATX;
+		sqe->fd = AT_FDCWD;
+		sqe->addr = (uint64_t) (uintptr_t) uc->location;
+		sqe->len = STATX_TYPE;
+		sqe->off = (uint64_t) (uintptr_t) &uc->stx;
+		return true;
+	}
+	return false;
+}
+
+// Opens the file straight into a registered slot, which the splices then
+// refer to without it ever getting a normal descriptor.
+void uring_queue_openat(Uring *const ring, UringConnection *const uc)
+{
+	uc->fileSlot = ring->freeSlots[--ring->freeSlotCount];
+
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_OPENAT);
+	sqe->opcode = IORING_OP_OPENAT;
+	sqe->fd = AT_FDCWD;
+	sqe->addr = (uint64_t) (uintptr_t) uc->location;
+	sqe->open_flags = O_RDONLY;
+	sqe->file_index = (unsigned) uc->fileSlot + 1;
+}
+
+// Queues the next chunk of the body as file -> pipe linked to
+// pipe -> socket. A short first splice breaks the link, in which case the
+// second half is queued by hand once the cancellation comes back.
+void uring_queue_splice(Uring *const ring, UringConnection *const uc)
+{
+	Connection *const conn = &uc->conn;
+
+	// Whatever is in the pipe has not been accounted for yet, so the range
+	// only moves on once it is empty again
+	if (uc->pipeBytes == 0) {
+		off_t offset;
+		size_t length;
+		next_file_range(conn, &offset, &length);
+		size_t const chunk = length > URING_SPLICE_CHUNK ? URING_SPLICE_CHUNK : length;
+		uring_reserve_sqes(ring, 2);
+		struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_SPLICE_IN);
+		sqe->opcode = IORING_OP_SPLICE;
+		sqe->splice_fd_in = uc->fileSlot;
+		sqe->splice_off_in = (uint64_t) offset;
+		sqe->splice_flags = SPLICE_F_FD_IN_FIXED;
+		sqe->fd = uc->pipeFDs[1];
+		sqe->off = (uint64_t) -1;
+		sqe->len = (unsigned) chunk;
+		sqe->flags = IOSQE_IO_LINK;
+		uc->spliceFailed = false;
+
+		struct io_uring_sqe *const out = uring_get_sqe(ring, uc, URING_SPLICE_OUT);
+		out->opcode = IORING_OP_SPLICE;
+		out->splice_fd_in = uc->pipeFDs[0];
+		out->splice_off_in = (uint64_t) -1;
+		out->fd = conn->fd;
+		out->off = (uint64_t) -1;
+		out->len = (unsigned) chunk;
+		return;
+	}
+
+	struct io_uring_sqe *const out = uring_get_sqe(ring, uc, URING_SPLICE_OUT);
+	out->opcode = IORING_OP_SPLICE;
+	out->splice_fd_in = uc->pipeFDs[0];
+	out->splice_off_in = (uint64_t) -1;
+	out->fd = conn->fd;
+	out->off = (uint64_t) -1;
+	out->len = (unsigned) uc->pipeBytes;
+}
+
+// Streams the next bit of the body: reads a chunk into the connection's
+// buffer once the last one has been sent in full, otherwise sends what is
+// left of it. Returns false if there is no buffer to read into.
+bool uring_queue_stream(Uring *const ring, UringConnection *const uc)
+{
+	Connection *const conn = &uc->conn;
+	if (conn->streamLength == 0) {
+		off_t offset;
+		size_t length;
+		if (!next_stream_chunk(conn, &offset, &length))
+			return false;
+		struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_STREAM_READ);
+		sqe->opcode = IORING_OP_READ;
+		sqe->fd = uc->fileSlot;
+		sqe->flags = IOSQE_FIXED_FILE;
+		sqe->addr = (uint64_t) (uintptr_t) conn->streamBuffer;
+		sqe->len = (unsigned) length;
+		sqe->off = (uint64_t) offset;
+		return true;
+	}
+
+	struct io_uring_sqe *const sqe = uring_get_sqe(ring, uc, URING_STREAM_SEND);
+	sqe->opcode = IORING_OP_SEND;
+	sqe->fd = conn->fd;
+	sqe->addr = (uint64_t) (uintptr_t) (conn->streamBuffer + conn->streamSent);
+	sqe->len = (unsigned) (conn->streamLength - conn->streamSent);
+	sqe->msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+	return true;
+}
+
+void uring_release_slot(Uring *const ring, int const slot)
+{
+	ring->freeSlots[ring->freeSlotCount++] = slot;
+
+	UringConnection *const waiting = ring->waitingHead;
+	if (waiting != NULL) {
+		ring->waitingHead = waiting->nextWaiting;
+		if (ring->waitingHead == NULL)
+			ring->waitingTail = NULL;
+		uring_queue_openat(ring, waiting);
+	}
+}
+
+// Sends the queued responses, or waits for more requests once they are all
+// out
+void uring_send_responses(Uring *const ring, UringConnection *const uc)
+{
+	Connection *const conn = &uc->conn;
+	if (conn->responseCount == 0) {
+		if (conn->closing) {
+			uring_finish(ring, uc);
+			return;
+		}
+		mark_connection_idle(ring->worker, conn, monotonic_milliseconds());
+		uring_queue_recv(ring, uc);
+		return;
+	}
+	if (uring_queue_send(ring, uc))
+		return;
+	if (!ring->worker->streamFiles)
+		uring_queue_splice(ring, uc);
+	else if (!uring_queue_stream(ring, uc))
+		uring_finish(ring, uc);
+}
+
+// Answers from a cache entry that is known to match the file, or a
+// compressed copy of it
+void uring_use_cached_content(Uring *const ring, UringConnection *const uc,
+		CachedContent *const cached)
+{
+	if (use_compressed_variant(ring->worker, &uc->conn, uc->location, cached->size,
+			cached->modified))
+		content_cache_release(ring->worker->content, cached);
+	else
+		use_cached_content(ring->worker, &uc->conn, cached, uc->location);
+}
+
+// How the coding of a response got settled
+typedef enum {
+	// The file that was looked up gets sent
+	NEGOTIATED_AS_IS,
+	// uc->location now names a sidecar, which has to be looked up instead
+	NEGOTIATED_SIDECAR,
+	// The sidecars are being looked for, the completion starts over
+	NEGOTIATION_PENDING,
+} UringNegotiation;
+
+// Picks the coding to send the file at uc->location in once st, the file's
+// own stat, shows it exists. Sidecars not known for the file as it is now
+// are looked for first.
+UringNegotiation uring_negotiate_encoding(Uring *const ring, UringConnection *const uc,
+		struct stat const *const st)
+{
+	SidecarTable *const sidecars = ring->worker->sidecars;
+	if (sidecars == NULL || uc->conn.sidecar)
+		return NEGOTIATED_AS_IS;
+	unsigned found;
+	if (sidecar_table_find(sidecars, uc->location, st, &found))
+		return choose_sidecar(&uc->conn, uc->location, found)
+			? NEGOTIATED_SIDECAR : NEGOTIATED_AS_IS;
+
+	uc->sidecarProbe = ENCODING_IDENTITY;
+	uc->sidecarsFound = 0;
+	uc->sidecarBase = *st;
+	if (uring_queue_sidecar_statx(ring, uc))
+		return NEGOTIATION_PENDING;
+	sidecar_table_store(sidecars, uc->location, st, 0);
+	return NEGOTIATED_AS_IS;
+}
+
+// Answers from the content cache if the file at uc->location is in it,
+// otherwise starts looking the file up. Returns false in the latter case,
+// the completion carries on from there.
+bool uring_find_file(Uring *const ring, UringConnection *const uc)
+{
+	if (ring->worker->content != NULL) {
+		bool needsCheck = false;
+		CachedContent *const cached = content_cache_lookup(ring->worker->content,
+				uc->location, &needsCheck);
+		if (cached == NULL)
+			count_content_lookup(ring->worker, false);
+		if (cached != NULL && !needsCheck) {
+			count_content_lookup(ring->worker, true);
+			struct stat st;
+			cached_content_stat(cached, &st);
+			switch (uring_negotiate_encoding(ring, uc, &st)) {
+			case NEGOTIATED_AS_IS:
+				uring_use_cached_content(ring, uc, cached);
+				return true;
+			case NEGOTIATED_SIDECAR:
+				content_cache_release(ring->worker->content, cached);
+				return uring_find_file(ring, uc);
+			case NEGOTIATION_PENDING:
+				content_cache_release(ring->worker->content, cached);
+				return false;
+			}
+		}
+		uc->unchecked = cached;
+	}
+	uring_queue_statx(ring, uc);
+	return false;
+}
+
+// A request has fully arrived, work out what to send back. Returns false
+// if that has to wait for the file system, in which case the completion
+// carries on.
+bool uring_start_response(Uring *const ring, UringConnection *const uc)
+{
+	begin_response(ring->worker, &uc->conn);
+	if (resolve_request(ring->worker, &uc->conn, uc->location)
+			&& !uring_find_file(ring, uc))
+		return false;
+	queue_response(ring->worker, &uc->conn);
+	return true;
+}
+
+// Answers every complete request already buffered, then sends what got
+// queued. Only one file can be open per connection, so preparing stops
+// until a queued file has been sent.
+void uring_prepare_responses(Uring *const ring, UringConnection *const uc)
+{
+	Connection *const conn = &uc->conn;
+	if (uc->fileQueued && conn->responseCount == 0)
+		uring_close_file_slot(ring, uc);
+	while (!conn->closing && conn->responseCount < MAXIMUM_PIPELINED_RESPONSES
+			&& uc->fileSlot == -1 && request_complete(conn)) {
+		mark_connection_busy(ring->worker, conn);
+		if (!uring_start_response(ring, uc))
+			return;
+	}
+	uring_send_responses(ring, uc);
+}
+
+// The pending response is complete, queue it and carry on with the next
+// request
+void uring_response_ready(Uring *const ring, UringConnection *const uc)
+{
+	queue_response(ring->worker, &uc->conn);
+	uring_prepare_responses(ring, uc);
+}
+
+// Starts the file lookup over after uc->location changed, from a completion
+void uring_find_file_again(Uring *const ring, UringConnection *const uc)
+{
+	if (uring_find_file(ring, uc))
+		uring_response_ready(ring, uc);
+}
+
+void uring_statx_to_stat(struct statx const *const stx, struct stat *const st)
+{
+	memset(st, 0, sizeof(*st));
+	st->st_dev = makedev(stx->stx_dev_major, stx->stx_dev_minor);
+	st->st_ino = stx->stx_ino;
+	st->st_mode = stx->stx_mode;
+	st->st_size = (off_t) stx->stx_size;
+	st->st_mtim.tv_sec = stx->stx_mtime.tv_sec;
+	st->st_mtim.tv_nsec = stx->stx_mtime.tv_nsec;
+}
+
+void uring_handle_statx(Uring *const ring, UringConnection *const uc, int const res)
+{
+	Connection *const conn = &uc->conn;
+	struct stat st;
+	uring_statx_to_stat(&uc->stx, &st);
+
+	if (uc->unchecked != NULL) {
+		CachedContent *const cached = uc->unchecked;
+		uc->unchecked = NULL;
+		if (res < 0)
+			content_cache_evict(ring->worker->content, cached);
+		bool const current = res >= 0
+			&& content_cache_revalidate(ring->worker->content, cached, &st);
+		count_content_lookup(ring->worker, current);
+		UringNegotiation const negotiation = current
+			? uring_negotiate_encoding(ring, uc, &st) : NEGOTIATED_AS_IS;
+		if (current && negotiation == NEGOTIATED_AS_IS) {
+			uring_use_cached_content(ring, uc, cached);
+			uring_response_ready(ring, uc);
+			return;
+		}
+		content_cache_release(ring->worker->content, cached);
+		if (negotiation == NEGOTIATED_SIDECAR)
+			uring_find_file_again(ring, uc);
+		if (negotiation != NEGOTIATED_AS_IS)
+			return;
+	}
+
+	// If stat() errors assume the file does not exist
+	if (res < 0) {
+		// The sidecar went away since it was looked for
+		if (use_original_file(ring->worker, conn, uc->location)) {
+			uring_find_file_again(ring, uc);
+			return;
+		}
+		if (ring->worker->accessLog == NULL) {
+			fprintf(stderr, "uring_handle_statx(): Could not stat requested file: %s\n",
+				strerror(-res));
+			fprintf(stderr, "File requested: %s\n", uc->location);
+		}
+		SET_REPLY(conn, 404);
+		uring_response_ready(ring, uc);
+		return;
+	}
+
+	// Anything else would only fail halfway through splicing, after the
+	// header already went out.
+	if (!S_ISREG(uc->stx.stx_mode)) {
+		fprintf(stderr, "uring_handle_statx(): Requested file is not a regular file: %s\n",
+			uc->location);
+		SET_REPLY(conn, 500);
+		uring_response_ready(ring, uc);
+		return;
+	}
+
+	// Sidecars are only looked for next to files that exist
+	switch (uring_negotiate_encoding(ring, uc, &st)) {
+	case NEGOTIATED_AS_IS:
+		break;
+	case NEGOTIATED_SIDECAR:
+		uring_find_file_again(ring, uc);
+		return;
+	case NEGOTIATION_PENDING:
+		return;
+	}
+
+	if (use_compressed_variant(ring->worker, conn, uc->location, st.st_size, st.st_mtim)
+			|| add_not_modified(conn, st.st_size, st.st_mtim)) {
+		uring_response_ready(ring, uc);
+		return;
+	}
+
+	if (conn->headRequest || uc->stx.stx_size == 0) {
+		add_file_response(conn, uc->location, st.st_size, st.st_mtim, NULL, NULL, NULL);
+		uring_response_ready(ring, uc);
+		return;
+	}
+
+	// Filling the cache reads the file synchronously, there is no point
+	// going through the ring for a read the loop has to wait for anyway.
+	// Ranges are spliced from the file so only they get read.
+	bool const wholeFile = !range_requested(conn);
+	if (ring->worker->content != NULL && wholeFile) {
+		CachedContent *const cached = content_cache_admit(ring->worker->content,
+				uc->location, &st);
+		if (cached != NULL) {
+			use_cached_content(ring->worker, conn, cached, uc->location);
+			uring_response_ready(ring, uc);
+			return;
+		}
+	}
+
+	// Mapped files go out with a plain sendmsg() and skip the open and
+	// splicing altogether.
+	if (ring->worker->mappings != NULL && wholeFile) {
+		MappedFile *const mapping = mapping_table_acquire(ring->worker->mappings,
+				uc->location, &st);
+		if (mapping != NULL) {
+			use_mapped_file(ring->worker, conn, mapping, uc->location);
+			uring_response_ready(ring, uc);
+			return;
+		}
+	}
+
+	if (!add_file_response(conn, uc->location, st.st_size, st.st_mtim, NULL, NULL, NULL)) {
+		uring_response_ready(ring, uc);
+		return;
+	}
+
+	if (ring->freeSlotCount == 0) {
+		uc->nextWaiting = NULL;
+		if (ring->waitingTail != NULL)
+			ring->waitingTail->nextWaiting = uc;
+		else
+			ring->waitingHead = uc;
+		ring->waitingTail = uc;
+		return;
+	}
+	uring_queue_openat(ring, uc);
+}
+
+void uring_handle_sidecar_statx(Uring *const ring, UringConnection *const uc, int const res)
+{
+	uc->location[strlen(uc->location) - strlen(encoding_suffix(uc->sidecarProbe))] = '\0';
+	if (res >= 0 && S_ISREG(uc->stx.stx_mode))
+		uc->sidecarsFound |= ENCODING_BIT(uc->sidecarProbe);
+	if (uring_queue_sidecar_statx(ring, uc))
+		return;
+	// Starting over finds them in the table, as long as the file is still
+	// the one they were looked for next to
+	sidecar_table_store(ring->worker->sidecars, uc->location, &uc->sidecarBase,
+		uc->sidecarsFound);
+	uring_find_file_again(ring, uc);
+}
+
+void uring_handle_openat(Uring *const ring, UringConnection *const uc, int const res)
+{
+	Connection *const conn = &uc->conn;
+
+	// If this fails its most likely an
+	// internal error as the statx check passed
+	if (res < 0) {
+		fprintf(stderr, "uring_handle_openat(): Could not open requested file: %s\n",
+			strerror(-res));
+		uring_release_slot(ring, uc->fileSlot);
+		uc->fileSlot = -1;
+		SET_REPLY(conn, 500);
+		uring_response_ready(ring, uc);
+		return;
+	}
+
+	if (!ring->worker->streamFiles && uc->pipeFDs[0] == -1
+			&& pipe2(uc->pipeFDs, O_CLOEXEC) == -1) {
+		perror("uring_handle_openat(): Failed to create splice pipe");
+		uc->pipeFDs[0] = uc->pipeFDs[1] = -1;
+		uring_close_file_slot(ring, uc);
+		SET_REPLY(conn, 500);
+		uring_response_ready(ring, uc);
+		return;
+	}
+
+	uc->fileQueued = true;
+	uring_response_ready(ring, uc);
+}
+
+void uring_handle_splice(Uring *const ring, UringConnection *const uc, UringOp const op,
+		int const res)
+{
+	Connection *const conn = &uc->conn;
+
+	if (op == URING_SPLICE_IN) {
+		if (res <= 0) {
+			// Either an error or the file shrank, the header is already
+			// out so there is nothing left but to hang up. The linked
+			// half gets cancelled and handles that.
+			if (res < 0)
+				fprintf(stderr, "uring_handle_splice(): Reading %s failed: %s\n",
+					uc->location, strerror(-res));
+			uc->spliceFailed = true;
+			return;
+		}
+		uc->pipeBytes += (size_t) res;
+		return;
+	}
+
+	if (res == -ECANCELED && !uc->spliceFailed) {
+		// The file side came up short, send what it did manage
+		uring_queue_splice(ring, uc);
+		return;
+	}
+	if (res <= 0) {
+		uring_finish(ring, uc);
+		return;
+	}
+
+	uc->pipeBytes -= (size_t) res;
+	mark_responses_sent(ring->worker, conn, (size_t) res);
+	if (uc->pipeBytes > 0) {
+		uring_queue_splice(ring, uc);
+		return;
+	}
+	// Either on with the rest of the response or, if it is done, with
+	// the next one
+	uring_prepare_responses(ring, uc);
+}
+
+void uring_handle_stream(Uring *const ring, UringConnection *const uc, UringOp const op,
+		int const res)
+{
+	Connection *const conn = &uc->conn;
+
+	if (op == URING_STREAM_READ) {
+		// Either an error or the file shrank, the header is already out
+		// so there is nothing left but to hang up
+		if (res <= 0) {
+			if (res < 0)
+				fprintf(stderr, "uring_handle_stream(): Reading %s failed: %s\n",
+					uc->location, strerror(-res));
+			uring_finish(ring, uc);
+			return;
+		}
+		conn->streamLength = (size_t) res;
+		uring_queue_stream(ring, uc);
+		return;
+	}
+
+	// Failing sends are clients that went away, which stops the reading
+	// as well
+	if (res <= 0) {
+		uring_finish(ring, uc);
+		return;
+	}
+	mark_stream_sent(ring->worker, conn, (size_t) res);
+	uring_prepare_responses(ring, uc);
+}
+
+void uring_handle_recv(Uring *const ring, UringConnection *const uc, int const res,
+		unsigned const flags)
+{
+	Connection *const conn = &uc->conn;
+
+	if (res == -ENOBUFS) {
+		// Every buffer is in use, they get handed back as soon as the
+		// completions holding them are processed.
+		uring_queue_recv(ring, uc);
+		return;
+	}
+	if (res <= 0) {
+		// Cancelled receives are connections that sat idle for too long
+		if (res < 0 && res != -ECANCELED)
+			fprintf(stderr, "uring_handle_recv(): Failed to receive data: %s\n",
+				strerror(-res));
+		uring_finish(ring, uc);
+		return;
+	}
+
+	unsigned short const id = (unsigned short) (flags >> IORING_CQE_BUFFER_SHIFT);
+	size_t const length = (size_t) res;
+	memcpy(conn->request + conn->requestLength,
+		ring->recvBuffers + (size_t) id * URING_RECV_BUFFER_SIZE, length);
+	conn->requestLength += length;
+	conn->request[conn->requestLength] = '\0';
+	uring_recycle_buffer(ring, id);
+
+	if (request_complete(conn))
+		uring_prepare_responses(ring, uc);
+	else
+		uring_queue_recv(ring, uc);
+}
+
+void uring_handle_send(Uring *const ring, UringConnection *const uc, int const res)
+{
+	Connection *const conn = &uc->conn;
+	// Empty segments never get queued, so nothing having gone out means
+	// the client is gone and sending it again would only loop
+	if (res <= 0) {
+		uring_finish(ring, uc);
+		return;
+	}
+
+	mark_responses_sent(ring->worker, conn, (size_t) res);
+	uring_prepare_responses(ring, uc);
+}
+
+void uring_handle_accept(Uring *const ring, int const res, unsigned const flags)
+{
+	// Multishot accepts stop on errors and need to be armed again
+	if (!(flags & IORING_CQE_F_MORE) && ring->accepting)
+		uring_queue_accept(ring);
+
+	if (res < 0) {
+		if (res != -ECANCELED && res != -EINTR && res != -ECONNABORTED)
+			fprintf(stderr, "uring_handle_accept(): accept errored: %s\n", strerror(-res));
+		return;
+	}
+
+	UringConnection *const uc = calloc(1, sizeof(UringConnection));
+	if (uc == NULL) {
+		perror("uring_handle_accept(): Failed to allocate connection");
+		close(res);
+		return;
+	}
+	uc->conn.fd = res;
+	// Multishot accepts all share one address buffer, so it is asked for
+	// separately, and only when something is going to use it
+	if (ring->worker->accessLog != NULL) {
+		struct sockaddr_in peer;
+		socklen_t peerLength = sizeof(peer);
+		if (getpeername(res, (struct sockaddr *) &peer, &peerLength) == 0)
+			uc->conn.peerAddress = peer.sin_addr.s_addr;
+	}
+	arena_init(&uc->conn.arena, &ring->worker->slabs);
+	uc->fileSlot = -1;
+	uc->pipeFDs[0] = uc->pipeFDs[1] = -1;
+	ring->active++;
+	if (ring->worker->metrics != NULL)
+		metrics_add(&ring->worker->metrics->connectionsAccepted, 1);
+	mark_connection_idle(ring->worker, &uc->conn, monotonic_milliseconds());
+	uring_queue_recv(ring, uc);
+}
+
+void uring_handle_completion(Uring *const ring, struct io_uring_cqe const *const cqe)
+{
+	UringOp const op = (UringOp) (cqe->user_data & URING_OP_MASK);
+	UringConnection *const uc = (UringConnection *) (uintptr_t) (cqe->user_data & ~URING_OP_MASK);
+
+	switch (op) {
+	case URING_ACCEPT:
+		uring_handle_accept(ring, cqe->res, cqe->flags);
+		break;
+	case URING_RECV:
+		uring_handle_recv(ring, uc, cqe->res, cqe->flags);
+		break;
+	case URING_STATX:
+		uring_handle_statx(ring, uc, cqe->res);
+		break;
+	case URING_SIDECAR_STATX:
+		uring_handle_sidecar_statx(ring, uc, cqe->res);
+		break;
+	case URING_OPENAT:
+		uring_handle_openat(ring, uc, cqe->res);
+		break;
+	case URING_SEND:
+		uring_handle_send(ring, uc, cqe->res);
+		break;
+	case URING_SPLICE_IN:
+	case URING_SPLICE_OUT:
+		uring_handle_splice(ring, uc, op, cqe->res);
+		break;
+	case URING_STREAM_READ:
+	case URING_STREAM_SEND:
+		uring_handle_stream(ring, uc, op, cqe->res);
+		break;
+	case URING_CLOSE_FILE:
+		uring_release_slot(ring, (int) (cqe->user_data >> URING_OP_BITS));
+		break;
+	case URING_CLOSE_SOCKET:
+		release_responses(ring->worker, &uc->conn);
+		arena_release(&uc->conn.arena);
+		free(uc);
+		ring->active--;
+		if (ring->worker->metrics != NULL)
+			metrics_add(&ring->worker->metrics->connectionsClosed, 1);
+		break;
+	case URING_IGNORE:
+		break;
+	}
+}
+
+bool run_uring_loop(Worker *const worker, int const listenFD, unsigned long const maxRequests)
+{
+	Uring *const ring = malloc(sizeof(Uring));
+	if (ring == NULL) {
+		perror("run_uring_loop(): Failed to allocate ring");
+		return false;
+	}
+	if (!uring_setup(ring)) {
+		free(ring);
+		return false;
+	}
+
+	ring->worker = worker;
+	ring->listenFD = listenFD;
+	ring->accepting = true;
+	uring_queue_accept(ring);
+
+	while (ring->accepting || ring->active > 0) {
+		int const submitted = uring_enter(ring->fd, ring->toSubmit, 1, IORING_ENTER_GETEVENTS);
+		if (submitted == -1) {
+			if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+				continue;
+			perror("run_uring_loop(): io_uring_enter() errored");
+			break;
+		}
+		ring->toSubmit -= (unsigned) submitted;
+
+		unsigned head = *ring->cqHead;
+		unsigned const tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+		for (; head != tail; head++)
+			uring_handle_completion(ring, &ring->cqes[head & ring->cqMask]);
+		__atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+
+		// Stop taking new clients once the limit is reached but let the
+		// ones we already have finish.
+		if (ring->accepting && maxRequests != 0
+				&& ring->worker->requestsAnswered >= maxRequests) {
+			ring->accepting = false;
+			struct io_uring_sqe *const sqe = uring_get_sqe(ring, NULL, URING_IGNORE);
+			sqe->opcode = IORING_OP_ASYNC_CANCEL;
+			sqe->addr = (uint64_t) URING_ACCEPT;
+
+			// Connections only kept open for another request are sent
+			// away now instead of at their idle deadline, the connection is the first
+			// member of UringConnection so it doubles as the user_data.
+			ring->worker->draining = true;
+			for (Connection *conn = ring->worker->idleOldest; conn != NULL;
+					conn = conn->idleNewer) {
+				if (conn->requestCount == 0 || conn->requestLength != 0)
+					continue;
+				struct io_uring_sqe *const cancel = uring_get_sqe(ring, NULL, URING_IGNORE);
+				cancel->opcode = IORING_OP_ASYNC_CANCEL;
+				cancel->addr = (uint64_t) (uintptr_t) conn | (uint64_t) URING_RECV;
+			}
+		}
+	}
+
+	uring_teardown(ring);
+	free(ring);
+	return true;
+}
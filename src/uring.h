@@ -0,0 +1,17 @@
+#pragma once
+
+#include "worker.h"
+
+#include <stdbool.h>
+
+// Serves connections from listenFD with io_uring instead of epoll, until
+// maxRequests requests have been answered (0 means forever). Accepts are
+// multishot, requests are received into kernel provided buffers, the file
+// lookup runs as statx and openat into a registered slot and the body is
+// spliced to the socket through a pipe in linked pairs, or with -f read
+// read into the connection's chunk buffer and sent. Everything queued
+// during one pass is submitted by a single io_uring_enter().
+//
+// Returns false without serving anything when the kernel lacks one of the
+// features this needs, so the caller can fall back to run_event_loop().
+bool run_uring_loop(Worker *const worker, int const listenFD, unsigned long const maxRequests);
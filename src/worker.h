@@ -0,0 +1,72 @@
+#pragma once
+
+#include "access-log.h"
+#include "arena.h"
+#include "compression-cache.h"
+#include "connection.h"
+#include "content-cache.h"
+#include "content-encoding.h"
+#include "mapping-table.h"
+#include "metrics.h"
+#include "open-file-cache.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+// Fits "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+#define DATE_HEADER_SIZE 48
+
+// State belonging to a single event loop. Workers never share any of it,
+// whether they are processes or threads, so none of it needs locking.
+typedef struct {
+	// NULL unless files are served from memory mappings (-f mmap)
+	MappingTable *mappings;
+	// NULL when the content cache is turned off (-c 0)
+	ContentCache *content;
+	// NULL when precompressed sidecar files are not looked for (-p 0)
+	SidecarTable *sidecars;
+	// NULL unless files are compressed on the fly (-z)
+	CompressionCache *compressed;
+	// NULL when open files are not kept around (-o 0). Only the epoll
+	// loop uses it, io_uring opens files into registered slots without
+	// the loop waiting on the path lookups.
+	OpenFileCache *openFiles;
+	// Files are read through each connection's chunk buffer instead of
+	// going out with sendfile() or splice (-f read)
+	bool streamFiles;
+	// Slabs for connection arenas, kept around for the next connections
+	SlabPool slabs;
+	// This worker's own counters and every worker's, which a request for
+	// metricsPath gets answered with. All NULL unless metrics are turned
+	// on (-s).
+	WorkerMetrics *metrics;
+	Metrics const *allMetrics;
+	char const *metricsPath;
+	// METRICS_MAXIMUM_SIZE bytes scrapes are formatted into
+	char *metricsText;
+	// NULL unless requests are logged (-l)
+	AccessLog *accessLog;
+
+	// Milliseconds a connection may wait for its next request, 0 closes
+	// every connection after one response (-k)
+	long long idleTimeout;
+	// Requests answered on one connection before it gets closed (-n)
+	unsigned long maxConnectionRequests;
+	// Responses this worker has finished with, which -r is counted in
+	unsigned long requestsAnswered;
+	// Set once the worker stops accepting, so open connections get closed
+	// after their current response instead of lingering
+	bool draining;
+
+	// Connections waiting for a request, oldest first. Every connection
+	// gets the same timeout, so this is also deadline order.
+	Connection *idleOldest;
+	Connection *idleNewest;
+
+	// Date header shared by every response sent during dateSecond, only
+	// formatted again once the clock has moved on
+	char dateHeader[DATE_HEADER_SIZE];
+	size_t dateHeaderLength;
+	time_t dateSecond;
+} Worker;
@@ -0,0 +1,132 @@
+# Shared by the scripts next to it: starts the server on port 8080 in a
+# scratch directory holding the files a script asks for, and reads its
+# responses off a connection.
+
+import os
+import shutil
+import signal
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+PORT = 8080
+
+
+def port_open():
+	try:
+		socket.create_connection(('127.0.0.1', PORT)).close()
+		return True
+	except ConnectionRefusedError:
+		return False
+
+
+class Response:
+	def __init__(self, status, headers, body):
+		self.status = status
+		# Lowercased names, the last one given wins
+		self.headers = headers
+		self.body = body
+
+	def header(self, name):
+		return self.headers.get(name.lower())
+
+
+class Connection:
+	def __init__(self):
+		self.socket = socket.create_connection(('127.0.0.1', PORT))
+		self.socket.settimeout(5)
+		self.stream = self.socket.makefile('rb')
+
+	def send(self, data):
+		self.socket.sendall(data)
+
+	def request(self, path, headers=(), method='GET'):
+		text = '%s %s HTTP/1.1\r\n' % (method, path)
+		text += ''.join('%s: %s\r\n' % header for header in headers)
+		self.send((text + '\r\n').encode('latin-1'))
+
+	# Reads the next response, which has no body for a HEAD request or a
+	# 304 whatever its Content-Length says
+	def response(self, head=False):
+		line = self.stream.readline()
+		if not line:
+			raise AssertionError('connection closed before a response')
+		status = int(line.split()[1])
+		headers = {}
+		while True:
+			line = self.stream.readline()
+			if not line:
+				raise AssertionError('connection closed inside a response head')
+			if line in (b'\r\n', b'\n'):
+				break
+			name, value = line.decode('latin-1').split(':', 1)
+			headers[name.strip().lower()] = value.strip()
+		length = 0 if head or status == 304 else int(headers.get('content-length', '0'))
+		body = self.stream.read(length)
+		if len(body) != length:
+			raise AssertionError('connection closed after %d of %d body bytes'
+				% (len(body), length))
+		return Response(status, headers, body)
+
+	# Whether the server hung up, without waiting long for it. Closing with
+	# some of the request unread resets the connection.
+	def closed(self):
+		self.socket.settimeout(2)
+		try:
+			return self.stream.read(1) == b''
+		except ConnectionResetError:
+			return True
+		except socket.timeout:
+			return False
+
+	def close(self):
+		self.stream.close()
+		self.socket.close()
+
+
+class Server:
+	def __init__(self, binary, files, options=()):
+		self.binary = os.path.abspath(binary)
+		self.files = files
+		self.options = list(options)
+
+	def __enter__(self):
+		if port_open():
+			raise AssertionError('something is already listening on port %d' % PORT)
+		self.root = tempfile.mkdtemp()
+		for name, content in self.files.items():
+			with open(os.path.join(self.root, name), 'wb') as f:
+				f.write(content)
+		# Only shown when a check fails, 404s and the like get printed too
+		self.log = tempfile.TemporaryFile()
+		self.process = subprocess.Popen([self.binary, '-w', '1'] + self.options,
+			cwd=self.root, stdout=self.log, stderr=self.log, start_new_session=True)
+		for _ in range(50):
+			if port_open():
+				return self
+			time.sleep(0.1)
+		self.__exit__(AssertionError, None, None)
+		raise AssertionError('server did not start listening')
+
+	def stop(self):
+		# Takes the workers down along with the process that started them,
+		# and waits for the port so the next script gets a server of its own
+		os.killpg(self.process.pid, signal.SIGKILL)
+		self.process.wait()
+		for _ in range(50):
+			if not port_open():
+				break
+			time.sleep(0.1)
+		shutil.rmtree(self.root)
+
+	def __exit__(self, kind, value, traceback):
+		self.stop()
+		if kind is not None:
+			self.log.seek(0)
+			sys.stderr.write(self.log.read().decode('utf-8', 'replace'))
+		self.log.close()
+
+	def path(self, name):
+		return os.path.join(self.root, name)
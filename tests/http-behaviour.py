@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+# Checks what the server answers to requests whose status code depends on
+# more than the file existing.
+#
+# Usage: tests/http-behaviour.py bin/httpServer [extra server options]
+
+import os
+import sys
+import time
+
+from harness import Connection, Server
+
+CONTENT = os.urandom(10000)
+SIZE = len(CONTENT)
+SCRIPT = b'function f() { return 1; }\n' * 100
+
+
+def get(path, headers=(), method='GET'):
+	connection = Connection()
+	connection.request(path, list(headers) + [('Connection', 'close')], method)
+	response = connection.response(head=method == 'HEAD')
+	connection.close()
+	return response
+
+
+def check_ranges(server):
+	response = get('/data.bin', [('Range', 'bytes=0-99')])
+	assert response.status == 206, response.status
+	assert response.header('Content-Range') == 'bytes 0-99/%d' % SIZE
+	assert response.body == CONTENT[:100]
+
+	response = get('/data.bin', [('Range', 'bytes=-50')])
+	assert response.status == 206, response.status
+	assert response.body == CONTENT[-50:]
+
+	# Clamped to the end of the file
+	response = get('/data.bin', [('Range', 'bytes=9990-20000')])
+	assert response.status == 206, response.status
+	assert response.header('Content-Range') == 'bytes 9990-%d/%d' % (SIZE - 1, SIZE)
+	assert response.body == CONTENT[9990:]
+
+	response = get('/data.bin', [('Range', 'bytes=0-9,100-109')])
+	assert response.status == 206, response.status
+	contentType = response.header('Content-Type')
+	assert contentType.startswith('multipart/byteranges; boundary='), contentType
+	boundary = contentType.split('=', 1)[1].encode()
+	parts = response.body.split(b'--' + boundary)
+	assert parts[-1] == b'--\r\n', parts[-1]
+	bodies = [part.split(b'\r\n\r\n', 1)[1][:-2] for part in parts[1:-1]]
+	assert bodies == [CONTENT[0:10], CONTENT[100:110]], bodies
+
+	response = get('/data.bin', [('Range', 'bytes=%d-' % SIZE)])
+	assert response.status == 416, response.status
+	assert response.header('Content-Range') == 'bytes */%d' % SIZE
+
+	# Malformed, overflowing or too many ranges are ignored
+	for value in ['bytes=abc', 'bytes=5-1', 'items=0-5', 'bytes=18446744073709551620-',
+			'bytes=99999999999999999999-', 'bytes=-18446744073709551620',
+			'bytes=0-0,2-2,4-4,6-6,8-8']:
+		response = get('/data.bin', [('Range', value)])
+		assert response.status == 200, (value, response.status)
+		assert response.body == CONTENT, value
+
+
+def check_conditional(server):
+	response = get('/data.bin')
+	assert response.status == 200, response.status
+	etag = response.header('ETag')
+	modified = response.header('Last-Modified')
+	assert etag is not None and etag.startswith('"'), etag
+	assert modified is not None
+
+	# If-None-Match compares weakly, so a weak tag matches too
+	for headers in [[('If-None-Match', etag)], [('If-None-Match', '"other", ' + etag)],
+			[('If-None-Match', 'W/' + etag)], [('If-None-Match', '*')],
+			[('If-Modified-Since', modified)]]:
+		response = get('/data.bin', headers)
+		assert response.status == 304, (headers, response.status)
+		assert response.header('ETag') == etag, headers
+		assert response.body == b'', headers
+	response = get('/data.bin', [('If-None-Match', etag)], 'HEAD')
+	assert response.status == 304, response.status
+
+	# If-None-Match wins over If-Modified-Since when both are sent
+	for headers in [[('If-None-Match', '"other"')],
+			[('If-Modified-Since', 'Thu, 01 Jan 1970 00:00:00 GMT')],
+			[('If-Modified-Since', 'not a date')],
+			[('If-None-Match', '"other"'), ('If-Modified-Since', modified)]]:
+		response = get('/data.bin', headers)
+		assert response.status == 200, (headers, response.status)
+		assert response.body == CONTENT, headers
+
+	# If-Range keeps the range only for the current version of the file, and
+	# weak tags never count
+	response = get('/data.bin', [('Range', 'bytes=0-9'), ('If-Range', etag)])
+	assert response.status == 206, response.status
+	response = get('/data.bin', [('Range', 'bytes=0-9'), ('If-Range', modified)])
+	assert response.status == 206, response.status
+	for validator in ['"other"', 'W/' + etag]:
+		response = get('/data.bin', [('Range', 'bytes=0-9'), ('If-Range', validator)])
+		assert response.status == 200, (validator, response.status)
+		assert response.body == CONTENT, validator
+
+
+def check_keep_alive(server):
+	connection = Connection()
+	for _ in range(3):
+		connection.request('/data.bin')
+		response = connection.response()
+		assert response.status == 200, response.status
+		assert response.header('Connection') is None, response.header('Connection')
+	connection.request('/data.bin', [('Connection', 'close')])
+	response = connection.response()
+	assert response.header('Connection') == 'close', response.header('Connection')
+	assert connection.closed()
+	connection.close()
+
+	# HTTP/1.0 closes unless it asks otherwise
+	connection = Connection()
+	connection.send(b'GET /data.bin HTTP/1.0\r\nConnection: keep-alive\r\n\r\n')
+	response = connection.response()
+	assert response.header('Connection') == 'keep-alive', response.header('Connection')
+	connection.send(b'GET /data.bin HTTP/1.0\r\n\r\n')
+	response = connection.response()
+	assert response.status == 200, response.status
+	assert connection.closed()
+	connection.close()
+
+
+def check_pipelining(server):
+	connection = Connection()
+	requests = [
+		(b'GET /data.bin HTTP/1.1\r\n\r\n', 200, False),
+		(b'GET /missing HTTP/1.1\r\n\r\n', 404, False),
+		(b'HEAD /data.bin HTTP/1.1\r\n\r\n', 200, True),
+		(b'GET /data.bin HTTP/1.1\r\nRange: bytes=5-9\r\n\r\n', 206, False),
+	] * 4
+	connection.send(b''.join(request for request, _, _ in requests))
+	for i, (_, status, head) in enumerate(requests):
+		response = connection.response(head)
+		assert response.status == status, (i, response.status)
+		if status == 206:
+			assert response.body == CONTENT[5:10], i
+		elif status == 200 and not head:
+			assert response.body == CONTENT, i
+		elif head:
+			assert response.header('Content-Length') == str(SIZE), i
+
+	# Arriving a few bytes at a time makes no difference
+	request = b'GET /data.bin HTTP/1.1\r\nRange: bytes=0-3\r\n\r\n'
+	for i in range(0, len(request), 5):
+		connection.send(request[i:i + 5])
+	response = connection.response()
+	assert response.status == 206 and response.body == CONTENT[:4], response.status
+	connection.close()
+
+
+# Requests the parser or the server turns away, and the status each gets.
+# The connection is closed after every one of them, since what follows
+# can't be trusted to be the next request.
+REFUSED = [
+	(b'GARBAGE\x01\r\n\r\n', 400),
+	(b'GET /data.bin HTTP/1.1\r\nBad Header\r\n\r\n', 400),
+	(b'GET /data.bin HTTP/1.1\r\nName : value\r\n\r\n', 400),
+	(b'GET /data.bin HTTP/1.1\r\nX: a\r\n folded\r\n\r\n', 400),
+	(b'GET /data.bin HTTP/2.0\r\n\r\n', 505),
+	(b'GET /' + b'a' * 2000 + b' HTTP/1.1\r\n\r\n', 414),
+	(b'GET /data.bin HTTP/1.1\r\nX: ' + b'a' * 2000 + b'\r\n\r\n', 431),
+	(b'GET /data.bin HTTP/1.1\r\n' + b''.join(b'X-%d: a\r\n' % i for i in range(40))
+		+ b'\r\n', 431),
+	(b'GET /data.bin HTTP/1.1\r\n' + b''.join(b'X-%d: %s\r\n' % (i, b'a' * 900)
+		for i in range(10)) + b'\r\n', 431),
+	(b'BREW /pot HTTP/1.1\r\n\r\n', 501),
+	# A body the server never reads would be taken for the next request
+	(b'GET /data.bin HTTP/1.1\r\nContent-Length: 27\r\n\r\n'
+		b'GET /smuggled HTTP/1.1\r\n\r\n', 400),
+	(b'GET /data.bin HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n'
+		b'0\r\n\r\n', 501),
+]
+
+
+def check_refused(server):
+	for request, status in REFUSED:
+		connection = Connection()
+		connection.send(request)
+		response = connection.response()
+		assert response.status == status, (request[:40], response.status)
+		assert response.header('Connection') == 'close', request[:40]
+		assert connection.closed(), request[:40]
+		connection.close()
+
+	# An explicitly empty body is fine and keeps the connection usable
+	connection = Connection()
+	connection.request('/data.bin', [('Content-Length', '0')])
+	connection.request('/data.bin')
+	for _ in range(2):
+		assert connection.response().status == 200
+	connection.close()
+
+
+# Precompressed sidecars only need to be there, their content is sent as it is
+def check_sidecars(server):
+	accepting = [('Accept-Encoding', 'gzip, br')]
+	for _ in range(2):
+		response = get('/app.js', accepting)
+		assert response.header('Content-Encoding') == 'br', response.header('Content-Encoding')
+		assert response.header('Vary') == 'Accept-Encoding'
+		assert response.body == b'brotli', response.body
+	response = get('/app.js')
+	assert response.header('Content-Encoding') is None
+	assert response.header('Vary') == 'Accept-Encoding'
+	assert response.body == SCRIPT
+
+	# Files without sidecars, or missing altogether, have nothing to vary by
+	response = get('/data.bin', accepting)
+	assert response.header('Vary') is None and response.body == CONTENT
+	response = get('/missing.js', accepting)
+	assert response.status == 404, response.status
+
+	# A sidecar that went away is given up on once the server notices,
+	# which takes until the check interval has passed
+	os.remove(server.path('app.js.br'))
+	time.sleep(1.1)
+	for _ in range(2):
+		response = get('/app.js', accepting)
+		assert response.status == 200, response.status
+		assert response.header('Content-Encoding') == 'gzip', response.header('Content-Encoding')
+		assert response.body == b'gzip', response.body
+
+
+CHECKS = [check_ranges, check_conditional, check_keep_alive, check_pipelining, check_refused,
+	check_sidecars]
+
+
+def main():
+	files = {'data.bin': CONTENT, 'app.js': SCRIPT, 'app.js.br': b'brotli', 'app.js.gz': b'gzip'}
+	with Server(sys.argv[1], files, sys.argv[2:]) as server:
+		for check in CHECKS:
+			check(server)
+	print('ok')
+
+
+if __name__ == '__main__':
+	main()
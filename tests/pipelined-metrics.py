@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# Pipelines metrics scrapes ahead of a file that gets streamed through the
+# connection's buffer, which all have to fit in its arena at the same time,
+# and checks latencies are counted in the buckets Prometheus expects.
+#
+# Usage: tests/pipelined-metrics.py bin/httpServer [extra server options]
+
+import os
+import subprocess
+import sys
+import tempfile
+
+from harness import Connection, Server
+
+METRICS_PATH = '/__metrics'
+SCRAPES = 3
+FILE_SIZE = 200 * 1024
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src')
+
+# Records the latencies it is given and prints what a scrape would show
+BUCKETS_DRIVER = r'''
+#include "metrics.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv)
+{
+	Metrics *const metrics = metrics_create(1);
+	if (metrics == NULL)
+		return 1;
+	for (int i = 1; i < argc; i++)
+		metrics_record_latency(&metrics->workers[0], atoll(argv[i]));
+	static char out[64 * 1024];
+	size_t const length = metrics_format(metrics, out, sizeof(out));
+	fwrite(out, 1, length, stdout);
+	return length == 0;
+}
+'''
+
+
+def check_pipelined_scrapes(content):
+	connection = Connection()
+	requests = [('GET %s HTTP/1.1\r\n\r\n' % METRICS_PATH).encode()] * SCRAPES
+	requests.append(b'GET /large.bin HTTP/1.1\r\n\r\n')
+	connection.send(b''.join(requests))
+	for i in range(SCRAPES):
+		response = connection.response()
+		assert response.status == 200, 'scrape %d answered %d' % (i, response.status)
+		assert b'http_requests_total' in response.body, 'scrape %d has no counters' % i
+	response = connection.response()
+	assert response.status == 200, 'file answered %d' % response.status
+	assert response.body == content, 'file came back different'
+	connection.close()
+
+
+# le buckets include their bound, so a request taking exactly 16 or 32
+# microseconds is counted in the bucket of that bound and not the next
+def check_bucket_bounds():
+	with tempfile.TemporaryDirectory() as build:
+		driver = os.path.join(build, 'buckets.c')
+		with open(driver, 'w') as f:
+			f.write(BUCKETS_DRIVER)
+		binary = os.path.join(build, 'buckets')
+		subprocess.run([os.environ.get('CC', 'cc'), '-I', SOURCE, '-o', binary, driver,
+			os.path.join(SOURCE, 'metrics.c')], check=True)
+		latencies = [0, 1, 15, 16, 17, 32, 33, 64, 65]
+		output = subprocess.run([binary] + [str(value) for value in latencies],
+			stdout=subprocess.PIPE, check=True).stdout.decode()
+
+	buckets = {}
+	for line in output.splitlines():
+		if line.startswith('http_request_duration_seconds_bucket{le="'):
+			bound, count = line[len('http_request_duration_seconds_bucket{le="'):].split('"} ')
+			buckets[bound] = int(count)
+	for bound, expected in [('0.000016', 4), ('0.000032', 6), ('0.000064', 8),
+			('0.000128', 9), ('+Inf', 9)]:
+		assert buckets.get(bound) == expected, (bound, buckets.get(bound), expected)
+
+
+def main():
+	content = os.urandom(FILE_SIZE)
+	files = {'large.bin': content}
+	with Server(sys.argv[1], files, ['-f', 'read', '-s', METRICS_PATH] + sys.argv[2:]):
+		check_pipelined_scrapes(content)
+	check_bucket_bounds()
+	print('ok')
+
+
+if __name__ == '__main__':
+	main()